@@ -0,0 +1,88 @@
+#undef NDEBUG
+
+#include <map>
+#include <string>
+#include <cassert>
+
+#include <hatn/validator/validator.hpp>
+#include <hatn/validator/adapters/reporting_adapter.hpp>
+#include <hatn/validator/reporting/inline_buffer.hpp>
+#include <hatn/validator/reporting/locale/sample_locale.hpp>
+
+#include "benchmark.hpp"
+
+using namespace HATN_VALIDATOR_NAMESPACE;
+
+// Benchmark of formatting reports of failed validations.
+// Reports formatted with default strings are compared to reports formatted with translator,
+// the difference is the cost of phrase lookups and copies.
+
+int main(int argc, char* argv[])
+{
+    auto n=benchmark::iterations(argc,argv,200000);
+
+    std::map<std::string,std::string> obj{
+        {"field1","abc"},
+        {"field2","abc"}
+    };
+
+    auto v1=validator(
+        _["field1"](gte,"xyz")
+    );
+    auto v2=validator(
+        _["field2"](size(gte,10))
+    );
+    auto v3=validator(
+        _["field1"](gte,"xyz") ^OR^ _["field2"](size(gte,10))
+    );
+
+    std::string report;
+    auto check_report=[&](auto& v, auto& ra, const char* expected)
+    {
+        report.clear();
+        v.apply(ra);
+        assert(report==expected);
+        return [&v,&ra,&report]()
+        {
+            report.clear();
+            v.apply(ra);
+            return report.size();
+        };
+    };
+
+    std::cout << "Iterations: " << n << std::endl;
+
+    // default strings
+    {
+        auto ra=make_reporting_adapter(obj,report);
+        benchmark::run("operator, default strings",n,check_report(v1,ra,"field1 must be greater than or equal to xyz"));
+        benchmark::run("property, default strings",n,check_report(v2,ra,"size of field2 must be greater than or equal to 10"));
+        benchmark::run("aggregation, default strings",n,check_report(v3,ra,
+                        "field1 must be greater than or equal to xyz OR size of field2 must be greater than or equal to 10"));
+    }
+
+    // translated strings
+    {
+        auto ra=make_reporting_adapter(obj,make_reporter(report,make_formatter(validator_static_translator_sample())));
+        benchmark::run("operator, translator",n,check_report(v1,ra,"field1 must be greater than or equal to xyz"));
+        benchmark::run("property, translator",n,check_report(v2,ra,"size of field2 must be greater than or equal to 10"));
+        benchmark::run("aggregation, translator",n,check_report(v3,ra,
+                        "field1 must be greater than or equal to xyz OR size of field2 must be greater than or equal to 10"));
+    }
+
+    // default strings, destination with inline storage
+    {
+        inline_buffer<> dst;
+        auto ra=make_reporting_adapter(obj,dst);
+        benchmark::run("aggregation, default strings, inline buffer",n,
+            [&]()
+            {
+                dst.clear();
+                v3.apply(ra);
+                return dst.size();
+            }
+        );
+    }
+
+    return 0;
+}
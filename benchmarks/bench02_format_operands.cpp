@@ -0,0 +1,68 @@
+#undef NDEBUG
+
+#include <string>
+#include <vector>
+#include <cassert>
+
+#include <hatn/validator/validator.hpp>
+#include <hatn/validator/adapters/reporting_adapter.hpp>
+#include <hatn/validator/interval.hpp>
+#include <hatn/validator/operators/in.hpp>
+#include <hatn/validator/operators/lex_in.hpp>
+#include <hatn/validator/reporting/quotes_decorator.hpp>
+
+#include "benchmark.hpp"
+
+using namespace HATN_VALIDATOR_NAMESPACE;
+
+// Benchmark of formatting reports with range and interval operands.
+
+int main(int argc, char* argv[])
+{
+    auto n=benchmark::iterations(argc,argv,20000);
+
+    std::vector<size_t> numbers;
+    std::vector<std::string> words;
+    for (size_t i=0;i<1000;i++)
+    {
+        numbers.push_back(i*10);
+        words.push_back(std::string("word")+std::to_string(i));
+    }
+
+    size_t number=5;
+    std::string word="hello";
+    std::string report;
+
+    auto bench=[&](const char* name, size_t iterations, const auto& v, auto& ra)
+    {
+        report.clear();
+        assert(!v.apply(ra));
+        assert(!report.empty());
+        benchmark::run(name,iterations,
+            [&]()
+            {
+                report.clear();
+                v.apply(ra);
+                return report.size();
+            }
+        );
+    };
+
+    std::cout << "Iterations: " << n << std::endl;
+
+    auto numbers_ra=make_reporting_adapter(number,report);
+    auto words_ra=make_reporting_adapter(word,report);
+    auto decorated_words_ra=make_reporting_adapter(word,make_reporter(report,
+                                make_formatter(get_default_member_names(),make_operand_formatter(quotes_decorator))
+                            ));
+
+    bench("in range of 1000 numbers",n/10,validator(in,range(numbers)),numbers_ra);
+    bench("in range of 1000 numbers, 10 reported",n,validator(in,range(numbers,10)),numbers_ra);
+    bench("in range of 1000 strings",n/10,validator(lex_in,range(words)),words_ra);
+    bench("in range of 1000 strings, 10 reported",n,validator(lex_in,range(words,10)),words_ra);
+    bench("in range of 1000 strings, 10 reported, decorated",n,validator(lex_in,range(words,10)),decorated_words_ra);
+    bench("in interval of numbers",n,validator(in,interval(10,20)),numbers_ra);
+    bench("in interval of strings",n,validator(lex_in,interval("a","b")),words_ra);
+
+    return 0;
+}
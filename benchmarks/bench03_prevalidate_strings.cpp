@@ -0,0 +1,97 @@
+#undef NDEBUG
+
+#include <new>
+#include <cstdlib>
+#include <string>
+#include <cassert>
+
+#include <hatn/validator/validator.hpp>
+#include <hatn/validator/validate.hpp>
+#include <hatn/validator/operators/number_patterns.hpp>
+#include <hatn/validator/operators/string_patterns.hpp>
+#include <hatn/validator/operators/regex.hpp>
+#include <hatn/validator/operators/lexicographical.hpp>
+#include <hatn/validator/properties/length.hpp>
+
+#include "benchmark.hpp"
+
+using namespace HATN_VALIDATOR_NAMESPACE;
+
+// Benchmark of pre-validation of string fields that are views of a receive buffer.
+// Number of memory allocations per pre-validated field is counted with replaced global operator new.
+
+namespace {
+size_t allocations=0;
+}
+
+void* operator new(std::size_t size)
+{
+    ++allocations;
+    if (auto p=std::malloc(size==0?1:size))
+    {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+int main(int argc, char* argv[])
+{
+    auto n=benchmark::iterations(argc,argv,1000000);
+
+    // fields are views of a buffer that is not null-terminated after each field
+    const char buf[]="12345678abcdef0123.5e10hello_world";
+    string_view field_int(buf,8);
+    string_view field_hex(buf+8,6);
+    string_view field_float(buf+14,9);
+    string_view field_word(buf+23,11);
+
+    auto member=_["field"];
+    error_report err;
+
+    auto bench=[&](const char* name, const auto& v, string_view field)
+    {
+        validate(member,field,v,err);
+        assert(!err);
+
+        auto before=allocations;
+        validate(member,field,v,err);
+        auto allocated=allocations-before;
+
+        std::string title=std::string(name)+", allocations "+std::to_string(allocated);
+        benchmark::run(title.c_str(),n,
+            [&]()
+            {
+                validate(member,field,v,err);
+                return static_cast<size_t>(err.value().value());
+            }
+        );
+        return allocated;
+    };
+
+    std::cout << "Iterations: " << n << std::endl;
+
+    assert(bench("str_int",validator(_["field"](str_int,true)),field_int)==0);
+    assert(bench("str_float",validator(_["field"](str_float,true)),field_float)==0);
+    assert(bench("str_hex",validator(_["field"](str_hex,true)),field_hex)==0);
+    assert(bench("str_alpha",validator(_["field"](str_alpha,true)),field_word)==0);
+    assert(bench("lexicographical",validator(_["field"](lex_gte,"hello")),field_word)==0);
+    assert(bench("case insensitive lexicographical",validator(_["field"](ilex_gte,"HELLO")),field_word)==0);
+    assert(bench("size",validator(_["field"](size(lte,32))),field_word)==0);
+    assert(bench("length",validator(_["field"](length(lte,32))),field_word)==0);
+    assert(bench("all patterns",validator(_["field"](str_alpha,true),_["field"](size(lte,32)),_["field"](lex_gte,"hello")),field_word)==0);
+
+    // allocations of regex matching depend on implementation of regex library, the value itself is not copied
+    bench("regex_match",validator(_["field"](regex_match,std::regex("[a-z_]+"))),field_word);
+
+    return 0;
+}
@@ -0,0 +1,94 @@
+#undef NDEBUG
+
+#include <vector>
+#include <string>
+#include <thread>
+#include <algorithm>
+#include <cassert>
+
+#include <hatn/validator/validator.hpp>
+#include <hatn/validator/validate.hpp>
+#include <hatn/validator/interval.hpp>
+#include <hatn/validator/operators/in.hpp>
+
+#include "benchmark.hpp"
+
+using namespace HATN_VALIDATOR_NAMESPACE;
+
+// Benchmark of pre-validation of bulk assignment of numbers, e.g. before set_validated() of a container.
+
+int main(int argc, char* argv[])
+{
+    auto n=benchmark::iterations(argc,argv,200);
+
+    std::vector<int> ints;
+    std::vector<double> doubles;
+    for (size_t i=0;i<1000000;i++)
+    {
+        ints.push_back(static_cast<int>(i%1000));
+        doubles.push_back(static_cast<double>(i%1000)/10.0);
+    }
+
+    auto member=_["field"];
+    error_report err;
+
+    auto bench=[&](const char* name, const auto& v, const auto& make_val, bool expected)
+    {
+        validate(member,make_val(),v,err);
+        assert(static_cast<bool>(err)!=expected);
+        benchmark::run(name,n,
+            [&]()
+            {
+                validate(member,make_val(),v,err);
+                return static_cast<size_t>(err.value().value());
+            }
+        );
+    };
+
+    std::cout << "Iterations: " << n << std::endl;
+
+    auto last_invalid=ints;
+    last_invalid.back()=1000;
+
+    auto ints_range=[&](){return range(ints);};
+    auto last_invalid_range=[&](){return range(last_invalid);};
+    auto doubles_range=[&](){return range(doubles);};
+    auto last_invalid_strict_any=[&](){return strict_any(range(last_invalid));};
+
+    bench("1M ints, ALL gte",validator(_["field"](ALL(value(gte,0)))),ints_range,true);
+    bench("1M ints, ALL lt",validator(_["field"](ALL(value(lt,1000)))),ints_range,true);
+    bench("1M ints, ALL in interval",validator(_["field"](ALL(value(in,interval(0,999))))),ints_range,true);
+    bench("1M ints, ALL in open interval",validator(_["field"](ALL(value(in,interval(-1,1000,interval.open()))))),ints_range,true);
+    bench("1M ints, ALL in interval, last fails",validator(_["field"](ALL(value(in,interval(0,999))))),last_invalid_range,false);
+    bench("1M doubles, ALL gte",validator(_["field"](ALL(value(gte,0.0)))),doubles_range,true);
+    bench("1M doubles, ALL in interval",validator(_["field"](ALL(value(in,interval(0.0,100.0))))),doubles_range,true);
+    bench("1M ints, strict ANY eq, last matches",validator(_["field"](ANY(value(eq,1000)))),last_invalid_strict_any,true);
+
+    // expensive operator: lookup of each element in unsorted range
+    std::vector<int> allowed;
+    for (int i=0;i<1000;i++)
+    {
+        allowed.push_back(i);
+    }
+    std::vector<int> ints_100k(ints.begin(),ints.begin()+100000);
+    auto threads=(std::max)(2u,std::thread::hardware_concurrency());
+    auto in_range=validator(_["field"](ALL(value(in,range(allowed)))));
+    auto n_in=(std::max)(static_cast<size_t>(1),n/20);
+    auto bench_in=[&](const char* name, const auto& make_val)
+    {
+        validate(member,make_val(),in_range,err);
+        assert(!err);
+        benchmark::run(name,n_in,
+            [&]()
+            {
+                validate(member,make_val(),in_range,err);
+                return static_cast<size_t>(err.value().value());
+            }
+        );
+    };
+    bench_in("100K ints, ALL in range of 1000",[&](){return range(ints_100k);});
+    std::cout << "Threads: " << threads << std::endl;
+    bench_in("100K ints, ALL in range of 1000, parallel",[&](){return parallel_range(ints_100k,threads);});
+
+    return 0;
+}
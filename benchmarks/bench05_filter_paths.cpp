@@ -0,0 +1,97 @@
+#undef NDEBUG
+
+#include <map>
+#include <set>
+#include <vector>
+#include <string>
+#include <cassert>
+
+#include <hatn/validator/validator.hpp>
+#include <hatn/validator/adapters/default_adapter.hpp>
+#include <hatn/validator/filter_path.hpp>
+#include <hatn/validator/filter_path_index.hpp>
+
+#include "benchmark.hpp"
+
+using namespace HATN_VALIDATOR_NAMESPACE;
+
+// Benchmark of lookups of paths in filters of partial validation.
+// Linear scan of paths, which is what lists of paths do, is compared to lookup in index of paths.
+
+int main(int argc, char* argv[])
+{
+    auto n=benchmark::iterations(argc,argv,10000);
+
+    using path_type=std::decay_t<decltype(_[std::string()][std::string()].path())>;
+    auto make_path=[](size_t i)
+    {
+        return _[std::string("level")+std::to_string(i%16)][std::string("field")+std::to_string(i)].path();
+    };
+
+    std::cout << "Iterations: " << n << std::endl;
+
+    for (size_t count : {10,100,1000})
+    {
+        std::vector<path_type> paths;
+        for (size_t i=0;i<count;i++)
+        {
+            paths.push_back(make_path(i));
+        }
+        auto index=make_filter_path_index(paths);
+
+        // the last path is the worst case for linear scan, a missing path is the worst case for both
+        auto last=make_path(count-1);
+        auto missing=make_path(count);
+        auto scan=[&paths](const auto& path)
+        {
+            for (auto&& current_path:paths)
+            {
+                if (path_starts_with(path,current_path))
+                {
+                    return true;
+                }
+            }
+            return false;
+        };
+        assert(scan(last) && index.has_path(last));
+        assert(!scan(missing) && !index.has_path(missing));
+
+        auto suffix=std::string(", ")+std::to_string(count)+" paths";
+        benchmark::run((std::string("linear scan, last path")+suffix).c_str(),n,
+            [&](){return static_cast<size_t>(scan(last));}
+        );
+        benchmark::run((std::string("index, last path")+suffix).c_str(),n,
+            [&](){return static_cast<size_t>(index.has_path(last));}
+        );
+        benchmark::run((std::string("linear scan, missing path")+suffix).c_str(),n,
+            [&](){return static_cast<size_t>(scan(missing));}
+        );
+        benchmark::run((std::string("index, missing path")+suffix).c_str(),n,
+            [&](){return static_cast<size_t>(index.has_path(missing));}
+        );
+    }
+
+    // validation with filtering adapter
+    std::vector<path_type> paths;
+    for (size_t i=0;i<1000;i++)
+    {
+        paths.push_back(make_path(i));
+    }
+    auto index=make_filter_path_index(paths);
+    auto v=validator(
+        _["level1"]["field1"](exists,true),
+        _["level2"]["field2"](exists,true),
+        _["level3"]["field1000"](exists,true)
+    );
+    std::map<std::string,std::set<std::string>> m{
+        {"level1",{"field1"}},
+        {"level2",{"field2"}}
+    };
+    assert(v.apply(include_paths(make_default_adapter(m),index)));
+    // adapter is constructed for each validation as in real use, the index is not copied
+    benchmark::run("validate with index of 1000 paths",n,
+        [&](){return static_cast<size_t>(v.apply(include_paths(make_default_adapter(m),index)));}
+    );
+
+    return 0;
+}
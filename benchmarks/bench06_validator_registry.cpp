@@ -0,0 +1,160 @@
+#undef NDEBUG
+
+#include <map>
+#include <string>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <atomic>
+#include <cassert>
+
+#include <hatn/validator/validator.hpp>
+#include <hatn/validator/validator_registry.hpp>
+
+#include "benchmark.hpp"
+
+using namespace HATN_VALIDATOR_NAMESPACE;
+
+// Benchmark of read throughput of validator registry with concurrent updates.
+// Registry with epoch-based publication is compared to validators guarded with mutex and shared pointers.
+
+namespace
+{
+
+using object_type=std::map<std::string,int>;
+using map_type=validator_registry<object_type>::map_type;
+
+/**
+ * Run readers in threads while a writer replaces validators, print total read throughput of all threads.
+ */
+template <typename MakeReaderT, typename UpdateT>
+void run_threads(const char* name, size_t threads, size_t iterations, MakeReaderT make_reader, UpdateT update)
+{
+    std::atomic<size_t> started{0};
+    std::atomic<size_t> finished{0};
+    std::vector<std::thread> readers;
+    for (size_t i=0;i<threads;i++)
+    {
+        readers.emplace_back(
+            [&]()
+            {
+                auto read=make_reader();
+                ++started;
+                while (started.load()!=threads)
+                {
+                    std::this_thread::yield();
+                }
+                size_t sum=0;
+                for (size_t j=0;j<iterations;j++)
+                {
+                    sum+=read(j);
+                }
+                benchmark::sink()+=sum;
+                ++finished;
+            }
+        );
+    }
+
+    while (started.load()!=threads)
+    {
+        std::this_thread::yield();
+    }
+    auto start=std::chrono::steady_clock::now();
+    size_t updates=0;
+    while (finished.load()!=threads)
+    {
+        update(updates++);
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+    }
+    auto elapsed=std::chrono::duration<double,std::nano>(std::chrono::steady_clock::now()-start);
+    for (auto&& thread:readers)
+    {
+        thread.join();
+    }
+
+    auto mops=static_cast<double>(iterations*threads)*1000.0/elapsed.count();
+    std::string title=std::string(name)+", "+std::to_string(threads)+" threads";
+    std::cout << std::left << std::setw(56) << title
+              << std::right << std::setw(12) << std::fixed << std::setprecision(2) << mops << " Mops/s"
+              << ", updates: " << updates << std::endl;
+}
+
+}
+
+int main(int argc, char* argv[])
+{
+    auto n=benchmark::iterations(argc,argv,1000000);
+
+    object_type obj{{"field1",10},{"field2",20}};
+    std::vector<std::string> names;
+    for (size_t i=0;i<64;i++)
+    {
+        names.push_back(std::string("tenant")+std::to_string(i));
+    }
+    auto fill=[&names](map_type& validators, size_t version)
+    {
+        for (auto&& name:names)
+        {
+            validators[name]=std::make_shared<validator_registry<object_type>::validator_type>(
+                        validator(_["field1"](gte,static_cast<int>(version%5)),_["field2"](lt,100))
+                    );
+        }
+    };
+
+    std::cout << "Iterations per thread: " << n << std::endl;
+
+    for (size_t threads : {1,2,4,8,16,32,64})
+    {
+        validator_registry<object_type> registry;
+        registry.update([&](map_type& validators){fill(validators,0);});
+        assert(registry.make_reader().apply(names[0],obj));
+
+        run_threads("registry",threads,n,
+            [&]()
+            {
+                auto reader=std::make_shared<validator_registry<object_type>::reader>(registry.make_reader());
+                return [&names,&obj,reader](size_t i)
+                {
+                    return static_cast<size_t>(reader->apply(names[i%names.size()],obj).value());
+                };
+            },
+            [&](size_t version)
+            {
+                registry.update([&](map_type& validators){fill(validators,version);});
+            }
+        );
+    }
+
+    for (size_t threads : {1,2,4,8,16,32,64})
+    {
+        std::mutex mutex;
+        auto validators=std::make_shared<map_type>();
+        fill(*validators,0);
+
+        run_threads("mutex and shared_ptr",threads,n,
+            [&]()
+            {
+                return [&](size_t i)
+                {
+                    std::shared_ptr<map_type> current;
+                    {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        current=validators;
+                    }
+                    auto it=current->find(names[i%names.size()]);
+                    return static_cast<size_t>(it->second->apply(obj).value());
+                };
+            },
+            [&](size_t version)
+            {
+                auto next=std::make_shared<map_type>();
+                fill(*next,version);
+                std::lock_guard<std::mutex> lock(mutex);
+                validators=std::move(next);
+            }
+        );
+    }
+
+    return 0;
+}
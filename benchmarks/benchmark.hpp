@@ -0,0 +1,90 @@
+/**
+@copyright Evgeny Sidorov 2020
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+*/
+
+/****************************************************************************/
+
+/** @file benchmarks/benchmark.hpp
+*
+*  Defines helpers for running benchmarks of cpp-validator library.
+*
+*/
+
+/****************************************************************************/
+
+#ifndef HATN_VALIDATOR_BENCHMARK_HPP
+#define HATN_VALIDATOR_BENCHMARK_HPP
+
+#include <cstdlib>
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+
+namespace benchmark
+{
+
+/**
+ * @brief Get number of iterations to run.
+ * @param argc Number of command line arguments.
+ * @param argv Command line arguments, the first argument can override number of iterations.
+ * @param default_iterations Default number of iterations.
+ * @return Number of iterations.
+ */
+inline size_t iterations(int argc, char* argv[], size_t default_iterations)
+{
+    if (argc>1)
+    {
+        auto n=std::strtoull(argv[1],nullptr,10);
+        if (n!=0)
+        {
+            return static_cast<size_t>(n);
+        }
+    }
+    return default_iterations;
+}
+
+/**
+ * @brief Sink for results of benchmarked functions so that compiler can not optimize them out.
+ */
+inline volatile size_t& sink()
+{
+    static volatile size_t value=0;
+    return value;
+}
+
+/**
+ * @brief Measure average time of a function call and print it.
+ * @param name Name of the benchmark.
+ * @param iterations Number of calls.
+ * @param fn Function to invoke, it must return a number that is accumulated in the sink.
+ * @return Average time of a call in nanoseconds.
+ */
+template <typename FnT>
+double run(const char* name, size_t iterations, FnT&& fn)
+{
+    size_t warmup=iterations/10+1;
+    for (size_t i=0;i<warmup;i++)
+    {
+        sink()+=fn();
+    }
+
+    auto start=std::chrono::steady_clock::now();
+    for (size_t i=0;i<iterations;i++)
+    {
+        sink()+=fn();
+    }
+    auto elapsed=std::chrono::duration<double,std::nano>(std::chrono::steady_clock::now()-start);
+    auto ns=elapsed.count()/static_cast<double>(iterations);
+
+    std::cout << std::left << std::setw(56) << name
+              << std::right << std::setw(12) << std::fixed << std::setprecision(1) << ns << " ns/op" << std::endl;
+    return ns;
+}
+
+}
+
+#endif // HATN_VALIDATOR_BENCHMARK_HPP
@@ -1,5 +1,6 @@
 #undef NDEBUG
 
+#include <cassert>
 #include <iostream>
 #include <hatn/validator/property.hpp>
 #include <hatn/validator/validator.hpp>
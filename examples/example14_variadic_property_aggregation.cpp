@@ -1,5 +1,7 @@
 #undef NDEBUG
 
+#include <cassert>
+
 #include <hatn/validator/variadic_property.hpp>
 #include <hatn/validator/validator.hpp>
 using namespace HATN_VALIDATOR_NAMESPACE;
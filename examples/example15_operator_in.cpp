@@ -1,5 +1,7 @@
 #undef NDEBUG
 
+#include <cassert>
+
 #include <hatn/validator/validator.hpp>
 #include <hatn/validator/operators.hpp>
 #include <hatn/validator/range.hpp>
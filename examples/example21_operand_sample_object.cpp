@@ -1,5 +1,6 @@
 #undef NDEBUG
 
+#include <cassert>
 #include <map>
 #include <hatn/validator/validator.hpp>
 using namespace HATN_VALIDATOR_NAMESPACE;
@@ -1,5 +1,6 @@
 #undef NDEBUG
 
+#include <cassert>
 #include <map>
 #include <hatn/validator/validator.hpp>
 #include <hatn/validator/properties/pair.hpp>
@@ -1,5 +1,7 @@
 #undef NDEBUG
 
+#include <cassert>
+
 #include <hatn/validator/value_transformer.hpp>
 #include <hatn/validator/validator.hpp>
 
@@ -0,0 +1,272 @@
+/**
+@copyright Evgeny Sidorov 2020
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+*/
+
+/****************************************************************************/
+
+/** @file validator/adapters/budget_adapter.hpp
+*
+*  Defines adapter that limits validation with a budget.
+*
+*/
+
+/****************************************************************************/
+
+#ifndef HATN_VALIDATOR_BUDGET_ADAPTER_HPP
+#define HATN_VALIDATOR_BUDGET_ADAPTER_HPP
+
+#include <string>
+
+#include <hatn/validator/config.hpp>
+#include <hatn/validator/status.hpp>
+#include <hatn/validator/error.hpp>
+#include <hatn/validator/validation_budget.hpp>
+#include <hatn/validator/adapters/default_adapter.hpp>
+#include <hatn/validator/adapters/reporting_adapter.hpp>
+
+HATN_VALIDATOR_NAMESPACE_BEGIN
+
+//-------------------------------------------------------------
+
+/**
+ * @brief Adapter traits for budget adapter.
+ *
+ * This adapter traits inherits original adapter traits consuming validation budget on each operator invocation.
+ * Visited elements are consumed by element aggregations and tree aggregations.
+ * When the budget is exhausted operators are not invoked anymore and AND/OR/NOT aggregations
+ * return status::code::exhausted regardless of results of their operands.
+ */
+template <typename BaseTraitsT>
+class budget_adapter_traits : public BaseTraitsT,
+                              public budget_adapter_tag
+{
+    public:
+
+        /**
+         * @brief Constructor.
+         * @param budget Validation budget.
+         * @param args Arguments to forward to constructor of original adapter traits.
+         */
+        template <typename ...Args>
+        budget_adapter_traits(
+                validation_budget& budget,
+                Args&&... args
+            )
+            : BaseTraitsT(std::forward<Args>(args)...),
+              _budget(&budget)
+        {}
+
+        template <typename AdapterT, typename T2, typename OpT>
+        status validate_operator(AdapterT&& adpt, OpT&& op, T2&& b)
+        {
+            if (!_budget->consume_operation())
+            {
+                return status::code::exhausted;
+            }
+            return BaseTraitsT::validate_operator(std::forward<AdapterT>(adpt),std::forward<OpT>(op),std::forward<T2>(b));
+        }
+
+        template <typename AdapterT, typename T2, typename OpT, typename PropT>
+        status validate_property(AdapterT&& adpt, PropT&& prop, OpT&& op, T2&& b)
+        {
+            if (!_budget->consume_operation())
+            {
+                return status::code::exhausted;
+            }
+            return BaseTraitsT::validate_property(std::forward<AdapterT>(adpt),std::forward<PropT>(prop),std::forward<OpT>(op),std::forward<T2>(b));
+        }
+
+        template <typename AdapterT, typename T2, typename OpT, typename MemberT, typename ...Args>
+        status validate_exists(AdapterT&& adpt, MemberT&& member, OpT&& op, T2&& b, Args&&... args)
+        {
+            if (!_budget->consume_operation())
+            {
+                return status::code::exhausted;
+            }
+            return BaseTraitsT::validate_exists(std::forward<AdapterT>(adpt),std::forward<MemberT>(member),std::forward<OpT>(op),std::forward<T2>(b),std::forward<Args>(args)...);
+        }
+
+        template <typename AdapterT, typename T2, typename OpT, typename PropT, typename MemberT>
+        status validate(AdapterT&& adpt, MemberT&& member, PropT&& prop, OpT&& op, T2&& b)
+        {
+            if (!_budget->consume_operation())
+            {
+                return status::code::exhausted;
+            }
+            return BaseTraitsT::validate(std::forward<AdapterT>(adpt),std::forward<MemberT>(member),std::forward<PropT>(prop),std::forward<OpT>(op),std::forward<T2>(b));
+        }
+
+        template <typename AdapterT, typename T2, typename OpT, typename PropT, typename MemberT>
+        status validate_with_other_member(AdapterT&& adpt, MemberT&& member, PropT&& prop, OpT&& op, T2&& b)
+        {
+            if (!_budget->consume_operation())
+            {
+                return status::code::exhausted;
+            }
+            return BaseTraitsT::validate_with_other_member(std::forward<AdapterT>(adpt),std::forward<MemberT>(member),std::forward<PropT>(prop),std::forward<OpT>(op),std::forward<T2>(b));
+        }
+
+        template <typename AdapterT, typename T2, typename OpT, typename PropT, typename MemberT>
+        status validate_with_master_sample(AdapterT&& adpt, MemberT&& member, PropT&& prop, OpT&& op, T2&& b)
+        {
+            if (!_budget->consume_operation())
+            {
+                return status::code::exhausted;
+            }
+            return BaseTraitsT::validate_with_master_sample(std::forward<AdapterT>(adpt),std::forward<MemberT>(member),std::forward<PropT>(prop),std::forward<OpT>(op),std::forward<T2>(b));
+        }
+
+        template <typename AdapterT, typename ...Args>
+        status validate_and(AdapterT&& adpt, Args&&... args)
+        {
+            return aggregate([&](){return BaseTraitsT::validate_and(std::forward<AdapterT>(adpt),std::forward<Args>(args)...);});
+        }
+
+        template <typename AdapterT, typename ...Args>
+        status validate_or(AdapterT&& adpt, Args&&... args)
+        {
+            return aggregate([&](){return BaseTraitsT::validate_or(std::forward<AdapterT>(adpt),std::forward<Args>(args)...);});
+        }
+
+        template <typename AdapterT, typename ...Args>
+        status validate_not(AdapterT&& adpt, Args&&... args)
+        {
+            return aggregate([&](){return BaseTraitsT::validate_not(std::forward<AdapterT>(adpt),std::forward<Args>(args)...);});
+        }
+
+        /**
+         * @brief Get validation budget.
+         * @return Validation budget.
+         */
+        validation_budget& budget() const noexcept
+        {
+            return *_budget;
+        }
+
+    private:
+
+        template <typename HandlerT>
+        status aggregate(const HandlerT& handler)
+        {
+            if (_budget->exhausted())
+            {
+                return status::code::exhausted;
+            }
+            auto ret=handler();
+            if (_budget->exhausted())
+            {
+                // NOT must not turn exhaustion into success
+                return status::code::exhausted;
+            }
+            return ret;
+        }
+
+        validation_budget* _budget;
+};
+
+//-------------------------------------------------------------
+
+/**
+ * @brief Adapter that limits validation with a budget.
+ */
+template <typename BaseTraitsT>
+using budget_adapter=adapter<budget_adapter_traits<BaseTraitsT>>;
+
+/**
+ * @brief Make budget adapter based on default adapter.
+ * @param budget Validation budget.
+ * @param obj Object to validate.
+ * @return Budget adapter.
+ */
+template <typename ObjT>
+auto make_budget_adapter(validation_budget& budget, ObjT&& obj)
+{
+    return budget_adapter<default_adapter_traits<ObjT>>(budget,std::forward<ObjT>(obj));
+}
+
+/**
+ * @brief Make budget adapter based on reporting adapter.
+ * @param budget Validation budget.
+ * @param obj Object to validate.
+ * @param dst Destination object where to put validation report.
+ * @return Budget adapter.
+ *
+ * Note that report is incomplete if the budget is exhausted, use validate_with_budget() to get a report describing exhaustion.
+ */
+template <typename ObjT, typename DstT>
+auto make_budget_adapter(validation_budget& budget, ObjT&& obj, DstT& dst)
+{
+    using reporter_type=decltype(make_reporter(dst));
+    return budget_adapter<reporting_adapter_traits<ObjT,reporter_type>>(budget,std::forward<ObjT>(obj),make_reporter(dst));
+}
+
+//-------------------------------------------------------------
+
+/**
+ * @brief Implementer of validate_with_budget().
+ */
+struct validate_with_budget_t
+{
+    /**
+     * @brief Validate object with budget.
+     * @param obj Object to validate.
+     * @param validator Validator.
+     * @param budget Validation budget.
+     * @return Validation status, status::code::exhausted if the budget was exhausted.
+     */
+    template <typename ObjectT, typename ValidatorT>
+    status operator() (
+            ObjectT&& obj,
+            ValidatorT&& validator,
+            validation_budget& budget
+        ) const
+    {
+        auto ret=validator.apply(make_budget_adapter(budget,std::forward<ObjectT>(obj)));
+        if (budget.exhausted())
+        {
+            return status::code::exhausted;
+        }
+        return ret;
+    }
+
+    /**
+     * @brief Validate object with budget and put validation result with error description to the last argument.
+     * @param obj Object to validate.
+     * @param validator Validator.
+     * @param budget Validation budget.
+     * @param err Validation result.
+     *
+     * If the budget is exhausted then the error has status::code::exhausted and its description tells the reason of exhaustion.
+     */
+    template <typename ObjectT, typename ValidatorT>
+    void operator() (
+            ObjectT&& obj,
+            ValidatorT&& validator,
+            validation_budget& budget,
+            error_report& err
+        ) const
+    {
+        std::string report;
+        auto ret=validator.apply(make_budget_adapter(budget,std::forward<ObjectT>(obj),report));
+        if (budget.exhausted())
+        {
+            err=error_report(status::code::exhausted,budget.description());
+            return;
+        }
+        err=error_report(ret,std::move(report));
+    }
+};
+/**
+ * @brief Validate object limiting validation with a budget.
+ */
+constexpr validate_with_budget_t validate_with_budget{};
+
+//-------------------------------------------------------------
+
+HATN_VALIDATOR_NAMESPACE_END
+
+#endif // HATN_VALIDATOR_BUDGET_ADAPTER_HPP
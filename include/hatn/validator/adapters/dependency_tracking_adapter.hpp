@@ -0,0 +1,257 @@
+/**
+@copyright Evgeny Sidorov 2020
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+*/
+
+/****************************************************************************/
+
+/** @file validator/adapters/dependency_tracking_adapter.hpp
+*
+*  Defines adapter that records members read by validator.
+*
+*/
+
+/****************************************************************************/
+
+#ifndef HATN_VALIDATOR_DEPENDENCY_TRACKING_ADAPTER_HPP
+#define HATN_VALIDATOR_DEPENDENCY_TRACKING_ADAPTER_HPP
+
+#include <string>
+#include <vector>
+#include <algorithm>
+
+#include <hatn/validator/config.hpp>
+#include <hatn/validator/status.hpp>
+#include <hatn/validator/filter_path.hpp>
+#include <hatn/validator/changed_paths.hpp>
+#include <hatn/validator/adapters/default_adapter.hpp>
+#include <hatn/validator/adapters/reporting_adapter.hpp>
+
+HATN_VALIDATOR_NAMESPACE_BEGIN
+
+//-------------------------------------------------------------
+
+/**
+ * @brief Paths of members that validation depends on.
+ */
+class member_dependencies
+{
+    public:
+
+        /**
+         * @brief Add member whose value was read during validation.
+         * @param path Member's path.
+         */
+        template <typename PathT>
+        void add_read(const PathT& path)
+        {
+            _reads.push_back(dependency_path(path));
+        }
+
+        /**
+         * @brief Add the whole object as a dependency.
+         */
+        void add_object()
+        {
+            _reads.emplace_back();
+        }
+
+        /**
+         * @brief Add path that was visited while looking for members to validate.
+         * @param path Member's path.
+         */
+        template <typename PathT>
+        void add_visited(const PathT& path)
+        {
+            _visited.push_back(dependency_path(path));
+        }
+
+        /**
+         * @brief Get paths validation depends on.
+         * @return Sorted list of unique paths.
+         *
+         * A visited path is kept only if nothing was read under that path, e.g. when the member does not exist
+         * or when it is an empty container under element aggregation.
+         */
+        std::vector<std::string> paths() const
+        {
+            std::vector<std::string> result=_reads;
+            for (auto&& visited : _visited)
+            {
+                auto below=[&visited](const std::string& path)
+                {
+                    return path.size()>visited.size() && is_same_or_parent_path(visited,path);
+                };
+                if (std::none_of(_reads.begin(),_reads.end(),below)
+                    &&
+                    std::none_of(_visited.begin(),_visited.end(),below)
+                   )
+                {
+                    result.push_back(visited);
+                }
+            }
+            std::sort(result.begin(),result.end());
+            result.erase(std::unique(result.begin(),result.end()),result.end());
+            return result;
+        }
+
+        /**
+         * @brief Forget all dependencies.
+         */
+        void clear() noexcept
+        {
+            _reads.clear();
+            _visited.clear();
+        }
+
+    private:
+
+        std::vector<std::string> _reads;
+        std::vector<std::string> _visited;
+};
+
+//-------------------------------------------------------------
+
+/**
+ * @brief Adapter traits for dependency tracking adapter.
+ *
+ * This adapter traits inherits original adapter traits recording paths of members
+ * that are used by validator. Validation itself is delegated to original adapter traits.
+ *
+ * Dependencies are recorded only for the members that are actually read, e.g. if validation of AND aggregation
+ * stops at the first failed operand then the rest operands are not recorded.
+ * That is enough for revalidation because the result can change only if some of the read members change.
+ *
+ * @note Sample objects of master_sample are not recorded, only members of the validated object are.
+ */
+template <typename BaseTraitsT>
+class dependency_tracking_traits : public BaseTraitsT,
+                                   public filter_path_tag
+{
+    public:
+
+        /**
+         * @brief Constructor.
+         * @param dependencies Destination where to record dependencies.
+         * @param args Arguments to forward to constructor of original adapter traits.
+         */
+        template <typename ...Args>
+        dependency_tracking_traits(
+                member_dependencies& dependencies,
+                Args&&... args
+            )
+            : BaseTraitsT(std::forward<Args>(args)...),
+              _dependencies(&dependencies)
+        {}
+
+        /**
+         * @brief Record visited member's path.
+         * @param path Member's path.
+         * @return Always false, members are never filtered off.
+         */
+        template <typename PathT>
+        bool filter(const PathT& path) const
+        {
+            _dependencies->add_visited(path);
+            return false;
+        }
+
+        template <typename AdapterT, typename T2, typename OpT>
+        status validate_operator(AdapterT&& adpt, OpT&& op, T2&& b)
+        {
+            _dependencies->add_object();
+            return BaseTraitsT::validate_operator(std::forward<AdapterT>(adpt),std::forward<OpT>(op),std::forward<T2>(b));
+        }
+
+        template <typename AdapterT, typename T2, typename OpT, typename PropT>
+        status validate_property(AdapterT&& adpt, PropT&& prop, OpT&& op, T2&& b)
+        {
+            _dependencies->add_object();
+            return BaseTraitsT::validate_property(std::forward<AdapterT>(adpt),std::forward<PropT>(prop),std::forward<OpT>(op),std::forward<T2>(b));
+        }
+
+        template <typename AdapterT, typename T2, typename OpT, typename MemberT, typename ...Args>
+        status validate_exists(AdapterT&& adpt, MemberT&& member, OpT&& op, T2&& b, Args&&... args)
+        {
+            _dependencies->add_read(member.path());
+            return BaseTraitsT::validate_exists(std::forward<AdapterT>(adpt),std::forward<MemberT>(member),std::forward<OpT>(op),std::forward<T2>(b),std::forward<Args>(args)...);
+        }
+
+        template <typename AdapterT, typename T2, typename OpT, typename PropT, typename MemberT>
+        status validate(AdapterT&& adpt, MemberT&& member, PropT&& prop, OpT&& op, T2&& b)
+        {
+            _dependencies->add_read(member.path());
+            return BaseTraitsT::validate(std::forward<AdapterT>(adpt),std::forward<MemberT>(member),std::forward<PropT>(prop),std::forward<OpT>(op),std::forward<T2>(b));
+        }
+
+        template <typename AdapterT, typename T2, typename OpT, typename PropT, typename MemberT>
+        status validate_with_other_member(AdapterT&& adpt, MemberT&& member, PropT&& prop, OpT&& op, T2&& b)
+        {
+            _dependencies->add_read(member.path());
+            _dependencies->add_read(b.path());
+            return BaseTraitsT::validate_with_other_member(std::forward<AdapterT>(adpt),std::forward<MemberT>(member),std::forward<PropT>(prop),std::forward<OpT>(op),std::forward<T2>(b));
+        }
+
+        template <typename AdapterT, typename T2, typename OpT, typename PropT, typename MemberT>
+        status validate_with_master_sample(AdapterT&& adpt, MemberT&& member, PropT&& prop, OpT&& op, T2&& b)
+        {
+            _dependencies->add_read(member.path());
+            return BaseTraitsT::validate_with_master_sample(std::forward<AdapterT>(adpt),std::forward<MemberT>(member),std::forward<PropT>(prop),std::forward<OpT>(op),std::forward<T2>(b));
+        }
+
+        /**
+         * @brief Get recorded dependencies.
+         * @return Dependencies.
+         */
+        member_dependencies& dependencies() const noexcept
+        {
+            return *_dependencies;
+        }
+
+    private:
+
+        member_dependencies* _dependencies;
+};
+
+//-------------------------------------------------------------
+
+/**
+ * @brief Adapter that records dependencies of validator.
+ */
+template <typename BaseTraitsT>
+using dependency_tracking_adapter=adapter<dependency_tracking_traits<BaseTraitsT>>;
+
+/**
+ * @brief Make dependency tracking adapter based on default adapter.
+ * @param dependencies Destination where to record dependencies.
+ * @param obj Object to validate.
+ * @return Dependency tracking adapter.
+ */
+template <typename ObjT>
+auto make_dependency_tracking_adapter(member_dependencies& dependencies, ObjT&& obj)
+{
+    return dependency_tracking_adapter<default_adapter_traits<ObjT>>(dependencies,std::forward<ObjT>(obj));
+}
+
+/**
+ * @brief Make dependency tracking adapter based on reporting adapter.
+ * @param dependencies Destination where to record dependencies.
+ * @param obj Object to validate.
+ * @param dst Destination object where to put validation report.
+ * @return Dependency tracking adapter.
+ */
+template <typename ObjT, typename DstT>
+auto make_dependency_tracking_adapter(member_dependencies& dependencies, ObjT&& obj, DstT& dst)
+{
+    using reporter_type=decltype(make_reporter(dst));
+    return dependency_tracking_adapter<reporting_adapter_traits<ObjT,reporter_type>>(dependencies,std::forward<ObjT>(obj),make_reporter(dst));
+}
+
+//-------------------------------------------------------------
+
+HATN_VALIDATOR_NAMESPACE_END
+
+#endif // HATN_VALIDATOR_DEPENDENCY_TRACKING_ADAPTER_HPP
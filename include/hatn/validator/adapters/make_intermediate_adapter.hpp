@@ -50,13 +50,20 @@ struct make_intermediate_adapter_impl
             )(std::forward<decltype(current_traits)>(current_traits));
 
             auto&& obj=embedded_object_member(adapter,path);
+
+            // members returned by value, e.g. views, are kept by value
+            using obj_type=std::conditional_t<
+                                std::is_rvalue_reference<decltype(obj)>::value,
+                                std::decay_t<decltype(obj)>,
+                                decltype(obj)
+                            >;
             return intermediate_adapter_traits<
                         std::decay_t<decltype(traits)>,
-                        decltype(obj),
+                        obj_type,
                         decltype(path_prefix_length)
                     >{
                         traits,
-                        obj,
+                        static_cast<obj_type&&>(obj),
                         path_prefix_length
                      };
         };
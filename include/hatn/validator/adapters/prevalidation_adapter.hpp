@@ -36,12 +36,14 @@ HATN_VALIDATOR_NAMESPACE_BEGIN
 
 /**
  * @brief Traits of prevalidation adapter.
+ *
+ * ImplT is an implementation of prevalidation, it can be derived from prevalidation_adapter_impl<MemberT> to validate some rules differently.
  */
-template <typename MemberT, typename T, typename ReporterT, typename WrappedT>
+template <typename MemberT, typename T, typename ReporterT, typename WrappedT, typename ImplT=prevalidation_adapter_impl<MemberT>>
 class prevalidation_adapter_traits : public adapter_traits,
                                      public object_wrapper<WrappedT>,
-                                     public reporting_adapter_impl<ReporterT,prevalidation_adapter_impl<MemberT>>,
-                                     public with_check_member_exists<prevalidation_adapter_traits<MemberT,T,ReporterT,WrappedT>>
+                                     public reporting_adapter_impl<ReporterT,ImplT>,
+                                     public with_check_member_exists<prevalidation_adapter_traits<MemberT,T,ReporterT,WrappedT,ImplT>>
 {
     public:
 
@@ -61,11 +63,11 @@ class prevalidation_adapter_traits : public adapter_traits,
                     T&& val,
                     ReporterT&& reporter
                 ) : object_wrapper<WrappedT>(std::forward<T>(val)),
-                    reporting_adapter_impl<ReporterT,prevalidation_adapter_impl<MemberT>>(
+                    reporting_adapter_impl<ReporterT,ImplT>(
                         std::forward<ReporterT>(reporter),
                         std::forward<MemberT>(member)
                     ),
-                    with_check_member_exists<prevalidation_adapter_traits<MemberT,T,ReporterT,WrappedT>>(*this)
+                    with_check_member_exists<prevalidation_adapter_traits<MemberT,T,ReporterT,WrappedT,ImplT>>(*this)
         {
             this->set_check_member_exists_before_validation(true);
         }
@@ -73,7 +75,7 @@ class prevalidation_adapter_traits : public adapter_traits,
         template <typename PredicateT, typename AdapterT, typename OpsT, typename MemberT1>
         static status validate_member_aggregation(const PredicateT& pred, AdapterT&& adapter, MemberT1&& member, OpsT&& ops)
         {
-            return prevalidation_adapter_impl<MemberT>::validate_member_aggregation(
+            return ImplT::validate_member_aggregation(
                             pred,
                             std::forward<AdapterT>(adapter),
                             std::forward<MemberT1>(member),
@@ -85,14 +87,14 @@ class prevalidation_adapter_traits : public adapter_traits,
 /**
  * @brief Prevalidation adapter to validate single member before update.
  */
-template <typename MemberT, typename T, typename ReporterT, typename WrappedT=T>
-class prevalidation_adapter : public adapter<prevalidation_adapter_traits<MemberT,T,ReporterT,WrappedT>>
+template <typename MemberT, typename T, typename ReporterT, typename WrappedT=T, typename ImplT=prevalidation_adapter_impl<MemberT>>
+class prevalidation_adapter : public adapter<prevalidation_adapter_traits<MemberT,T,ReporterT,WrappedT,ImplT>>
 {
     public:
 
         using reporter_type=ReporterT;
 
-        using adapter<prevalidation_adapter_traits<MemberT,T,ReporterT,WrappedT>>::adapter;
+        using adapter<prevalidation_adapter_traits<MemberT,T,ReporterT,WrappedT,ImplT>>::adapter;
 };
 
 
@@ -44,6 +44,16 @@ struct aggregate_report
     template <typename AdapterT1>
     static void close(AdapterT1&&, status)
     {}
+
+    template <typename AdapterT1>
+    static void element(AdapterT1&&, size_t)
+    {}
+
+    template <typename AdapterT1>
+    static bool element_failed(AdapterT1&&)
+    {
+        return false;
+    }
 };
 
 template <typename AdapterT>
@@ -74,6 +84,18 @@ struct aggregate_report<AdapterT,
     {
         traits_of(adapter).reporter().aggregate_close(ret);
     }
+
+    template <typename AdapterT1>
+    static void element(AdapterT1&& adapter, size_t index)
+    {
+        traits_of(adapter).reporter().aggregate_element(index);
+    }
+
+    template <typename AdapterT1>
+    static bool element_failed(AdapterT1&& adapter)
+    {
+        return traits_of(adapter).reporter().aggregate_element_failed();
+    }
 };
 
 //-------------------------------------------------------------
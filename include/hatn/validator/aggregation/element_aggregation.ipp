@@ -35,6 +35,7 @@ Distributed under the Boost Software License, Version 1.0.
 #include <hatn/validator/utils/foreach_if.hpp>
 #include <hatn/validator/aggregation/wrap_heterogeneous_index.hpp>
 #include <hatn/validator/compact_variadic_property.hpp>
+#include <hatn/validator/validation_budget.hpp>
 
 HATN_VALIDATOR_NAMESPACE_BEGIN
 
@@ -69,17 +70,31 @@ status element_aggregation::invoke(PredicateT&& pred, EmptyFnT&& empt, Aggregati
 
                     aggregate_report<AdapterT>::open(_(adapter),_(aggr),_(parent_path));
                     bool empty=true;
-                    for (auto it=_(parent_element).begin();it!=_(parent_element).end();++it)
+                    status failed;
+                    size_t index=0;
+                    for (auto it=_(parent_element).begin();it!=_(parent_element).end();++it,++index)
                     {
-                        status ret=_(handler)(tmp_adapter,hana::append(_(parent_path),wrap_it(it,_(aggr),el_aggregation.modifier)),_(used_path_size));
-                        if (!pred(ret))
+                        if (!consume_budget<AdapterT>::element(_(adapter)))
                         {
+                            status ret{status::code::exhausted};
                             aggregate_report<AdapterT>::close(_(adapter),ret);
                             return ret;
                         }
+                        aggregate_report<AdapterT>::element(_(adapter),index);
+                        status ret=_(handler)(tmp_adapter,hana::append(_(parent_path),wrap_it(it,_(aggr),el_aggregation.modifier)),_(used_path_size));
+                        if (!pred(ret))
+                        {
+                            // reporter can request to go on for summarizing failures of the rest elements
+                            if (!aggregate_report<AdapterT>::element_failed(_(adapter)))
+                            {
+                                aggregate_report<AdapterT>::close(_(adapter),ret);
+                                return ret;
+                            }
+                            failed=ret;
+                        }
                         empty=false;
                     }
-                    auto ret=empt(empty);
+                    auto ret=failed.fail()?failed:empt(empty);
                     aggregate_report<AdapterT>::close(_(adapter),ret);
                     return ret;
                 },
@@ -145,20 +160,33 @@ status element_aggregation::invoke_variadic(PredicateT&& pred, EmptyFnT&& empt,
 
             aggregate_report<AdapterT>::open(_(adapter),_(aggr),_(parent_compacted_path));
             bool empty=true;
+            status failed;
+            size_t index=0;
             for (auto it=aggregation_varg.begin(parent);
                  aggregation_varg.while_cond(parent,it);
-                 aggregation_varg.next(parent,it)
+                 aggregation_varg.next(parent,it),++index
                 )
             {
-                status ret=_(handler)(tmp_adapter,hana::append(upper_path,varg(wrap_index(it,_(aggr)))),_(used_path_size));
-                if (!pred(ret))
+                if (!consume_budget<AdapterT>::element(_(adapter)))
                 {
+                    status ret{status::code::exhausted};
                     aggregate_report<AdapterT>::close(_(adapter),ret);
                     return ret;
                 }
+                aggregate_report<AdapterT>::element(_(adapter),index);
+                status ret=_(handler)(tmp_adapter,hana::append(upper_path,varg(wrap_index(it,_(aggr)))),_(used_path_size));
+                if (!pred(ret))
+                {
+                    if (!aggregate_report<AdapterT>::element_failed(_(adapter)))
+                    {
+                        aggregate_report<AdapterT>::close(_(adapter),ret);
+                        return ret;
+                    }
+                    failed=ret;
+                }
                 empty=false;
             }
-            auto result=empt(empty);
+            auto result=failed.fail()?failed:empt(empty);
             aggregate_report<AdapterT>::close(_(adapter),result);
             return result;
         },
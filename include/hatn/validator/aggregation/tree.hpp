@@ -26,6 +26,7 @@ Distributed under the Boost Software License, Version 1.0.
 #include <hatn/validator/adapters/make_intermediate_adapter.hpp>
 #include <hatn/validator/aggregation/aggregation.ipp>
 #include <hatn/validator/reporting/backend_formatter.hpp>
+#include <hatn/validator/validation_budget.hpp>
 
 HATN_VALIDATOR_NAMESPACE_BEGIN
 
@@ -157,6 +158,11 @@ status each_tree_node(const TreeKeyT& tree_key, AdapterT& tmp_adapter, const Pre
          aggregation_varg.next(node,it)
         )
     {
+        if (!consume_budget<AdapterT>::element(tmp_adapter))
+        {
+            return status::code::exhausted;
+        }
+
         // handle content of current child node itself
         auto&& child_node=get_member(node,hana::make_tuple(tree_key.property,varg(it)));
         auto next_adapter=clone_intermediate_adapter(tmp_adapter,child_node);
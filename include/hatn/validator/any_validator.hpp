@@ -0,0 +1,450 @@
+/**
+@copyright Evgeny Sidorov 2020
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+*/
+
+/****************************************************************************/
+
+/** @file validator/any_validator.hpp
+*
+*  Defines "any_validator" that is a type-erased handle of validator of objects of certain type.
+*
+*/
+
+/****************************************************************************/
+
+#ifndef HATN_VALIDATOR_ANY_VALIDATOR_HPP
+#define HATN_VALIDATOR_ANY_VALIDATOR_HPP
+
+#include <cstddef>
+#include <string>
+#include <new>
+#include <utility>
+#include <type_traits>
+
+#include <hatn/validator/config.hpp>
+#include <hatn/validator/status.hpp>
+#include <hatn/validator/error.hpp>
+#include <hatn/validator/adapters/reporting_adapter.hpp>
+
+HATN_VALIDATOR_NAMESPACE_BEGIN
+
+//-------------------------------------------------------------
+
+/**
+ * @brief Default size of inline buffer of any_validator.
+ */
+constexpr const size_t any_validator_default_buffer_size=128;
+
+namespace detail
+{
+
+/**
+ * @brief Type of reporting adapter with default reporter writing to std::string.
+ */
+template <typename T>
+using any_validator_reporting_adapter_t=decltype(make_reporting_adapter(std::declval<T>(),std::declval<std::string&>()));
+
+/**
+ * @brief Table of functions implementing any_validator for concrete type of validator.
+ */
+template <typename ObjectT>
+struct any_validator_vtable
+{
+    using reporting_adapter_type=any_validator_reporting_adapter_t<const ObjectT&>;
+    using mutable_reporting_adapter_type=any_validator_reporting_adapter_t<ObjectT&>;
+
+    status (*apply)(const void* storage, const ObjectT& obj);
+    status (*apply_report)(const void* storage, const ObjectT& obj, std::string& report);
+    status (*apply_adapter)(const void* storage, reporting_adapter_type& adapter);
+    status (*apply_mutable_adapter)(const void* storage, mutable_reporting_adapter_type& adapter);
+    void (*copy)(const void* storage, void* dst);
+    void (*move)(void* storage, void* dst) noexcept;
+    void (*destroy)(void* storage) noexcept;
+};
+
+/**
+ * @brief Implementation of any_validator for validator of type ValidatorT.
+ *
+ * If InlineT is true_ then validator is constructed in the buffer of any_validator,
+ * otherwise the buffer holds a pointer to validator allocated on heap.
+ */
+template <typename ObjectT, typename ValidatorT, typename InlineT>
+struct any_validator_impl
+{
+    using vtable_type=any_validator_vtable<ObjectT>;
+
+    static const ValidatorT& get(const void* storage, hana::true_) noexcept
+    {
+        return *static_cast<const ValidatorT*>(storage);
+    }
+
+    static const ValidatorT& get(const void* storage, hana::false_) noexcept
+    {
+        return **static_cast<ValidatorT* const*>(storage);
+    }
+
+    static const ValidatorT& get(const void* storage) noexcept
+    {
+        return get(storage,InlineT{});
+    }
+
+    template <typename T>
+    static void construct(void* dst, T&& v, hana::true_)
+    {
+        new (dst) ValidatorT(std::forward<T>(v));
+    }
+
+    template <typename T>
+    static void construct(void* dst, T&& v, hana::false_)
+    {
+        *static_cast<ValidatorT**>(dst)=new ValidatorT(std::forward<T>(v));
+    }
+
+    template <typename T>
+    static void construct(void* dst, T&& v)
+    {
+        construct(dst,std::forward<T>(v),InlineT{});
+    }
+
+    static status apply(const void* storage, const ObjectT& obj)
+    {
+        return get(storage).apply(obj);
+    }
+
+    static status apply_report(const void* storage, const ObjectT& obj, std::string& report)
+    {
+        return get(storage).apply(make_reporting_adapter(obj,report));
+    }
+
+    static status apply_adapter(const void* storage, typename vtable_type::reporting_adapter_type& adapter)
+    {
+        return get(storage).apply(adapter);
+    }
+
+    static status apply_mutable_adapter(const void* storage, typename vtable_type::mutable_reporting_adapter_type& adapter)
+    {
+        return get(storage).apply(adapter);
+    }
+
+    static void copy(const void* storage, void* dst)
+    {
+        construct(dst,get(storage));
+    }
+
+    static void move(void* storage, void* dst, hana::true_) noexcept
+    {
+        auto v=static_cast<ValidatorT*>(storage);
+        new (dst) ValidatorT(std::move(*v));
+        v->~ValidatorT();
+    }
+
+    static void move(void* storage, void* dst, hana::false_) noexcept
+    {
+        *static_cast<ValidatorT**>(dst)=*static_cast<ValidatorT**>(storage);
+    }
+
+    static void move(void* storage, void* dst) noexcept
+    {
+        move(storage,dst,InlineT{});
+    }
+
+    static void destroy(void* storage, hana::true_) noexcept
+    {
+        static_cast<ValidatorT*>(storage)->~ValidatorT();
+    }
+
+    static void destroy(void* storage, hana::false_) noexcept
+    {
+        delete *static_cast<ValidatorT**>(storage);
+    }
+
+    static void destroy(void* storage) noexcept
+    {
+        destroy(storage,InlineT{});
+    }
+
+    constexpr static const vtable_type vtable{
+        &apply,
+        &apply_report,
+        &apply_adapter,
+        &apply_mutable_adapter,
+        &copy,
+        &move,
+        &destroy
+    };
+};
+#if __cplusplus < 201703L
+template <typename ObjectT, typename ValidatorT, typename InlineT>
+constexpr const typename any_validator_impl<ObjectT,ValidatorT,InlineT>::vtable_type any_validator_impl<ObjectT,ValidatorT,InlineT>::vtable;
+#endif
+
+}
+
+//-------------------------------------------------------------
+
+/**
+ * @brief Type-erased validator of objects of ObjectT type.
+ *
+ * any_validator can hold any validator applicable to objects of ObjectT type, so that validators of different
+ * concrete types can be kept in the same container. A validator is constructed in the inline buffer of BufferSize bytes
+ * if it fits the buffer and can be moved without exceptions, otherwise it is allocated on heap.
+ * Each validation costs a single indirect call: both default and reporting adapters are constructed by the erased
+ * implementation, thus there are no reference counters and no extra virtual calls.
+ *
+ * any_validator can be used with validate() as ordinary validator when the object is passed as lvalue.
+ *
+ * @code
+ * std::vector<any_validator<std::map<std::string,int>>> validators;
+ * validators.emplace_back(validator(_["field1"](gte,1)));
+ * validators.emplace_back(validator(_["field2"](exists,true)));
+ * @endcode
+ */
+template <typename ObjectT, size_t BufferSize=any_validator_default_buffer_size>
+class any_validator
+{
+    public:
+
+        using object_type=ObjectT;
+
+        constexpr static const size_t buffer_size=BufferSize<sizeof(void*)?sizeof(void*):BufferSize;
+
+        /**
+         * @brief Default constructor of empty any_validator.
+         */
+        any_validator() noexcept : _vtable(nullptr)
+        {}
+
+        /**
+         * @brief Constructor from validator.
+         * @param v Validator.
+         */
+        template <typename ValidatorT,
+                  typename =std::enable_if_t<!std::is_same<std::decay_t<ValidatorT>,any_validator>::value>>
+        any_validator(ValidatorT&& v) : _vtable(nullptr)
+        {
+            using validator_type=std::decay_t<ValidatorT>;
+            static_assert(std::is_copy_constructible<validator_type>::value,"Validator must be copy constructible");
+
+            using inline_type=hana::bool_<fits_buffer<validator_type>()>;
+            using impl_type=detail::any_validator_impl<ObjectT,validator_type,inline_type>;
+            impl_type::construct(storage(),std::forward<ValidatorT>(v));
+            _vtable=&impl_type::vtable;
+        }
+
+        /**
+         * @brief Destructor.
+         */
+        ~any_validator()
+        {
+            reset();
+        }
+
+        /**
+         * @brief Copy constructor.
+         * @param other Other any_validator.
+         */
+        any_validator(const any_validator& other) : _vtable(nullptr)
+        {
+            if (other._vtable!=nullptr)
+            {
+                other._vtable->copy(other.storage(),storage());
+                _vtable=other._vtable;
+            }
+        }
+
+        /**
+         * @brief Move constructor.
+         * @param other Other any_validator.
+         */
+        any_validator(any_validator&& other) noexcept : _vtable(other._vtable)
+        {
+            if (_vtable!=nullptr)
+            {
+                _vtable->move(other.storage(),storage());
+                other._vtable=nullptr;
+            }
+        }
+
+        /**
+         * @brief Copy assignment.
+         * @param other Other any_validator.
+         * @return Reference to this.
+         */
+        any_validator& operator= (const any_validator& other)
+        {
+            if (this!=&other)
+            {
+                any_validator tmp(other);
+                *this=std::move(tmp);
+            }
+            return *this;
+        }
+
+        /**
+         * @brief Move assignment.
+         * @param other Other any_validator.
+         * @return Reference to this.
+         */
+        any_validator& operator= (any_validator&& other) noexcept
+        {
+            if (this!=&other)
+            {
+                reset();
+                if (other._vtable!=nullptr)
+                {
+                    other._vtable->move(other.storage(),storage());
+                    _vtable=other._vtable;
+                    other._vtable=nullptr;
+                }
+            }
+            return *this;
+        }
+
+        /**
+         * @brief Destroy held validator.
+         */
+        void reset() noexcept
+        {
+            if (_vtable!=nullptr)
+            {
+                _vtable->destroy(storage());
+                _vtable=nullptr;
+            }
+        }
+
+        /**
+         * @brief Check if any_validator is empty.
+         * @return Boolean result.
+         */
+        bool empty() const noexcept
+        {
+            return _vtable==nullptr;
+        }
+
+        /**
+         * @brief Check if any_validator holds a validator.
+         */
+        explicit operator bool() const noexcept
+        {
+            return !empty();
+        }
+
+        /**
+         * @brief Check if validator of given type would be constructed in the inline buffer.
+         * @return Boolean result.
+         */
+        template <typename ValidatorT>
+        constexpr static bool fits_buffer() noexcept
+        {
+            return sizeof(ValidatorT)<=buffer_size
+                    &&
+                   alignof(std::max_align_t)%alignof(ValidatorT)==0
+                    &&
+                   std::is_nothrow_move_constructible<ValidatorT>::value;
+        }
+
+        /**
+         * @brief Validate object.
+         * @param obj Object to validate.
+         * @return Validation status.
+         *
+         * Empty any_validator fails validation.
+         */
+        status apply(const ObjectT& obj) const
+        {
+            if (_vtable==nullptr)
+            {
+                return status(status::code::fail);
+            }
+            return _vtable->apply(storage(),obj);
+        }
+
+        /**
+         * @brief Validate object and put text report to the destination string if validation fails.
+         * @param obj Object to validate.
+         * @param report Destination string.
+         * @return Validation status.
+         */
+        status apply(const ObjectT& obj, std::string& report) const
+        {
+            if (_vtable==nullptr)
+            {
+                return status(status::code::fail);
+            }
+            return _vtable->apply_report(storage(),obj,report);
+        }
+
+        /**
+         * @brief Validate object wrapped into reporting adapter with default reporter.
+         * @param adapter Reporting adapter, e.g. as constructed by validate().
+         * @return Validation status.
+         */
+        template <typename AdapterT>
+        auto apply(AdapterT&& adapter) const
+            -> std::enable_if_t<
+                    std::is_same<std::decay_t<AdapterT>,typename detail::any_validator_vtable<ObjectT>::reporting_adapter_type>::value,
+                    status
+               >
+        {
+            if (_vtable==nullptr)
+            {
+                return status(status::code::fail);
+            }
+            return _vtable->apply_adapter(storage(),adapter);
+        }
+
+        /**
+         * @brief Validate non-constant object wrapped into reporting adapter with default reporter.
+         * @param adapter Reporting adapter, e.g. as constructed by validate().
+         * @return Validation status.
+         */
+        template <typename AdapterT>
+        auto apply(AdapterT&& adapter) const
+            -> std::enable_if_t<
+                    std::is_same<std::decay_t<AdapterT>,typename detail::any_validator_vtable<ObjectT>::mutable_reporting_adapter_type>::value,
+                    status
+               >
+        {
+            if (_vtable==nullptr)
+            {
+                return status(status::code::fail);
+            }
+            return _vtable->apply_mutable_adapter(storage(),adapter);
+        }
+
+    private:
+
+        void* storage() noexcept
+        {
+            return static_cast<void*>(&_buffer);
+        }
+
+        const void* storage() const noexcept
+        {
+            return static_cast<const void*>(&_buffer);
+        }
+
+        const detail::any_validator_vtable<ObjectT>* _vtable;
+        typename std::aligned_storage<buffer_size,alignof(std::max_align_t)>::type _buffer;
+};
+
+/**
+ * @brief Make type-erased validator.
+ * @param v Validator.
+ * @return any_validator holding the validator.
+ */
+template <typename ObjectT, size_t BufferSize=any_validator_default_buffer_size, typename ValidatorT>
+any_validator<ObjectT,BufferSize> make_any_validator(ValidatorT&& v)
+{
+    return any_validator<ObjectT,BufferSize>(std::forward<ValidatorT>(v));
+}
+
+//-------------------------------------------------------------
+
+HATN_VALIDATOR_NAMESPACE_END
+
+#endif // HATN_VALIDATOR_ANY_VALIDATOR_HPP
@@ -0,0 +1,321 @@
+/**
+@copyright Evgeny Sidorov 2020
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+*/
+
+/****************************************************************************/
+
+/** @file validator/binary/packed_record.hpp
+*
+*  Defines view of raw byte buffer with packed record and descriptors of fields at fixed offsets.
+*
+*/
+
+/****************************************************************************/
+
+#ifndef HATN_VALIDATOR_PACKED_RECORD_HPP
+#define HATN_VALIDATOR_PACKED_RECORD_HPP
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+
+#include <boost/endian/conversion.hpp>
+
+#include <hatn/validator/config.hpp>
+#include <hatn/validator/utils/string_view.hpp>
+#include <hatn/validator/utils/adjust_storable_ignore.hpp>
+
+HATN_VALIDATOR_NAMESPACE_BEGIN
+
+//-------------------------------------------------------------
+
+/**
+ * @brief Byte order of fields in packed records.
+ */
+using byte_order=boost::endian::order;
+
+namespace detail
+{
+
+template <size_t Size>
+struct packed_uint_t
+{
+};
+template <>
+struct packed_uint_t<1>
+{
+    using type=uint8_t;
+};
+template <>
+struct packed_uint_t<2>
+{
+    using type=uint16_t;
+};
+template <>
+struct packed_uint_t<4>
+{
+    using type=uint32_t;
+};
+template <>
+struct packed_uint_t<8>
+{
+    using type=uint64_t;
+};
+
+}
+
+/**
+ * @brief Base class of descriptors of fields in packed records.
+ *
+ * Descriptor is used as a key of member, e.g. _[field](gte,10).
+ * Name of the descriptor is used as name of the member in reports.
+ */
+template <size_t Offset, size_t Size>
+class packed_field_base : public adjust_storable_ignore
+{
+    public:
+
+        constexpr static const size_t field_offset=Offset;
+        constexpr static const size_t field_size=Size;
+
+        /**
+         * @brief Constructor.
+         * @param name Human readable name of the field used in reports.
+         */
+        constexpr explicit packed_field_base(const char* name) noexcept : _name(name)
+        {}
+
+        /**
+         * @brief Get name of the field.
+         * @return Name of the field.
+         */
+        constexpr const char* name() const noexcept
+        {
+            return _name;
+        }
+
+        explicit operator std::string() const
+        {
+            return std::string(_name);
+        }
+
+        /**
+         * @brief Check if record of given size contains the field.
+         * @param record_size Size of record in bytes.
+         * @return Boolean result.
+         */
+        constexpr static bool fits(size_t record_size) noexcept
+        {
+            return Offset+Size<=record_size;
+        }
+
+    private:
+
+        const char* _name;
+};
+
+/**
+ * @brief Descriptor of arithmetic or enum field at fixed offset in packed record.
+ *
+ * The field is read from unaligned memory with memcpy() and converted from given byte order to native byte order.
+ * Boolean field is read as unsigned integer of the same size, any non-zero value is true.
+ */
+template <typename T, size_t Offset, byte_order Order=byte_order::little>
+class packed_field : public packed_field_base<Offset,sizeof(T)>
+{
+    public:
+
+        static_assert(std::is_arithmetic<T>::value || std::is_enum<T>::value,"Type of packed field must be arithmetic or enum");
+
+        using value_type=T;
+
+        using packed_field_base<Offset,sizeof(T)>::packed_field_base;
+
+        /**
+         * @brief Read value of the field.
+         * @param record Pointer to the beginning of record that must contain the field.
+         * @return Value of the field.
+         */
+        static T read(const unsigned char* record) noexcept
+        {
+            using uint_type=typename detail::packed_uint_t<sizeof(T)>::type;
+            uint_type raw;
+            std::memcpy(&raw,record+Offset,sizeof(raw));
+            raw=boost::endian::conditional_reverse<Order,byte_order::native>(raw);
+            return from_raw(raw,std::is_same<T,bool>{});
+        }
+
+        template <typename T1>
+        constexpr bool operator == (const T1&) const noexcept
+        {
+            return false;
+        }
+        template <typename T1>
+        constexpr bool operator != (const T1&) const noexcept
+        {
+            return true;
+        }
+        constexpr bool operator == (const packed_field&) const noexcept
+        {
+            return true;
+        }
+        constexpr bool operator != (const packed_field&) const noexcept
+        {
+            return false;
+        }
+
+    private:
+
+        template <typename UintT>
+        static T from_raw(UintT raw, std::false_type) noexcept
+        {
+            T val;
+            std::memcpy(&val,&raw,sizeof(val));
+            return val;
+        }
+
+        template <typename UintT>
+        static T from_raw(UintT raw, std::true_type) noexcept
+        {
+            // copying arbitrary byte to bool is undefined behaviour
+            return raw!=0;
+        }
+};
+
+/**
+ * @brief Descriptor of fixed size character array at fixed offset in packed record.
+ *
+ * The field is read as a string view of the record truncated at the first null character.
+ */
+template <size_t Offset, size_t Size>
+class packed_string : public packed_field_base<Offset,Size>
+{
+    public:
+
+        using value_type=string_view;
+
+        using packed_field_base<Offset,Size>::packed_field_base;
+
+        /**
+         * @brief Read value of the field.
+         * @param record Pointer to the beginning of record that must contain the field.
+         * @return View of the field.
+         */
+        static string_view read(const unsigned char* record) noexcept
+        {
+            auto data=reinterpret_cast<const char*>(record+Offset);
+            auto end=static_cast<const char*>(std::memchr(data,0,Size));
+            return string_view(data,end==nullptr ? Size : static_cast<size_t>(end-data));
+        }
+
+        template <typename T1>
+        constexpr bool operator == (const T1&) const noexcept
+        {
+            return false;
+        }
+        template <typename T1>
+        constexpr bool operator != (const T1&) const noexcept
+        {
+            return true;
+        }
+        constexpr bool operator == (const packed_string&) const noexcept
+        {
+            return true;
+        }
+        constexpr bool operator != (const packed_string&) const noexcept
+        {
+            return false;
+        }
+};
+
+//-------------------------------------------------------------
+
+/**
+ * @brief View of raw byte buffer with packed record.
+ *
+ * Members of the record are described with packed_field and packed_string descriptors that are used as keys of members.
+ * Fields are read straight from the buffer when they are validated, so the buffer does not have to be aligned
+ * and the record does not have to be decoded. Fields that do not fit into the buffer do not exist.
+ *
+ * The view does not own the buffer, the buffer must outlive the view.
+ */
+class packed_record
+{
+    public:
+
+        /**
+         * @brief Constructor.
+         * @param data Buffer.
+         * @param size Size of buffer.
+         */
+        packed_record(const void* data, size_t size) noexcept
+            : _data(static_cast<const unsigned char*>(data)),_size(size)
+        {}
+
+        /**
+         * @brief Get buffer.
+         * @return Pointer to buffer.
+         */
+        const unsigned char* data() const noexcept
+        {
+            return _data;
+        }
+
+        /**
+         * @brief Get size of buffer.
+         * @return Size in bytes.
+         */
+        size_t size() const noexcept
+        {
+            return _size;
+        }
+
+        /**
+         * @brief Check if record contains a field.
+         * @param field Descriptor of the field.
+         * @return True if the field fits into the buffer.
+         */
+        template <size_t Offset, size_t Size>
+        bool contains(const packed_field_base<Offset,Size>& field) const noexcept
+        {
+            return field.fits(_size);
+        }
+
+        /**
+         * @brief Read field.
+         * @param field Descriptor of the field, the field must fit into the buffer.
+         * @return Value of the field.
+         */
+        template <typename FieldT>
+        auto at(const FieldT& field) const noexcept -> decltype(field.read(std::declval<const unsigned char*>()))
+        {
+            return field.read(_data);
+        }
+
+    private:
+
+        const unsigned char* _data;
+        size_t _size;
+};
+
+/**
+ * @brief Make view of packed record.
+ * @param data Buffer.
+ * @param size Size of buffer.
+ * @return View to pass to validator.
+ */
+inline packed_record make_packed_record(const void* data, size_t size) noexcept
+{
+    return packed_record(data,size);
+}
+
+//-------------------------------------------------------------
+
+HATN_VALIDATOR_NAMESPACE_END
+
+#endif // HATN_VALIDATOR_PACKED_RECORD_HPP
@@ -0,0 +1,462 @@
+/**
+@copyright Evgeny Sidorov 2020
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+*/
+
+/****************************************************************************/
+
+/** @file validator/cached_validator.hpp
+*
+*  Defines "cached_validator" that memoizes validation results of immutable objects.
+*
+*/
+
+/****************************************************************************/
+
+#ifndef HATN_VALIDATOR_CACHED_VALIDATOR_HPP
+#define HATN_VALIDATOR_CACHED_VALIDATOR_HPP
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <atomic>
+#include <functional>
+#include <unordered_map>
+#include <algorithm>
+
+#include <hatn/validator/config.hpp>
+#include <hatn/validator/status.hpp>
+#include <hatn/validator/error.hpp>
+#include <hatn/validator/adapters/reporting_adapter.hpp>
+
+HATN_VALIDATOR_NAMESPACE_BEGIN
+
+//-------------------------------------------------------------
+
+/**
+ * @brief Key of cached validation result made of object's address and version.
+ *
+ * Use it when objects are immutable while a version is kept,
+ * e.g. a snapshot of configuration that gets a new version on each reload.
+ *
+ * An address can be reused by a new object after the old one is destroyed, thus versions must be unique
+ * across all objects validated with the same cache rather than only across modifications of one object.
+ * Otherwise a new object gets the cached result of the old object. Use next_object_version() to get such versions.
+ */
+struct object_version
+{
+    const void* address;
+    uint64_t version;
+
+    bool operator == (const object_version& other) const noexcept
+    {
+        return address==other.address && version==other.version;
+    }
+    bool operator != (const object_version& other) const noexcept
+    {
+        return !(*this==other);
+    }
+};
+
+/**
+ * @brief Get next version for object_version that is unique within the process.
+ * @return Version, it is never 0.
+ *
+ * Assign the version to an object when it is created and each time it is modified.
+ */
+inline uint64_t next_object_version() noexcept
+{
+    static std::atomic<uint64_t> counter{0};
+    return counter.fetch_add(1,std::memory_order_relaxed)+1;
+}
+
+/**
+ * @brief Make key of cached validation result for object.
+ * @param obj Object.
+ * @param version Version of the object, it must be changed each time the object is modified
+ *        and must not be used by other objects that can be placed at the same address, see next_object_version().
+ * @return Key of cached validation result.
+ */
+template <typename ObjectT>
+object_version make_object_version(const ObjectT& obj, uint64_t version) noexcept
+{
+    return object_version{static_cast<const void*>(std::addressof(obj)),version};
+}
+
+/**
+ * @brief Hash of keys of cached validation results.
+ */
+template <typename KeyT>
+struct validation_cache_hash : public std::hash<KeyT>
+{
+};
+
+/**
+ * @brief Hash of object_version.
+ */
+template <>
+struct validation_cache_hash<object_version>
+{
+    size_t operator() (const object_version& key) const noexcept
+    {
+        auto h=std::hash<const void*>{}(key.address);
+        return h ^ (std::hash<uint64_t>{}(key.version)+0x9e3779b9+(h<<6)+(h>>2));
+    }
+};
+
+/**
+ * @brief Counters of validation cache.
+ */
+struct validation_cache_stats
+{
+    size_t hits=0;
+    size_t misses=0;
+    size_t evictions=0;
+    size_t size=0;
+};
+
+//-------------------------------------------------------------
+
+/**
+ * @brief Validator with cache of validation results.
+ *
+ * Results are cached for keys supplied by the caller, e.g. for object_version or for content hashes of objects.
+ * A key must identify the content of an immutable object: if an object is modified then a new key must be used.
+ *
+ * The cache is thread-safe. It is split into shards selected by key's hash, each shard has its own mutex
+ * and a bounded number of slots. When a shard is full an entry is evicted with CLOCK algorithm:
+ * a hit marks the entry as recently used and the clock hand skips marked entries once before eviction.
+ * Validation itself is invoked without locks, thus concurrent misses of the same key can validate the object more than once.
+ *
+ * Text reports are cached only when validation is invoked with error_report. A cached status without the report
+ * is treated as a miss when the report is requested.
+ *
+ * @code
+ * auto v=make_cached_validator(validator(_["field1"](gte,1)),1024);
+ * error_report err;
+ * v.apply(make_object_version(config,config_version),config,err);
+ * @endcode
+ */
+template <typename ValidatorT, typename KeyT=object_version,
+          typename HashT=validation_cache_hash<KeyT>, typename KeyEqualT=std::equal_to<KeyT>>
+class cached_validator
+{
+    public:
+
+        constexpr static const size_t default_capacity=1024;
+        constexpr static const size_t default_shards=16;
+
+        /**
+         * @brief Constructor.
+         * @param validator Validator.
+         * @param capacity Max number of cached results.
+         * @param shards Number of shards, it is reduced to capacity if capacity is less than the number of shards.
+         */
+        explicit cached_validator(
+                ValidatorT validator,
+                size_t capacity=default_capacity,
+                size_t shards=default_shards
+            ) : _validator(std::move(validator))
+        {
+            shards=(std::max)((std::min)(shards,capacity),size_t(1));
+            _shards.reserve(shards);
+            for (size_t i=0;i<shards;i++)
+            {
+                // capacity is split between shards exactly, the first shards take the remainder
+                _shards.emplace_back(new shard_t(capacity/shards+(i<capacity%shards ? 1 : 0)));
+            }
+        }
+
+        ~cached_validator()=default;
+        cached_validator(const cached_validator&)=delete;
+        cached_validator(cached_validator&&)=default;
+        cached_validator& operator= (const cached_validator&)=delete;
+        cached_validator& operator= (cached_validator&&)=default;
+
+        /**
+         * @brief Validate object or take the result from cache.
+         * @param key Key of the object.
+         * @param obj Object to validate.
+         * @return Validation status.
+         */
+        template <typename ObjectT>
+        status apply(const KeyT& key, ObjectT&& obj) const
+        {
+            auto& shard=select_shard(key);
+            status result;
+            if (shard.find(key,result,nullptr))
+            {
+                return result;
+            }
+
+            result=_validator.apply(std::forward<ObjectT>(obj));
+            shard.insert(key,result,nullptr);
+            return result;
+        }
+
+        /**
+         * @brief Validate object or take the result from cache with validation result put in the last argument.
+         * @param key Key of the object.
+         * @param obj Object to validate.
+         * @param err Validation result with text report.
+         */
+        template <typename ObjectT>
+        void apply(const KeyT& key, ObjectT&& obj, error_report& err) const
+        {
+            auto& shard=select_shard(key);
+            status result;
+            std::string report;
+            if (!shard.find(key,result,&report))
+            {
+                result=_validator.apply(make_reporting_adapter(std::forward<ObjectT>(obj),report));
+                shard.insert(key,result,&report);
+            }
+
+            err=error_report(result,std::move(report));
+        }
+
+        /**
+         * @brief Remove cached result.
+         * @param key Key of the object.
+         */
+        void erase(const KeyT& key)
+        {
+            select_shard(key).erase(key);
+        }
+
+        /**
+         * @brief Remove all cached results.
+         *
+         * Counters are not reset.
+         */
+        void clear()
+        {
+            for (auto&& shard : _shards)
+            {
+                shard->clear();
+            }
+        }
+
+        /**
+         * @brief Get counters of the cache.
+         * @return Sums of counters of all shards.
+         */
+        validation_cache_stats stats() const
+        {
+            validation_cache_stats result;
+            for (auto&& shard : _shards)
+            {
+                std::lock_guard<std::mutex> lock(shard->mutex);
+                result.hits+=shard->stats.hits;
+                result.misses+=shard->stats.misses;
+                result.evictions+=shard->stats.evictions;
+                result.size+=shard->index.size();
+            }
+            return result;
+        }
+
+        /**
+         * @brief Reset hit, miss and eviction counters.
+         */
+        void reset_stats()
+        {
+            for (auto&& shard : _shards)
+            {
+                std::lock_guard<std::mutex> lock(shard->mutex);
+                shard->stats=validation_cache_stats();
+            }
+        }
+
+        /**
+         * @brief Get max number of cached results.
+         * @return Capacity of the cache.
+         */
+        size_t capacity() const noexcept
+        {
+            size_t result=0;
+            for (auto&& shard : _shards)
+            {
+                result+=shard->capacity;
+            }
+            return result;
+        }
+
+        /**
+         * @brief Get underlying validator.
+         * @return Validator.
+         */
+        const ValidatorT& validator() const noexcept
+        {
+            return _validator;
+        }
+
+    private:
+
+        struct entry_t
+        {
+            KeyT key;
+            status result;
+            std::string report;
+            bool has_report;
+            bool referenced;
+        };
+
+        struct shard_t
+        {
+            explicit shard_t(size_t capacity) : capacity(capacity),hand(0)
+            {
+                slots.reserve(capacity);
+            }
+
+            bool find(const KeyT& key, status& result, std::string* report)
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+
+                auto it=index.find(key);
+                if (it==index.end())
+                {
+                    ++stats.misses;
+                    return false;
+                }
+                auto& entry=slots[it->second];
+                if (report!=nullptr && !entry.has_report)
+                {
+                    ++stats.misses;
+                    return false;
+                }
+
+                ++stats.hits;
+                entry.referenced=true;
+                result=entry.result;
+                if (report!=nullptr)
+                {
+                    *report=entry.report;
+                }
+                return true;
+            }
+
+            void insert(const KeyT& key, const status& result, const std::string* report)
+            {
+                if (capacity==0)
+                {
+                    return;
+                }
+
+                std::lock_guard<std::mutex> lock(mutex);
+
+                auto it=index.find(key);
+                if (it!=index.end())
+                {
+                    // validated concurrently or the report was missing
+                    auto& entry=slots[it->second];
+                    if (report!=nullptr && !entry.has_report)
+                    {
+                        entry.result=result;
+                        entry.report=*report;
+                        entry.has_report=true;
+                    }
+                    return;
+                }
+
+                entry_t entry{key,result,report!=nullptr?*report:std::string(),report!=nullptr,false};
+                if (slots.size()<capacity)
+                {
+                    index.emplace(key,slots.size());
+                    slots.push_back(std::move(entry));
+                    return;
+                }
+
+                // skip recently used entries once
+                while (slots[hand].referenced)
+                {
+                    slots[hand].referenced=false;
+                    hand=(hand+1)%capacity;
+                }
+                index.erase(slots[hand].key);
+                ++stats.evictions;
+                slots[hand]=std::move(entry);
+                index.emplace(key,hand);
+                hand=(hand+1)%capacity;
+            }
+
+            void erase(const KeyT& key)
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+
+                auto it=index.find(key);
+                if (it==index.end())
+                {
+                    return;
+                }
+
+                // move the last slot to the freed one
+                auto pos=it->second;
+                index.erase(it);
+                auto last=slots.size()-1;
+                if (pos!=last)
+                {
+                    slots[pos]=std::move(slots[last]);
+                    index[slots[pos].key]=pos;
+                }
+                slots.pop_back();
+                if (hand>=slots.size())
+                {
+                    hand=0;
+                }
+            }
+
+            void clear()
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                index.clear();
+                slots.clear();
+                hand=0;
+            }
+
+            const size_t capacity;
+
+            std::mutex mutex;
+            std::unordered_map<KeyT,size_t,HashT,KeyEqualT> index;
+            std::vector<entry_t> slots;
+            size_t hand;
+            validation_cache_stats stats;
+        };
+
+        shard_t& select_shard(const KeyT& key) const
+        {
+            auto h=HashT{}(key);
+            h^=h>>(sizeof(size_t)*4);
+            return *_shards[h%_shards.size()];
+        }
+
+        ValidatorT _validator;
+        std::vector<std::unique_ptr<shard_t>> _shards;
+};
+
+/**
+ * @brief Create validator with cache of validation results.
+ * @param validator Validator.
+ * @param capacity Max number of cached results.
+ * @param shards Number of shards.
+ * @return Validator with cache.
+ *
+ * Type of keys can be given in the first template argument, e.g. make_cached_validator<std::string>(v) for content hashes.
+ */
+template <typename KeyT=object_version, typename ValidatorT>
+auto make_cached_validator(ValidatorT&& validator,
+                           size_t capacity=cached_validator<std::decay_t<ValidatorT>,KeyT>::default_capacity,
+                           size_t shards=cached_validator<std::decay_t<ValidatorT>,KeyT>::default_shards)
+{
+    return cached_validator<std::decay_t<ValidatorT>,KeyT>(std::forward<ValidatorT>(validator),capacity,shards);
+}
+
+//-------------------------------------------------------------
+
+HATN_VALIDATOR_NAMESPACE_END
+
+#endif // HATN_VALIDATOR_CACHED_VALIDATOR_HPP
@@ -21,6 +21,7 @@ Distributed under the Boost Software License, Version 1.0.
 
 #include <hatn/validator/config.hpp>
 #include <hatn/validator/detail/has_method.hpp>
+#include <hatn/validator/detail/transparent_lookup.hpp>
 #include <hatn/validator/property.hpp>
 #include <hatn/validator/utils/unwrap_object.hpp>
 #include <hatn/validator/utils/hana_to_std_tuple.hpp>
@@ -70,6 +71,8 @@ struct can_check_contains_t
     constexpr static const bool value =
         hana::is_a<wrap_iterator_tag,T2>
         ||
+        detail::transparent_lookup_t<T1,T2>::value
+        ||
         detail::has_find_it_c(hana::type_c<T1>, hana::type_c<T2>)
         ||
         detail::has_has_c(hana::type_c<T1>, hana::type_c<T2>)
@@ -0,0 +1,222 @@
+/**
+@copyright Evgeny Sidorov 2020
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+*/
+
+/****************************************************************************/
+
+/** @file validator/changed_paths.hpp
+*
+*  Defines "changed_paths" tracker of modified members and helpers for dependency paths.
+*
+*/
+
+/****************************************************************************/
+
+#ifndef HATN_VALIDATOR_CHANGED_PATHS_HPP
+#define HATN_VALIDATOR_CHANGED_PATHS_HPP
+
+#include <string>
+#include <vector>
+
+#include <hatn/validator/config.hpp>
+#include <hatn/validator/utils/unwrap_object.hpp>
+#include <hatn/validator/variadic_arg_tag.hpp>
+#include <hatn/validator/aggregation/wrap_heterogeneous_index.hpp>
+#include <hatn/validator/reporting/dotted_member_names.hpp>
+
+HATN_VALIDATOR_NAMESPACE_BEGIN
+
+struct wrap_iterator_tag;
+struct wrap_index_tag;
+struct element_aggregation_tag;
+struct tree_tag;
+
+//-------------------------------------------------------------
+
+/**
+ * @brief Check if key of member's path is generated by aggregation.
+ */
+template <typename KeyT, typename=hana::when<true>>
+struct is_aggregation_key : public std::false_type
+{
+};
+
+/**
+ * @brief Keys of element aggregations, trees and variadic arguments.
+ */
+template <typename KeyT>
+struct is_aggregation_key<KeyT,
+            hana::when<
+                hana::is_a<wrap_iterator_tag,KeyT>
+                ||
+                hana::is_a<wrap_index_tag,KeyT>
+                ||
+                hana::is_a<element_aggregation_tag,KeyT>
+                ||
+                hana::is_a<tree_tag,KeyT>
+                ||
+                std::is_base_of<variadic_arg_tag,KeyT>::value
+            >
+        > : public std::true_type
+{
+};
+
+/**
+ * @brief Indexes of elements of heterogeneous containers.
+ */
+template <size_t Index, typename AggregationT>
+struct is_aggregation_key<wrap_heterogeneous_index_t<Index,AggregationT>> : public std::true_type
+{
+};
+
+/**
+ * @brief Implementer of dependency_path().
+ */
+struct dependency_path_impl
+{
+    template <typename PathT>
+    std::string operator () (const PathT& path) const
+    {
+        std::string dst;
+        bool first=true;
+        bool done=false;
+        hana::for_each(path,
+            [&](const auto& key)
+            {
+                if (done)
+                {
+                    return;
+                }
+                using key_type=std::decay_t<unwrap_object_t<decltype(key)>>;
+                hana::eval_if(
+                    is_aggregation_key<key_type>{},
+                    [&](auto&&)
+                    {
+                        done=true;
+                    },
+                    [&](auto&& _)
+                    {
+                        if (!first)
+                        {
+                            dst.push_back('.');
+                        }
+                        first=false;
+                        dst.append(std::string(dotted_member_names(unwrap_object(_(key)))));
+                    }
+                );
+            }
+        );
+        return dst;
+    }
+};
+/**
+ * @brief Format member's path as dependency path.
+ * @param path Member's path.
+ * @return Dot separated keys of the path.
+ *
+ * The path is cut before the first key generated by an aggregation, e.g. ["field1"][ALL]["field1_1"] is formatted as "field1".
+ * Thus, dependency on any element of a container is a dependency on the whole container.
+ * Empty path stands for the whole object.
+ */
+constexpr dependency_path_impl dependency_path{};
+
+/**
+ * @brief Check if one dependency path is equal to other path or is a path of one of its parents.
+ * @param parent Path that must be equal to or be a parent of child path.
+ * @param child Path to check.
+ * @return Boolean result.
+ */
+inline bool is_same_or_parent_path(const std::string& parent, const std::string& child) noexcept
+{
+    if (parent.empty())
+    {
+        return true;
+    }
+    return child.size()>=parent.size()
+            &&
+           child.compare(0,parent.size(),parent)==0
+            &&
+           (child.size()==parent.size() || child[parent.size()]=='.');
+}
+
+//-------------------------------------------------------------
+
+/**
+ * @brief Tracker of paths of object's members that were changed.
+ *
+ * Tracker is filled by set_validated(), unset_validated(), resize_validated() and clear_validated()
+ * when they are called with the tracker in the last argument. Then the tracker can be used
+ * in incremental_validator to revalidate only the conditions that depend on changed members.
+ */
+class changed_paths
+{
+    public:
+
+        /**
+         * @brief Add changed member.
+         * @param member Member descriptor.
+         */
+        template <typename MemberT>
+        void add(const MemberT& member)
+        {
+            add_path(unwrap_object(member).path());
+        }
+
+        /**
+         * @brief Add path of changed member.
+         * @param path Member's path.
+         */
+        template <typename PathT>
+        void add_path(const PathT& path)
+        {
+            _paths.push_back(dependency_path(path));
+        }
+
+        /**
+         * @brief Mark the whole object as changed.
+         */
+        void add_object()
+        {
+            _paths.emplace_back();
+        }
+
+        /**
+         * @brief Get list of changed paths.
+         * @return Dot separated paths of changed members.
+         */
+        const std::vector<std::string>& paths() const noexcept
+        {
+            return _paths;
+        }
+
+        /**
+         * @brief Check if there are no changes.
+         * @return Boolean result.
+         */
+        bool empty() const noexcept
+        {
+            return _paths.empty();
+        }
+
+        /**
+         * @brief Forget all changes.
+         */
+        void clear() noexcept
+        {
+            _paths.clear();
+        }
+
+    private:
+
+        std::vector<std::string> _paths;
+};
+
+//-------------------------------------------------------------
+
+HATN_VALIDATOR_NAMESPACE_END
+
+#endif // HATN_VALIDATOR_CHANGED_PATHS_HPP
@@ -84,21 +84,26 @@ struct check_contains_t
     {
         const auto& a=unwrap_object(v);
         const auto& b=unwrap_object(k);
-        return hana::if_(detail::has_find_it(a,b),
-            [](auto&& a1, auto&& b1) { return a1.find(b1)!=a1.end(); },
-            hana::if_(detail::has_has(a,b),
-                [](auto&& a1, auto&& b1) { return a1.has(b1); },
-                hana::if_(detail::has_contains(a,b),
-                    [](auto&& a1, auto&& b1) { return a1.contains(b1); },
-                        hana::if_(detail::has_isSet(a,b),
-                            [](auto&& a1, auto&& b1) { return a1.isSet(b1); },
-                            hana::if_((detail::has_size(a) && (detail::has_at(a,b)||detail::has_brackets(a,b))),
-                                [](auto&& a1, auto&& b1) { return safe_compare_less(b1,a1.size()) && safe_compare_less(0,b1); },
-                                [](auto&&, auto&&) { return false; }
+        using a_type=std::decay_t<decltype(a)>;
+        using b_type=std::decay_t<decltype(b)>;
+        return hana::if_(hana::bool_c<detail::transparent_lookup_t<a_type,b_type>::value>,
+            [](auto&& a1, auto&& b1) { return a1.find(string_view(b1))!=a1.end(); },
+            hana::if_(detail::has_find_it(a,b),
+                [](auto&& a1, auto&& b1) { return a1.find(b1)!=a1.end(); },
+                hana::if_(detail::has_has(a,b),
+                    [](auto&& a1, auto&& b1) { return a1.has(b1); },
+                    hana::if_(detail::has_contains(a,b),
+                        [](auto&& a1, auto&& b1) { return a1.contains(b1); },
+                            hana::if_(detail::has_isSet(a,b),
+                                [](auto&& a1, auto&& b1) { return a1.isSet(b1); },
+                                hana::if_((detail::has_size(a) && (detail::has_at(a,b)||detail::has_brackets(a,b))),
+                                    [](auto&& a1, auto&& b1) { return safe_compare_less(b1,a1.size()) && safe_compare_less(0,b1); },
+                                    [](auto&&, auto&&) { return false; }
+                                )
                             )
                         )
                     )
-                )
+            )
         )(a,b);
     }
 
@@ -98,6 +98,18 @@ struct check_member_t<T1,T2,hana::when<can_check_contains_t<T1, T2>::value
     using type=std::decay_t<decltype(std::declval<T1>().find(std::declval<T2>()))>;
 };
 
+/**
+ * @brief Helper for checking if object can be queried if it contains a member and then deduce the type of that member.
+ *
+ * Case when key is looked up as string view in associative container with heterogeneous lookup.
+ */
+template <typename T1, typename T2>
+struct check_member_t<T1,T2,hana::when<can_check_contains_t<T1, T2>::value
+    && (detail::get_helpers::selector<T1, T2>::value == detail::get_helpers::getter::transparent_find)>>
+{
+    using type=typename std::decay_t<T1>::mapped_type;
+};
+
 template <typename T1, typename T2>
 struct check_member_impl : public check_member_t<decltype(as_reference(std::declval<T1>())),T2>
 {};
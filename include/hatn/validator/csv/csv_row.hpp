@@ -0,0 +1,677 @@
+/**
+@copyright Evgeny Sidorov 2020
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+*/
+
+/****************************************************************************/
+
+/** @file validator/csv/csv_row.hpp
+*
+*  Defines views of CSV rows and fields for validation of CSV/TSV data without copying.
+*
+*/
+
+/****************************************************************************/
+
+#ifndef HATN_VALIDATOR_CSV_ROW_HPP
+#define HATN_VALIDATOR_CSV_ROW_HPP
+
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include <limits>
+#include <iterator>
+#include <algorithm>
+
+#if __cplusplus >= 201703L
+#include <charconv>
+#endif
+
+#include <boost/container/small_vector.hpp>
+
+#include <hatn/validator/config.hpp>
+#include <hatn/validator/utils/string_view.hpp>
+#include <hatn/validator/utils/safe_compare.hpp>
+#include <hatn/validator/utils/value_ordering.hpp>
+#include <hatn/validator/utils/get_it.hpp>
+#include <hatn/validator/csv/csv_split.hpp>
+
+HATN_VALIDATOR_NAMESPACE_BEGIN
+
+//-------------------------------------------------------------
+
+namespace detail
+{
+
+/**
+ * @brief Parse integer from string.
+ * @param str String, the whole string must be a number.
+ * @param val Parsed value.
+ * @return True if the string is an integer in range of the type.
+ */
+template <typename T>
+bool parse_csv_integer(string_view str, T& val) noexcept
+{
+#if __cplusplus >= 201703L
+    auto end=str.data()+str.size();
+    auto ret=std::from_chars(str.data(),end,val);
+    return ret.ec==std::errc() && ret.ptr==end;
+#else
+    if (str.empty())
+    {
+        return false;
+    }
+    size_t pos=0;
+    bool negative=str[0]=='-';
+    if (negative)
+    {
+        if (std::is_unsigned<T>::value || str.size()==1)
+        {
+            return false;
+        }
+        ++pos;
+    }
+    T result=0;
+    for (;pos<str.size();pos++)
+    {
+        auto ch=str[pos];
+        if (ch<'0' || ch>'9')
+        {
+            return false;
+        }
+        auto digit=static_cast<T>(ch-'0');
+        if (negative)
+        {
+            if (result<((std::numeric_limits<T>::min)()+digit)/10)
+            {
+                return false;
+            }
+            result=result*10-digit;
+        }
+        else
+        {
+            if (result>((std::numeric_limits<T>::max)()-digit)/10)
+            {
+                return false;
+            }
+            result=result*10+digit;
+        }
+    }
+    val=result;
+    return true;
+#endif
+}
+
+/**
+ * @brief Parse floating point number from string.
+ * @param str String, the whole string must be a number.
+ * @param val Parsed value.
+ * @return True if the string is a floating point number.
+ */
+inline bool parse_csv_double(string_view str, double& val) noexcept
+{
+    if (str.empty())
+    {
+        return false;
+    }
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars>=201611L
+    auto end=str.data()+str.size();
+    auto ret=std::from_chars(str.data(),end,val);
+    return ret.ec==std::errc() && ret.ptr==end;
+#else
+    // strtod() requires null terminated string and accepts leading spaces and sign that from_chars() does not accept
+    char buf[64];
+    auto first=str[0];
+    if (str.size()>=sizeof(buf) || first=='+' || first==' ' || first=='\t')
+    {
+        return false;
+    }
+    std::copy(str.begin(),str.end(),buf);
+    buf[str.size()]=0;
+    char* end=nullptr;
+    val=std::strtod(buf,&end);
+    return end==buf+str.size();
+#endif
+}
+
+}
+
+//-------------------------------------------------------------
+
+/**
+ * @brief View of a CSV field.
+ *
+ * The field is a string view that can also be compared with numbers.
+ * Numbers are parsed lazily in comparison operators, so only fields validated with numeric operands are parsed.
+ * Fields that are not numbers are not comparable with numbers, so such comparisons fail except for "!=".
+ * Two fields are compared as numbers if both are numbers and as strings otherwise.
+ *
+ * Missing fields are represented by empty view that is not comparable with anything.
+ */
+class csv_field : public enable_value_ordering<csv_field>
+{
+    public:
+
+        /**
+         * @brief Constructor of missing field.
+         */
+        csv_field() noexcept : _missing(true)
+        {}
+
+        /**
+         * @brief Constructor.
+         * @param data Content of the field.
+         */
+        explicit csv_field(string_view data) noexcept : _data(data),_missing(false)
+        {}
+
+        /**
+         * @brief Check if field is missing.
+         * @return Boolean result.
+         */
+        bool is_missing() const noexcept
+        {
+            return _missing;
+        }
+
+        /**
+         * @brief Get content of the field.
+         * @return String view.
+         */
+        string_view str() const noexcept
+        {
+            return _data;
+        }
+
+        operator string_view() const noexcept
+        {
+            return _data;
+        }
+
+        const char* data() const noexcept
+        {
+            return _data.data();
+        }
+
+        size_t size() const noexcept
+        {
+            return _data.size();
+        }
+
+        bool empty() const noexcept
+        {
+            return _data.empty();
+        }
+
+        /**
+         * @brief Parse field as a number.
+         * @param val Parsed value.
+         * @return True if the whole field is a number of requested type.
+         */
+        template <typename T>
+        std::enable_if_t<std::is_integral<T>::value && !std::is_same<T,bool>::value,bool>
+        to_number(T& val) const noexcept
+        {
+            return detail::parse_csv_integer(_data,val);
+        }
+
+        template <typename T>
+        std::enable_if_t<std::is_floating_point<T>::value,bool>
+        to_number(T& val) const noexcept
+        {
+            double result=0.0;
+            if (!detail::parse_csv_double(_data,result))
+            {
+                return false;
+            }
+            val=static_cast<T>(result);
+            return true;
+        }
+
+    private:
+
+        friend class enable_value_ordering<csv_field>;
+
+        template <typename T>
+        std::enable_if_t<std::is_integral<T>::value && !std::is_same<T,bool>::value,value_ordering>
+        compare(const T& other) const noexcept
+        {
+            if (_missing)
+            {
+                return value_ordering::unordered;
+            }
+            if (!_data.empty() && _data[0]=='-')
+            {
+                int64_t val=0;
+                if (to_number(val))
+                {
+                    return compare_value_ordering(val,other);
+                }
+            }
+            else
+            {
+                uint64_t val=0;
+                if (to_number(val))
+                {
+                    return compare_value_ordering(val,other);
+                }
+            }
+            // integers out of range and floating point numbers
+            double val=0.0;
+            if (to_number(val))
+            {
+                return compare_value_ordering(val,other);
+            }
+            return value_ordering::unordered;
+        }
+
+        template <typename T>
+        std::enable_if_t<std::is_floating_point<T>::value,value_ordering>
+        compare(const T& other) const noexcept
+        {
+            double val=0.0;
+            if (!_missing && to_number(val))
+            {
+                return compare_value_ordering(val,other);
+            }
+            return value_ordering::unordered;
+        }
+
+        template <typename T>
+        std::enable_if_t<std::is_constructible<string_view,T>::value && !std::is_arithmetic<T>::value
+                         && !std::is_same<T,csv_field>::value,value_ordering>
+        compare(const T& other) const noexcept
+        {
+            if (_missing)
+            {
+                return value_ordering::unordered;
+            }
+            return compare_string_ordering(_data,string_view(other));
+        }
+
+        value_ordering compare(const csv_field& other) const noexcept
+        {
+            if (other._missing)
+            {
+                return value_ordering::unordered;
+            }
+            double val=0.0;
+            double other_val=0.0;
+            if (to_number(val) && other.to_number(other_val))
+            {
+                return compare_value_ordering(val,other_val);
+            }
+            return compare(other._data);
+        }
+
+        string_view _data;
+        bool _missing;
+};
+
+//-------------------------------------------------------------
+
+/**
+ * @brief Header of CSV data with names of columns.
+ *
+ * Names of columns are copied, so the header can outlive the line it was parsed from.
+ */
+class csv_header
+{
+    public:
+
+        /**
+         * @brief Constructor.
+         * @param line Header line.
+         * @param delimiter Delimiter of fields, e.g. ',' for CSV and '\t' for TSV.
+         */
+        explicit csv_header(string_view line, char delimiter=',') : _delimiter(delimiter)
+        {
+            line=strip_csv_line(line);
+            split_csv_line(line,delimiter,
+                [&](size_t offset, size_t size, bool escaped)
+                {
+                    auto field=line.substr(offset,size);
+                    _names.emplace_back();
+                    if (escaped)
+                    {
+                        unescape_csv_field(field,_names.back());
+                    }
+                    else
+                    {
+                        _names.back().assign(field.data(),field.size());
+                    }
+                }
+            );
+        }
+
+        /**
+         * @brief Get delimiter of fields.
+         * @return Delimiter.
+         */
+        char delimiter() const noexcept
+        {
+            return _delimiter;
+        }
+
+        /**
+         * @brief Get number of columns.
+         * @return Number of columns.
+         */
+        size_t size() const noexcept
+        {
+            return _names.size();
+        }
+
+        /**
+         * @brief Get name of a column.
+         * @param index Index of the column.
+         * @return Name of the column or empty view if index is out of range.
+         */
+        string_view name(size_t index) const noexcept
+        {
+            return index<_names.size() ? string_view(_names[index]) : string_view();
+        }
+
+        /**
+         * @brief Find index of a column.
+         * @param name Name of the column.
+         * @return Index of the column or npos if the column is not found.
+         *
+         * Columns are looked up linearly because number of columns is usually small.
+         */
+        size_t index(string_view name) const noexcept
+        {
+            for (size_t i=0;i<_names.size();i++)
+            {
+                if (string_view(_names[i])==name)
+                {
+                    return i;
+                }
+            }
+            return npos;
+        }
+
+        constexpr static const size_t npos=static_cast<size_t>(-1);
+
+    private:
+
+        char _delimiter;
+        std::vector<std::string> _names;
+};
+
+//-------------------------------------------------------------
+
+/**
+ * @brief View of a CSV/TSV row for validation.
+ *
+ * The row is an object whose members are fields. Fields are looked up by indexes,
+ * and by names of columns if the row has a header, e.g. _["price"](gte,0) or _[2](gte,0).
+ * Fields are returned as csv_field views that can be compared both with strings and with numbers.
+ * Element aggregations iterate over fields, keys modifier of aggregations gives names of columns.
+ * Properties size and empty give number of fields.
+ *
+ * The line is split into fields when the row is constructed, only offsets of fields are stored.
+ * Contents of quoted fields are views of the line too, unless the fields contain escaped quotes,
+ * in which case unescaped contents are copied to the internal buffer of the row.
+ * Quoted fields spanning multiple lines are not supported, trailing carriage return is stripped from the line.
+ *
+ * The row does not own the line and the header, they must outlive the row.
+ */
+class csv_row
+{
+    public:
+
+        class const_iterator;
+        using iterator=const_iterator;
+
+        /**
+         * @brief Constructor of row without header.
+         * @param line Line.
+         * @param delimiter Delimiter of fields, e.g. ',' for CSV and '\t' for TSV.
+         */
+        explicit csv_row(string_view line, char delimiter=',')
+            : _line(strip_csv_line(line)),
+              _header(nullptr)
+        {
+            split(delimiter);
+        }
+
+        /**
+         * @brief Constructor of row with header.
+         * @param line Line.
+         * @param header Header with names of columns, delimiter of fields is taken from the header.
+         */
+        csv_row(string_view line, const csv_header& header)
+            : _line(strip_csv_line(line)),
+              _header(&header)
+        {
+            split(header.delimiter());
+        }
+
+        /**
+         * @brief Check if the row is well-formed, i.e. all quoted fields are terminated.
+         * @return Boolean result.
+         */
+        bool well_formed() const noexcept
+        {
+            return _well_formed;
+        }
+
+        /**
+         * @brief Get header.
+         * @return Header or nullptr if the row has no header.
+         */
+        const csv_header* header() const noexcept
+        {
+            return _header;
+        }
+
+        size_t size() const noexcept
+        {
+            return _fields.size();
+        }
+
+        bool empty() const noexcept
+        {
+            return _fields.empty();
+        }
+
+        /**
+         * @brief Get field by index.
+         * @param index Index of the field.
+         * @return View of the field, missing field if index is out of range.
+         */
+        csv_field field(size_t index) const noexcept
+        {
+            if (index>=_fields.size())
+            {
+                return csv_field();
+            }
+            const auto& ref=_fields[index];
+            if (ref.unescaped)
+            {
+                return csv_field(string_view(_unescaped).substr(ref.offset,ref.size));
+            }
+            return csv_field(_line.substr(ref.offset,ref.size));
+        }
+
+        /**
+         * @brief Check if row has a field.
+         * @param key Index of the field or name of the column.
+         * @return Boolean result.
+         */
+        template <typename T>
+        bool contains(const T& key) const noexcept
+        {
+            return index_of(key)<_fields.size();
+        }
+
+        /**
+         * @brief Get field.
+         * @param key Index of the field or name of the column.
+         * @return View of the field, missing field if the row does not have the field.
+         */
+        template <typename T>
+        csv_field at(const T& key) const noexcept
+        {
+            return field(index_of(key));
+        }
+
+        const_iterator begin() const noexcept;
+        const_iterator end() const noexcept;
+
+    private:
+
+        struct field_ref
+        {
+            size_t offset;
+            size_t size;
+            bool unescaped;
+        };
+
+        void split(char delimiter)
+        {
+            _well_formed=split_csv_line(_line,delimiter,
+                [this](size_t offset, size_t size, bool escaped)
+                {
+                    if (!escaped)
+                    {
+                        _fields.push_back(field_ref{offset,size,false});
+                        return;
+                    }
+                    auto unescaped_offset=_unescaped.size();
+                    unescape_csv_field(_line.substr(offset,size),_unescaped);
+                    _fields.push_back(field_ref{unescaped_offset,_unescaped.size()-unescaped_offset,true});
+                }
+            );
+        }
+
+        template <typename T>
+        std::enable_if_t<std::is_integral<T>::value && !std::is_same<T,bool>::value,size_t>
+        index_of(const T& key) const noexcept
+        {
+            return safe_compare_less(key,0) ? csv_header::npos : static_cast<size_t>(key);
+        }
+
+        template <typename T>
+        std::enable_if_t<std::is_constructible<string_view,T>::value && !std::is_arithmetic<T>::value,size_t>
+        index_of(const T& key) const noexcept
+        {
+            return _header==nullptr ? csv_header::npos : _header->index(string_view(key));
+        }
+
+        string_view _line;
+        const csv_header* _header;
+        boost::container::small_vector<field_ref,16> _fields;
+        std::string _unescaped;
+        bool _well_formed=true;
+};
+
+//-------------------------------------------------------------
+
+/**
+ * @brief Iterator over fields of CSV row.
+ *
+ * Dereferencing returns view of the field rather than a reference.
+ */
+class csv_row::const_iterator
+{
+    public:
+
+        using iterator_category=std::forward_iterator_tag;
+        using value_type=csv_field;
+        using difference_type=std::ptrdiff_t;
+        using pointer=void;
+        using reference=csv_field;
+
+        const_iterator() noexcept : _row(nullptr),_index(0)
+        {}
+
+        const_iterator(const csv_row* row, size_t index) noexcept : _row(row),_index(index)
+        {}
+
+        csv_field operator*() const noexcept
+        {
+            return _row->field(_index);
+        }
+
+        /**
+         * @brief Get name of the column of current field.
+         * @return Name of the column or empty view if the row has no header.
+         */
+        string_view key() const noexcept
+        {
+            return _row->header()==nullptr ? string_view() : _row->header()->name(_index);
+        }
+
+        const_iterator& operator++() noexcept
+        {
+            ++_index;
+            return *this;
+        }
+
+        const_iterator operator++(int) noexcept
+        {
+            auto tmp=*this;
+            ++_index;
+            return tmp;
+        }
+
+        bool operator==(const const_iterator& other) const noexcept
+        {
+            return _row==other._row && _index==other._index;
+        }
+
+        bool operator!=(const const_iterator& other) const noexcept
+        {
+            return !(*this==other);
+        }
+
+    private:
+
+        const csv_row* _row;
+        size_t _index;
+};
+
+inline csv_row::const_iterator csv_row::begin() const noexcept
+{
+    return const_iterator(this,0);
+}
+
+inline csv_row::const_iterator csv_row::end() const noexcept
+{
+    return const_iterator(this,_fields.size());
+}
+
+/**
+ * @brief Helper for getting value from iterator of CSV row.
+ *
+ * Values are returned by value because iterator creates views on the fly.
+ */
+template <typename T>
+struct get_it_t<T,
+            hana::when<std::is_same<std::decay_t<T>,csv_row::const_iterator>::value>
+        >
+{
+    template <typename T1>
+    auto operator() (T1&& it) const
+    {
+        return *it;
+    }
+
+    template <typename T1>
+    static auto key(T1&& it)
+    {
+        return it.key();
+    }
+};
+
+//-------------------------------------------------------------
+
+HATN_VALIDATOR_NAMESPACE_END
+
+#endif // HATN_VALIDATOR_CSV_ROW_HPP
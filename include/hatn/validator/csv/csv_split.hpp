@@ -0,0 +1,122 @@
+/**
+@copyright Evgeny Sidorov 2020
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+*/
+
+/****************************************************************************/
+
+/** @file validator/csv/csv_split.hpp
+*
+*  Defines helpers for splitting CSV/TSV lines into fields without copying.
+*
+*/
+
+/****************************************************************************/
+
+#ifndef HATN_VALIDATOR_CSV_SPLIT_HPP
+#define HATN_VALIDATOR_CSV_SPLIT_HPP
+
+#include <string>
+
+#include <hatn/validator/config.hpp>
+#include <hatn/validator/utils/string_view.hpp>
+
+HATN_VALIDATOR_NAMESPACE_BEGIN
+
+//-------------------------------------------------------------
+
+/**
+ * @brief Split CSV line into fields.
+ * @param line Line without line terminator.
+ * @param delimiter Delimiter of fields.
+ * @param handler Handler invoked for each field with arguments (offset,size,escaped) where
+ *                offset and size denote content of the field within the line without enclosing quotes,
+ *                escaped is true if content contains escaped quotes.
+ * @return False if a quoted field is not terminated.
+ */
+template <typename HandlerT>
+bool split_csv_line(string_view line, char delimiter, const HandlerT& handler)
+{
+    size_t pos=0;
+    for (;;)
+    {
+        if (pos<line.size() && line[pos]=='"')
+        {
+            auto begin=++pos;
+            bool escaped=false;
+            for (;;)
+            {
+                if (pos>=line.size())
+                {
+                    handler(begin,line.size()-begin,escaped);
+                    return false;
+                }
+                if (line[pos]=='"')
+                {
+                    if (pos+1<line.size() && line[pos+1]=='"')
+                    {
+                        escaped=true;
+                        pos+=2;
+                        continue;
+                    }
+                    break;
+                }
+                ++pos;
+            }
+            handler(begin,pos-begin,escaped);
+            // skip closing quote and anything up to delimiter
+            pos=line.find(delimiter,pos+1);
+        }
+        else
+        {
+            auto end=line.find(delimiter,pos);
+            handler(pos,(end==string_view::npos ? line.size() : end)-pos,false);
+            pos=end;
+        }
+        if (pos==string_view::npos)
+        {
+            return true;
+        }
+        ++pos;
+    }
+}
+
+/**
+ * @brief Append content of quoted field replacing escaped quotes with single quotes.
+ * @param field Content of quoted field without enclosing quotes.
+ * @param dst Destination string.
+ */
+inline void unescape_csv_field(string_view field, std::string& dst)
+{
+    for (size_t i=0;i<field.size();i++)
+    {
+        dst.push_back(field[i]);
+        if (field[i]=='"')
+        {
+            ++i;
+        }
+    }
+}
+
+/**
+ * @brief Strip carriage return ending the line.
+ * @param line Line without new line character.
+ * @return Line without carriage return.
+ */
+inline string_view strip_csv_line(string_view line) noexcept
+{
+    if (!line.empty() && line.back()=='\r')
+    {
+        line.remove_suffix(1);
+    }
+    return line;
+}
+
+//-------------------------------------------------------------
+
+HATN_VALIDATOR_NAMESPACE_END
+
+#endif // HATN_VALIDATOR_CSV_SPLIT_HPP
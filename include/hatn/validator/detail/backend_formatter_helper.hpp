@@ -45,13 +45,14 @@ auto default_backend_formatter(DstT& dst)
 #else
 
 /**
- * @brief Wrap destination object into std::stringstream formatter.
+ * @brief Wrap destination object into standard library formatter.
  * @param dst Destination object.
- * @return std::stringstream backend formatter.
+ * @return Standard library backend formatter.
  */
-inline auto default_backend_formatter(std::string& dst)
+template <typename DstT>
+auto default_backend_formatter(DstT& dst)
 {
-    return detail::std_backend_formatter{dst};
+    return detail::basic_std_backend_formatter<DstT>{dst};
 }
 
 #endif
@@ -125,6 +126,27 @@ struct backend_formatter_helper<DstT,
     }
 };
 
+/**
+ * @brief Type of intermediate parts of reports for destination object of given type.
+ *
+ * By default parts of reports have the same type as the destination object.
+ * Destination objects that can not be default constructed can specify other type as part_type.
+ */
+template <typename DstT, typename =hana::when<true>>
+struct report_part
+{
+    using type=DstT;
+};
+
+template <typename DstT>
+struct report_part<DstT,hana::when_valid<typename DstT::part_type>>
+{
+    using type=typename DstT::part_type;
+};
+
+template <typename DstT>
+using report_part_t=typename report_part<DstT>::type;
+
 /**
  * @brief Extract destination object for formatting from argument.
  * @param v Backend formatter.
@@ -21,9 +21,11 @@ Distributed under the Boost Software License, Version 1.0.
 
 #include <fmt/ranges.h>
 #include <fmt/format.h>
+#include <fmt/compile.h>
 
 #include <hatn/validator/config.hpp>
-#include <hatn/validator/utils/hana_to_std_tuple.hpp>
+#include <hatn/validator/utils/string_view.hpp>
+#include <hatn/validator/utils/reference_wrapper.hpp>
 #include <hatn/validator/reporting/concrete_phrase.hpp>
 #include <hatn/validator/utils/object_wrapper.hpp>
 #include <hatn/validator/utils/unwrap_object.hpp>
@@ -41,7 +43,8 @@ struct formatter<concrete_phrase> : formatter<string_view>
 {
     template <typename FormatContext>
     auto format(const concrete_phrase& ph, FormatContext& ctx) const {
-        return format_to(ctx.out(),"{}",ph.text());
+        auto v=ph.view();
+        return formatter<string_view>::format(string_view(v.data(),v.size()),ctx);
     }
 };
 
@@ -63,6 +66,140 @@ HATN_VALIDATOR_NAMESPACE_BEGIN
 namespace detail
 {
 
+HATN_VALIDATOR_INLINE_LAMBDA auto has_append_chars = hana::is_valid([](auto&& dst) -> decltype((void)dst.append(std::declval<const char*>(),size_t(0))){});
+
+/**
+ * @brief Default appender of a value to destination object that formats the value with compiled format string.
+ *
+ * Format string "{}" is compiled with FMT_COMPILE(), so it is not parsed at runtime.
+ */
+template <typename T, typename =hana::when<true>>
+struct fmt_value_appender
+{
+    template <typename DstT, typename T1>
+    static void append(DstT& dst, const T1& v)
+    {
+        fmt::format_to(std::back_inserter(dst),FMT_COMPILE("{}"),v);
+    }
+};
+
+/**
+ * @brief Append text to destination object.
+ * @param dst Destination object.
+ * @param v Text to append.
+ *
+ * If destination object has method append(const char*,size_t) then text is appended with that method as is.
+ */
+template <typename DstT>
+void fmt_append_text(DstT& dst, string_view v)
+{
+    hana::eval_if(
+        has_append_chars(dst),
+        [&](auto&& _)
+        {
+            _(dst).append(v.data(),v.size());
+        },
+        [&](auto&& _)
+        {
+            fmt::format_to(std::back_inserter(_(dst)),FMT_COMPILE("{}"),fmt::string_view(v.data(),v.size()));
+        }
+    );
+}
+
+/**
+ * @brief Appender of strings, string views and phrases.
+ */
+template <typename T>
+struct fmt_value_appender<T,
+            hana::when<
+                std::is_same<T,std::string>::value
+                ||
+                std::is_same<T,string_view>::value
+                ||
+                std::is_same<T,concrete_phrase>::value
+                ||
+                std::is_same<T,const char*>::value
+                ||
+                std::is_same<T,char*>::value
+            >
+        >
+{
+    template <typename DstT, typename T1>
+    static void append(DstT& dst, const T1& v)
+    {
+        fmt_append_text(dst,text(v));
+    }
+
+    private:
+
+        static string_view text(const std::string& v) noexcept
+        {
+            return string_view(v.data(),v.size());
+        }
+
+        static string_view text(const string_view& v) noexcept
+        {
+            return v;
+        }
+
+        static string_view text(const concrete_phrase& v) noexcept
+        {
+            return v.view();
+        }
+
+        static string_view text(const char* v) noexcept
+        {
+            return string_view(v);
+        }
+};
+
+/**
+ * @brief Appender of integers.
+ *
+ * Integers are formatted with fmt::format_int into a stack buffer and appended as text.
+ */
+template <typename T>
+struct fmt_value_appender<T,
+            hana::when<
+                std::is_same<T,short>::value
+                ||
+                std::is_same<T,unsigned short>::value
+                ||
+                std::is_same<T,int>::value
+                ||
+                std::is_same<T,unsigned int>::value
+                ||
+                std::is_same<T,long>::value
+                ||
+                std::is_same<T,unsigned long>::value
+                ||
+                std::is_same<T,long long>::value
+                ||
+                std::is_same<T,unsigned long long>::value
+            >
+        >
+{
+    template <typename DstT>
+    static void append(DstT& dst, T v)
+    {
+        fmt::format_int str(v);
+        fmt_append_text(dst,string_view(str.data(),str.size()));
+    }
+};
+
+/**
+ * @brief Append value to destination object.
+ * @param dst Destination object.
+ * @param v Value to append.
+ *
+ * Values wrapped into object_wrapper, e.g. operands of operators, are unwrapped before appending.
+ */
+template <typename DstT, typename T>
+void fmt_append_value(DstT& dst, const T& v)
+{
+    fmt_value_appender<unwrap_object_t<T>>::append(dst,unwrap_object(v));
+}
+
 /**
  * @brief Join vector of parts and append to destination object.
  * @param dst Destination object.
@@ -73,7 +210,15 @@ template <typename DstT, typename SepT, typename PartsT>
 void fmt_append_join(DstT& dst, SepT&& sep, PartsT&& parts,
                      std::enable_if_t<!hana::is_a<hana::tuple_tag,PartsT>,void*> =nullptr)
 {
-    fmt::format_to(std::back_inserter(dst),"{}",fmt::join(std::forward<PartsT>(parts),std::forward<SepT>(sep)));
+    size_t i=0;
+    for (auto&& it:parts)
+    {
+        if (i++!=0)
+        {
+            fmt_append_value(dst,sep);
+        }
+        fmt_append_value(dst,it);
+    }
 }
 
 /**
@@ -81,21 +226,35 @@ void fmt_append_join(DstT& dst, SepT&& sep, PartsT&& parts,
  * @param dst Destination object.
  * @param sep Separator for joining.
  * @param parts hana::tuple of parts to join and append.
+ *
+ * Parts are formatted one by one with compiled format strings, so neither format string nor std::tuple of parts are constructed at runtime.
  */
 template <typename DstT, typename SepT, typename PartsT>
 void fmt_append_join(DstT& dst, SepT&& sep, PartsT&& parts,
                      std::enable_if_t<hana::is_a<hana::tuple_tag,PartsT>,void*> =nullptr)
 {
-    fmt::format_to(std::back_inserter(dst),"{}",fmt::join(hana_to_std_tuple(std::forward<PartsT>(parts)),std::forward<SepT>(sep)));
+    hana::fold(
+        std::forward<PartsT>(parts),
+        0u,
+        [&dst,&sep](size_t i,auto&& v)
+        {
+            if (i!=0u)
+            {
+                fmt_append_value(dst,sep);
+            }
+            fmt_append_value(dst,extract_ref(std::forward<decltype(v)>(v)));
+            return i+1;
+        }
+    );
 }
 
 /**
- * @brief Append arguments to destination object.
+ * @brief Join arguments and append to destination object.
  */
 template <typename DstT, typename SepT, typename ...Args>
 void fmt_append_join_args(DstT& dst, SepT&& sep, Args&&... args)
 {
-    fmt::format_to(std::back_inserter(dst),"{}",fmt::join(std::make_tuple(std::forward<Args>(args)...),std::forward<SepT>(sep)));
+    fmt_append_join(dst,std::forward<SepT>(sep),make_cref_tuple(std::forward<Args>(args)...));
 }
 
 /**
@@ -104,7 +263,13 @@ void fmt_append_join_args(DstT& dst, SepT&& sep, Args&&... args)
 template <typename DstT, typename ...Args>
 void fmt_append_args(DstT& dst, Args&&... args)
 {
-    fmt_append_join_args(dst,"",std::forward<Args>(args)...);
+    hana::for_each(
+        make_cref_tuple(std::forward<Args>(args)...),
+        [&dst](auto&& v)
+        {
+            fmt_append_value(dst,extract_ref(v));
+        }
+    );
 }
 
 struct backend_formatter_tag;
@@ -152,9 +317,10 @@ struct fmt_backend_formatter
         return _dst;
     }
 
-    static fmt_backend_formatter<DstT> clone(DstT& dst)
+    template <typename T>
+    static fmt_backend_formatter<T> clone(T& dst)
     {
-        return fmt_backend_formatter<DstT>{dst};
+        return fmt_backend_formatter<T>{dst};
     }
 };
 
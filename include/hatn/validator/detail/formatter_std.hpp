@@ -10,7 +10,7 @@ Distributed under the Boost Software License, Version 1.0.
 
 /** @file validator/detail/formatter_std.hpp
 *
-*  Defines formatter that uses std::stringstream for strings formatting.
+*  Defines formatter that uses only standard library for strings formatting.
 *
 */
 
@@ -21,9 +21,26 @@ Distributed under the Boost Software License, Version 1.0.
 
 #include <string>
 #include <sstream>
+#include <limits>
 
 #include <hatn/validator/config.hpp>
+#include <hatn/validator/utils/string_view.hpp>
 #include <hatn/validator/utils/reference_wrapper.hpp>
+#include <hatn/validator/utils/unwrap_object.hpp>
+#include <hatn/validator/reporting/concrete_phrase.hpp>
+
+#if __cplusplus >= 201703L
+#include <charconv>
+#define HATN_VALIDATOR_STD_TO_CHARS 1
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars>=201611L
+#define HATN_VALIDATOR_STD_TO_CHARS_FLOAT 1
+#else
+#define HATN_VALIDATOR_STD_TO_CHARS_FLOAT 0
+#endif
+#else
+#define HATN_VALIDATOR_STD_TO_CHARS 0
+#define HATN_VALIDATOR_STD_TO_CHARS_FLOAT 0
+#endif
 
 HATN_VALIDATOR_NAMESPACE_BEGIN
 
@@ -32,28 +49,203 @@ HATN_VALIDATOR_NAMESPACE_BEGIN
 namespace detail
 {
 
+/**
+ * @brief Default appender of a value to destination string that formats the value with std::ostringstream.
+ *
+ * Used only for types that do not have a specialized appender.
+ */
+template <typename T, typename =hana::when<true>>
+struct std_value_appender
+{
+    template <typename DstT, typename T1>
+    static void append(DstT& dst, const T1& v)
+    {
+        std::ostringstream ss;
+        ss<<v;
+        auto str=ss.str();
+        dst.append(str.data(),str.size());
+    }
+};
+
+/**
+ * @brief Appender of strings and string views.
+ */
+template <typename T>
+struct std_value_appender<T,
+            hana::when<
+                std::is_same<T,std::string>::value
+                ||
+                std::is_same<T,string_view>::value
+                ||
+                std::is_same<T,concrete_phrase>::value
+            >
+        >
+{
+    template <typename DstT>
+    static void append(DstT& dst, const std::string& v)
+    {
+        dst.append(v.data(),v.size());
+    }
+
+    template <typename DstT>
+    static void append(DstT& dst, const string_view& v)
+    {
+        dst.append(v.data(),v.size());
+    }
+
+    template <typename DstT>
+    static void append(DstT& dst, const concrete_phrase& v)
+    {
+        auto view=v.view();
+        dst.append(view.data(),view.size());
+    }
+};
+
+/**
+ * @brief Appender of C strings.
+ */
+template <typename T>
+struct std_value_appender<T,
+            hana::when<
+                std::is_same<T,const char*>::value
+                ||
+                std::is_same<T,char*>::value
+            >
+        >
+{
+    template <typename DstT>
+    static void append(DstT& dst, const char* v)
+    {
+        dst.append(v,std::char_traits<char>::length(v));
+    }
+};
+
+/**
+ * @brief Appender of characters.
+ */
+template <>
+struct std_value_appender<char>
+{
+    template <typename DstT>
+    static void append(DstT& dst, char v)
+    {
+        dst.push_back(v);
+    }
+};
+
+/**
+ * @brief Appender of booleans, booleans are formatted as numbers the same way as by std::ostream.
+ */
+template <>
+struct std_value_appender<bool>
+{
+    template <typename DstT>
+    static void append(DstT& dst, bool v)
+    {
+        dst.push_back(v?'1':'0');
+    }
+};
+
+/**
+ * @brief Check if type is an integer type that std::ostream formats as a number.
+ */
+template <typename T>
+using is_std_formatted_integer=hana::bool_<
+        std::is_same<T,short>::value
+        ||
+        std::is_same<T,unsigned short>::value
+        ||
+        std::is_same<T,int>::value
+        ||
+        std::is_same<T,unsigned int>::value
+        ||
+        std::is_same<T,long>::value
+        ||
+        std::is_same<T,unsigned long>::value
+        ||
+        std::is_same<T,long long>::value
+        ||
+        std::is_same<T,unsigned long long>::value
+    >;
+
+/**
+ * @brief Appender of integers.
+ */
+template <typename T>
+struct std_value_appender<T,
+            hana::when<is_std_formatted_integer<T>::value>
+        >
+{
+    template <typename DstT>
+    static void append(DstT& dst, T v)
+    {
+#if HATN_VALIDATOR_STD_TO_CHARS
+        char buf[std::numeric_limits<T>::digits10+3];
+        auto res=std::to_chars(buf,buf+sizeof(buf),v);
+        dst.append(buf,static_cast<size_t>(res.ptr-buf));
+#else
+        auto str=std::to_string(v);
+        dst.append(str.data(),str.size());
+#endif
+    }
+};
+
+#if HATN_VALIDATOR_STD_TO_CHARS_FLOAT
+/**
+ * @brief Appender of floating point numbers.
+ *
+ * Numbers are formatted with the same precision and in the same format as by std::ostream with default flags.
+ */
+template <typename T>
+struct std_value_appender<T,
+            hana::when<std::is_floating_point<T>::value>
+        >
+{
+    template <typename DstT>
+    static void append(DstT& dst, T v)
+    {
+        char buf[64];
+        auto res=std::to_chars(buf,buf+sizeof(buf),v,std::chars_format::general,6);
+        dst.append(buf,static_cast<size_t>(res.ptr-buf));
+    }
+};
+#endif
+
+/**
+ * @brief Append value to destination string.
+ * @param dst Destination string.
+ * @param v Value to append.
+ *
+ * Destination can be either std::string or other object that has methods append(const char*,size_t) and push_back(char).
+ * Values wrapped into object_wrapper, e.g. operands of operators, are unwrapped before appending.
+ */
+template <typename DstT, typename T>
+void std_append_value(DstT& dst, const T& v)
+{
+    std_value_appender<unwrap_object_t<T>>::append(dst,unwrap_object(v));
+}
+
 /**
  * @brief Append arguments to destination string.
  * @param dst Destination string.
  * @param sep Separator for joining arguments.
  * @param parts Vector to join and append to string.
+ *
+ * Parts are appended to the destination string in place.
  */
-template <typename PartsT, typename SepT>
-void std_append_join(std::string& dst, SepT&& sep, PartsT&& parts,
+template <typename DstT, typename PartsT, typename SepT>
+void std_append_join(DstT& dst, SepT&& sep, PartsT&& parts,
                      std::enable_if_t<!hana::is_a<hana::tuple_tag,PartsT>,void*> =nullptr)
 {
     size_t i=0;
-    std::stringstream ss;
-    ss<<dst;
     for (auto&& it:parts)
     {
         if (i++!=0)
         {
-            ss<<sep;
+            std_append_value(dst,sep);
         }
-        ss<<it;
+        std_append_value(dst,it);
     }
-    dst=ss.str();
 }
 
 /**
@@ -61,27 +253,26 @@ void std_append_join(std::string& dst, SepT&& sep, PartsT&& parts,
  * @param dst Destination string.
  * @param sep Separator for joining arguments.
  * @param parts Hana tuple to join and append to string.
+ *
+ * Parts are appended to the destination string in place.
  */
-template <typename PartsT, typename SepT>
-void std_append_join(std::string& dst, SepT&& sep, PartsT&& parts,
+template <typename DstT, typename PartsT, typename SepT>
+void std_append_join(DstT& dst, SepT&& sep, PartsT&& parts,
                      std::enable_if_t<hana::is_a<hana::tuple_tag,PartsT>,void*> =nullptr)
 {
-    std::stringstream ss;
-    ss<<dst;
     hana::fold(
         std::forward<PartsT>(parts),
         0u,
-        [&ss,&sep](size_t i,auto&& v)
+        [&dst,&sep](size_t i,auto&& v)
         {
             if (i!=0u)
             {
-                ss<<sep;
+                std_append_value(dst,sep);
             }
-            ss<<extract_ref(std::forward<decltype(v)>(v));
+            std_append_value(dst,extract_ref(std::forward<decltype(v)>(v)));
             return i+1;
         }
     );
-    dst=ss.str();
 }
 
 /**
@@ -90,8 +281,8 @@ void std_append_join(std::string& dst, SepT&& sep, PartsT&& parts,
  * @param sep Separator for joining arguments.
  * @param args Arguments to join and append to string.
  */
-template <typename SepT, typename ...Args>
-void std_append(std::string& dst, SepT&& sep, Args&&... args)
+template <typename DstT, typename SepT, typename ...Args>
+void std_append(DstT& dst, SepT&& sep, Args&&... args)
 {
     std_append_join(dst,std::forward<SepT>(sep),make_cref_tuple(std::forward<Args>(args)...));
 }
@@ -99,14 +290,22 @@ void std_append(std::string& dst, SepT&& sep, Args&&... args)
 struct backend_formatter_tag;
 
 /**
- * @brief Backend formatter that uses std::stringstream fot formatting.
+ * @brief Backend formatter that uses only standard library for formatting.
+ *
+ * Arguments are appended to destination string in place. Strings are appended as is,
+ * numbers are formatted with std::to_chars() if it is available, and std::ostringstream is used only for other types.
+ * The result is the same as if all arguments were written to std::ostream with default flags.
+ *
+ * Destination object is normally a std::string. Also it can be other object that has methods
+ * append(const char*,size_t) and push_back(char), e.g. fixed_buffer.
  */
-struct std_backend_formatter
+template <typename DstT>
+struct basic_std_backend_formatter
 {
     using hana_tag=backend_formatter_tag;
-    using type=std::string;
+    using type=DstT;
 
-    std::string& _dst;
+    DstT& _dst;
 
     template <typename ...Args>
     void append(Args&&... args)
@@ -126,22 +325,28 @@ struct std_backend_formatter
         return std_append_join(_dst,std::forward<SepT>(sep),std::forward<PartsT>(parts));
     }
 
-    operator std::string& ()
+    operator DstT& ()
     {
         return _dst;
     }
 
-    std::string& get()
+    DstT& get()
     {
         return _dst;
     }
 
-    static std_backend_formatter clone(std::string& dst)
+    template <typename T>
+    static basic_std_backend_formatter<T> clone(T& dst)
     {
-        return std_backend_formatter{dst};
+        return basic_std_backend_formatter<T>{dst};
     }
 };
 
+/**
+ * @brief Backend formatter that uses only standard library for formatting to std::string.
+ */
+using std_backend_formatter=basic_std_backend_formatter<std::string>;
+
 }
 
 //-------------------------------------------------------------
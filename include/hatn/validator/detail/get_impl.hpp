@@ -19,9 +19,12 @@ Distributed under the Boost Software License, Version 1.0.
 #ifndef HATN_VALIDATOR_GET_IMPL_HPP
 #define HATN_VALIDATOR_GET_IMPL_HPP
 
+#include <stdexcept>
+
 #include <hatn/validator/config.hpp>
 #include <hatn/validator/property.hpp>
 #include <hatn/validator/can_get.hpp>
+#include <hatn/validator/detail/transparent_lookup.hpp>
 
 HATN_VALIDATOR_NAMESPACE_BEGIN
 
@@ -37,6 +40,7 @@ namespace get_helpers
         brackets = 3,
         iterator = 4,
         find = 5,
+        transparent_find = 6,
 
         none = -1
     };
@@ -48,18 +52,22 @@ namespace get_helpers
             can_get<T1, T2>.property(),
             getter::property,
             hana::if_(
-                can_get<T1, T2>.at(),
-                getter::at,
+                transparent_lookup_t<T1, T2>::value,
+                getter::transparent_find,
                 hana::if_(
-                    can_get<T1, T2>.brackets(),
-                    getter::brackets,
+                    can_get<T1, T2>.at(),
+                    getter::at,
                     hana::if_(
-                        can_get<T1, T2>.iterator(),
-                        getter::iterator,
+                        can_get<T1, T2>.brackets(),
+                        getter::brackets,
                         hana::if_(
-                            can_get<T1, T2>.find(),
-                            getter::find,
-                            getter::none
+                            can_get<T1, T2>.iterator(),
+                            getter::iterator,
+                            hana::if_(
+                                can_get<T1, T2>.find(),
+                                getter::find,
+                                getter::none
+                            )
                         )
                     )
                 )
@@ -137,6 +145,24 @@ struct get_t<T1,T2,
     }
 };
 
+/**
+ * @brief Get using find(key) method of associative container with heterogeneous lookup, key is looked up as string view.
+ */
+template <typename T1, typename T2>
+struct get_t<T1,T2,
+    hana::when<get_helpers::selector<T1, T2>::value == get_helpers::getter::transparent_find>>
+{
+    auto operator () (T1&& v, T2&& k) const -> decltype(auto)
+    {
+      auto it=v.find(string_view(k));
+      if (it==v.end())
+      {
+          throw std::out_of_range("key not found");
+      }
+      return (it->second);
+    }
+};
+
 /**
  * @brief Helper for getting member from object of type T1 using key of type T2.
  */
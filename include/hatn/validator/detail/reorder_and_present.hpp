@@ -100,9 +100,12 @@ struct apply_reorder_present_1arg_t
                 strings.aggregation_open(aggregation_item.aggregation)
             );
         }
+        // groups of summarized aggregation are joined as AND parts
         backend_formatter.append_join(
             dst,
-            strings.aggregation_conjunction(aggregation_item.aggregation),
+            aggregation_item.summarized
+                ? strings.aggregation_conjunction(string_and)
+                : strings.aggregation_conjunction(aggregation_item.aggregation),
             aggregation_item.parts
         );
         if (!aggregation_item.single && aggregation_item.parts.size()>1)
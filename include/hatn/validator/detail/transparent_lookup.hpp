@@ -0,0 +1,77 @@
+/**
+@copyright Evgeny Sidorov 2020
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+*/
+
+/****************************************************************************/
+
+/** @file validator/detail/transparent_lookup.hpp
+*
+*  Defines helper to check if string keys can be looked up in container as string views.
+*
+*/
+
+/****************************************************************************/
+
+#ifndef HATN_VALIDATOR_TRANSPARENT_LOOKUP_HPP
+#define HATN_VALIDATOR_TRANSPARENT_LOOKUP_HPP
+
+#include <type_traits>
+
+#include <hatn/validator/config.hpp>
+#include <hatn/validator/detail/has_method.hpp>
+#include <hatn/validator/utils/string_view.hpp>
+
+HATN_VALIDATOR_NAMESPACE_BEGIN
+
+namespace detail
+{
+
+//-------------------------------------------------------------
+
+/**
+ * @brief Default helper for checking if key of type T2 can be looked up in container of type T1 as string view.
+ */
+template <typename T1, typename T2, typename=hana::when<true>>
+struct transparent_lookup_t
+{
+    constexpr static const bool value=false;
+};
+
+/**
+ * @brief Helper for checking if key of type T2 can be looked up in associative container of type T1 as string view.
+ *
+ * Lookup with string view is used if the key can be converted to string view and is not of container's key_type,
+ * and the container supports heterogeneous lookup, i.e. it has either transparent comparator or transparent hasher
+ * and key equality predicate. Then a key is converted to string view once and no temporary key_type objects are constructed.
+ */
+template <typename T1, typename T2>
+struct transparent_lookup_t<T1,T2,
+            hana::when_valid<
+                typename std::decay_t<T1>::key_type,
+                typename std::decay_t<T1>::mapped_type
+            >
+        >
+{
+    using container_type=std::decay_t<T1>;
+    using key_type=typename container_type::key_type;
+
+    constexpr static const bool value=std::is_convertible<const std::decay_t<T2>&,string_view>::value
+                                      &&
+                                      !std::is_same<std::decay_t<T2>,key_type>::value
+                                      &&
+                                      !std::is_convertible<string_view,key_type>::value
+                                      &&
+                                      has_find_it_c(hana::type_c<const container_type&>,hana::type_c<string_view>);
+};
+
+//-------------------------------------------------------------
+
+}
+
+HATN_VALIDATOR_NAMESPACE_END
+
+#endif // HATN_VALIDATOR_TRANSPARENT_LOOKUP_HPP
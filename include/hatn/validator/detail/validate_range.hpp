@@ -0,0 +1,398 @@
+/**
+@copyright Evgeny Sidorov 2020
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+*/
+
+/****************************************************************************/
+
+/** @file validator/detail/validate_range.hpp
+*
+*  Defines helpers for validation of all elements of a range.
+*
+*/
+
+/****************************************************************************/
+
+#ifndef HATN_VALIDATOR_VALIDATE_RANGE_HPP
+#define HATN_VALIDATOR_VALIDATE_RANGE_HPP
+
+#include <type_traits>
+#include <algorithm>
+#include <iterator>
+#include <vector>
+#include <atomic>
+#include <future>
+
+#include <hatn/validator/config.hpp>
+#include <hatn/validator/utils/unwrap_object.hpp>
+#include <hatn/validator/property.hpp>
+#include <hatn/validator/properties/value.hpp>
+#include <hatn/validator/operators/comparison.hpp>
+#include <hatn/validator/operators/in.hpp>
+
+HATN_VALIDATOR_NAMESPACE_BEGIN
+
+namespace detail
+{
+
+/**
+ * @brief Number of elements of a range that are evaluated in a single block.
+ */
+constexpr size_t range_block_size=64;
+
+/**
+ * @brief Min number of elements of a range evaluated by a single thread in parallel validation.
+ */
+constexpr size_t range_min_chunk_size=range_block_size;
+
+/**
+ * @brief Evaluate predicate for all elements of contiguous array block by block.
+ * @param data Array.
+ * @param size Size of array.
+ * @param pred Predicate.
+ * @param any If true then at least one element must satisfy predicate, otherwise all elements must satisfy predicate.
+ * @param stop Flag set when other chunk of the range has decided the result, nullptr if range is not split.
+ * @return Validation result.
+ *
+ * Elements of a block are evaluated without branches so that compiler can vectorize the loop.
+ * ANY/ALL short-circuiting is done once per block.
+ */
+template <typename T, typename PredT>
+bool validate_range_blocks(const T* data, size_t size, const PredT& pred, bool any, const std::atomic<bool>* stop=nullptr)
+{
+    size_t offset=0;
+    for (;offset+range_block_size<=size;offset+=range_block_size)
+    {
+        if (stop!=nullptr && stop->load(std::memory_order_relaxed))
+        {
+            return !any;
+        }
+        const T* block=data+offset;
+        size_t count=0;
+        for (size_t i=0;i<range_block_size;i++)
+        {
+            count+=static_cast<size_t>(pred(block[i]));
+        }
+        if (any)
+        {
+            if (count!=0)
+            {
+                return true;
+            }
+        }
+        else if (count!=range_block_size)
+        {
+            return false;
+        }
+    }
+
+    size_t count=0;
+    size_t tail=size-offset;
+    for (size_t i=offset;i<size;i++)
+    {
+        count+=static_cast<size_t>(pred(data[i]));
+    }
+    return any ? (count!=0) : (count==tail);
+}
+
+HATN_VALIDATOR_INLINE_LAMBDA auto is_contiguous_container = hana::is_valid([](auto&& v) -> decltype(
+            (void)static_cast<const void*>(v.data()),
+            (void)v.size()
+        ){});
+
+/**
+ * @brief Check if elements of container are numbers stored in contiguous memory.
+ */
+template <typename ContainerT, typename=hana::when<true>>
+struct is_contiguous_numbers : public std::false_type
+{
+};
+
+template <typename ContainerT>
+struct is_contiguous_numbers<ContainerT,
+            hana::when<decltype(is_contiguous_container(std::declval<ContainerT>()))::value>
+        > : public std::integral_constant<bool,
+                std::is_arithmetic<std::decay_t<decltype(*std::declval<ContainerT>().data())>>::value
+            >
+{
+};
+
+/**
+ * @brief Check if operator can be evaluated for range elements block by block.
+ */
+template <typename OpT, typename T, typename=hana::when<true>>
+struct is_block_operator : public std::false_type
+{
+};
+
+/**
+ * @brief Comparison operators with numeric operand.
+ */
+template <typename OpT, typename T>
+struct is_block_operator<OpT,T,
+            hana::when<
+                std::is_arithmetic<T>::value
+                &&
+                (
+                    std::is_same<OpT,eq_t>::value
+                    || std::is_same<OpT,ne_t>::value
+                    || std::is_same<OpT,lt_t>::value
+                    || std::is_same<OpT,lte_t>::value
+                    || std::is_same<OpT,gt_t>::value
+                    || std::is_same<OpT,gte_t>::value
+                )
+            >
+        > : public std::true_type
+{
+};
+
+/**
+ * @brief Operators "in" and "nin" with interval of numbers.
+ */
+template <typename OpT, typename T>
+struct is_block_operator<OpT,T,
+            hana::when<
+                hana::is_a<interval_tag,T>
+                &&
+                (std::is_same<OpT,in_t>::value || std::is_same<OpT,nin_t>::value)
+            >
+        > : public std::is_arithmetic<unwrap_object_t<typename T::type>>
+{
+};
+
+/**
+ * @brief Evaluate operator with interval for numbers of array.
+ * @param data Array.
+ * @param size Size of array.
+ * @param op Operator, either in_t or nin_t.
+ * @param val Interval.
+ * @param any If true then ANY aggregation is evaluated, otherwise ALL aggregation is evaluated.
+ * @param stop Flag set when other chunk of the range has decided the result, nullptr if range is not split.
+ * @return Validation result.
+ *
+ * Mode of interval is resolved once so that each element is checked with two comparisons.
+ */
+template <typename T, typename OpT, typename IntervalT>
+bool validate_interval_blocks(const T* data, size_t size, const OpT&, const IntervalT& val, bool any, const std::atomic<bool>* stop=nullptr)
+{
+    const auto& from=unwrap_object(val.from);
+    const auto& to=unwrap_object(val.to);
+    constexpr bool in_interval=std::is_same<OpT,in_t>::value;
+
+    switch (val.mode)
+    {
+        case interval_mode::closed:
+            return validate_range_blocks(data,size,[&](const T& a){return (gte(a,from) & lte(a,to))==in_interval;},any,stop);
+        case interval_mode::open:
+            return validate_range_blocks(data,size,[&](const T& a){return (gt(a,from) & lt(a,to))==in_interval;},any,stop);
+        case interval_mode::open_from:
+            return validate_range_blocks(data,size,[&](const T& a){return (gt(a,from) & lte(a,to))==in_interval;},any,stop);
+        case interval_mode::open_to:
+            break;
+    }
+    return validate_range_blocks(data,size,[&](const T& a){return (gte(a,from) & lt(a,to))==in_interval;},any,stop);
+}
+
+/**
+ * @brief Evaluate chunks of a range in parallel threads.
+ * @param size Number of elements of the range.
+ * @param threads Max number of threads including the calling thread.
+ * @param any If true then ANY aggregation is evaluated, otherwise ALL aggregation is evaluated.
+ * @param eval Evaluator of a chunk, signature "bool (size_t from, size_t to, const std::atomic<bool>* stop)".
+ * @return Validation result.
+ *
+ * The first chunk is evaluated in the calling thread, other chunks are evaluated with std::async.
+ * When a chunk decides the result, i.e. an element fails ALL or satisfies ANY, the stop flag is set
+ * and other chunks stop evaluation. Exceptions thrown by evaluator are rethrown in the calling thread.
+ * If the range is too small to be split then it is evaluated in the calling thread with nullptr stop flag.
+ */
+template <typename EvalT>
+bool validate_range_chunks(size_t size, size_t threads, bool any, const EvalT& eval)
+{
+    auto chunks=(std::min)(threads,(size+range_min_chunk_size-1)/range_min_chunk_size);
+    if (chunks<2)
+    {
+        return eval(0,size,nullptr);
+    }
+
+    std::atomic<bool> stop{false};
+    auto chunk_size=(size+chunks-1)/chunks;
+    auto run=[&](size_t i)
+    {
+        auto from=i*chunk_size;
+        auto to=(std::min)(size,from+chunk_size);
+        auto ok=eval(from,to,&stop);
+        if (ok==any)
+        {
+            stop.store(true,std::memory_order_relaxed);
+        }
+        return ok;
+    };
+
+    std::vector<std::future<bool>> futures;
+    futures.reserve(chunks-1);
+    for (size_t i=1;i<chunks;i++)
+    {
+        futures.push_back(std::async(std::launch::async,run,i));
+    }
+
+    // futures of std::async wait for their threads when destroyed, so chunks never outlive the call
+    auto result=!any;
+    if (run(0)==any)
+    {
+        result=any;
+    }
+    for (auto&& it:futures)
+    {
+        if (it.get()==any)
+        {
+            result=any;
+        }
+    }
+    return result;
+}
+
+/**
+ * @brief Validate elements of container one by one.
+ * @param begin Iterator of the first element.
+ * @param end Iterator past the last element.
+ * @param prop Property of elements to validate.
+ * @param op Operator.
+ * @param val Operand.
+ * @param any If true then ANY aggregation is evaluated, otherwise ALL aggregation is evaluated.
+ * @param stop Flag set when other chunk of the range has decided the result, nullptr if range is not split.
+ * @return Validation result.
+ */
+template <typename IteratorT, typename PropT, typename OpT, typename T2>
+bool validate_range_elements(IteratorT begin, IteratorT end, const PropT& prop, const OpT& op, const T2& val, bool any,
+                             const std::atomic<bool>* stop=nullptr)
+{
+    auto ok=!any;
+    for (auto it=begin;it!=end;++it)
+    {
+        if (stop!=nullptr && stop->load(std::memory_order_relaxed))
+        {
+            return !any;
+        }
+        ok=op(property(*it,prop),val);
+        if (any)
+        {
+            if (ok)
+            {
+               break;
+            }
+        }
+        else
+        {
+            if (!ok)
+            {
+                break;
+            }
+        }
+    }
+    return ok;
+}
+
+/**
+ * @brief Check if container has random access iterators, so that it can be split into chunks.
+ */
+template <typename ContainerT>
+using is_random_access_container=std::is_base_of<
+        std::random_access_iterator_tag,
+        typename std::iterator_traits<decltype(std::begin(std::declval<const ContainerT&>()))>::iterator_category
+    >;
+
+/**
+ * @brief Validate all elements of container.
+ * @param container Container.
+ * @param prop Property of elements to validate.
+ * @param op Operator.
+ * @param val Operand.
+ * @param any If true then ANY aggregation is evaluated, otherwise ALL aggregation is evaluated.
+ * @param threads Max number of threads to use, 1 means that elements are validated in the calling thread.
+ * @return Validation result.
+ *
+ * Numbers stored in contiguous memory are validated block by block if property is "value"
+ * and operator is either comparison operator with a number or "in"/"nin" with an interval of numbers.
+ * Other ranges are validated element by element.
+ *
+ * If threads is greater than 1 and container has random access iterators then the range is split into chunks
+ * validated in parallel, see validate_range_chunks(). Then operator and property must be safe to use in concurrent threads.
+ * The result is the same as of sequential validation.
+ */
+template <typename ContainerT, typename PropT, typename OpT, typename T2>
+bool validate_range(const ContainerT& container, const PropT& prop, const OpT& op, const T2& val, bool any, size_t threads=1)
+{
+    using operand_type=unwrap_object_t<T2>;
+    return hana::eval_if(
+        hana::bool_<
+            is_contiguous_numbers<const ContainerT&>::value
+            &&
+            std::is_same<std::decay_t<PropT>,type_p_value>::value
+            &&
+            is_block_operator<std::decay_t<OpT>,operand_type>::value
+        >{},
+        [&](auto&& _)
+        {
+            using element_type=std::decay_t<decltype(*_(container).data())>;
+            const auto* data=_(container).data();
+            const auto& operand=unwrap_object(_(val));
+            return hana::eval_if(
+                hana::is_a<interval_tag,operand_type>,
+                [&](auto&& _)
+                {
+                    return validate_range_chunks(_(container).size(),threads,_(any),
+                        [&](size_t from, size_t to, const std::atomic<bool>* stop)
+                        {
+                            return validate_interval_blocks(data+from,to-from,_(op),_(operand),_(any),stop);
+                        }
+                    );
+                },
+                [&](auto&& _)
+                {
+                    return validate_range_chunks(_(container).size(),threads,_(any),
+                        [&](size_t from, size_t to, const std::atomic<bool>* stop)
+                        {
+                            return validate_range_blocks(data+from,to-from,
+                                        [&](const element_type& a){return _(op)(a,operand);},
+                                        _(any),
+                                        stop
+                                   );
+                        }
+                    );
+                }
+            );
+        },
+        [&](auto&& _)
+        {
+            return hana::eval_if(
+                is_random_access_container<ContainerT>{},
+                [&](auto&& _)
+                {
+                    auto begin=std::begin(_(container));
+                    using difference_type=typename std::iterator_traits<decltype(begin)>::difference_type;
+                    return validate_range_chunks(static_cast<size_t>(std::distance(begin,std::end(_(container)))),threads,_(any),
+                        [&](size_t from, size_t to, const std::atomic<bool>* stop)
+                        {
+                            return validate_range_elements(begin+static_cast<difference_type>(from),begin+static_cast<difference_type>(to),
+                                                           _(prop),_(op),_(val),_(any),stop);
+                        }
+                    );
+                },
+                [&](auto&& _)
+                {
+                    return validate_range_elements(std::begin(_(container)),std::end(_(container)),_(prop),_(op),_(val),_(any));
+                }
+            );
+        }
+    );
+}
+
+}
+
+HATN_VALIDATOR_NAMESPACE_END
+
+#endif // HATN_VALIDATOR_VALIDATE_RANGE_HPP
@@ -19,6 +19,8 @@ Distributed under the Boost Software License, Version 1.0.
 #ifndef HATN_VALIDATOR_FILTER_PATH_HPP
 #define HATN_VALIDATOR_FILTER_PATH_HPP
 
+#include <functional>
+
 #include <hatn/validator/config.hpp>
 #include <hatn/validator/utils/conditional_fold.hpp>
 #include <hatn/validator/check_member_path.hpp>
@@ -27,6 +29,7 @@ Distributed under the Boost Software License, Version 1.0.
 HATN_VALIDATOR_NAMESPACE_BEGIN
 
 struct filter_path_tag{};
+struct filter_path_index_tag{};
 
 //-------------------------------------------------------------
 
@@ -83,7 +86,21 @@ constexpr path_starts_with_impl path_starts_with{};
 struct has_path_impl
 {
     template <typename T1, typename T2>
-    constexpr bool operator() (const T1& path_ts, const T2& path) const
+    bool operator() (const T1& index, const T2& path,
+                     std::enable_if_t<std::is_base_of<filter_path_index_tag,T1>::value,void*> =nullptr) const
+    {
+        return index.has_path(path);
+    }
+
+    template <typename T1, typename T2>
+    bool operator() (const std::reference_wrapper<T1>& index, const T2& path) const
+    {
+        return index.get().has_path(path);
+    }
+
+    template <typename T1, typename T2>
+    constexpr bool operator() (const T1& path_ts, const T2& path,
+                               std::enable_if_t<!std::is_base_of<filter_path_index_tag,T1>::value,void*> =nullptr) const
     {
         return while_each(
             path_ts,
@@ -98,7 +115,7 @@ struct has_path_impl
 };
 /**
  * @brief Check if foldable container of paths contains certain path.
- * @param path_ts COntainer of paths.
+ * @param path_ts Container of paths or index of paths.
  * @param path Path to test.
  * @return Boolean result.
  */
@@ -106,6 +123,74 @@ constexpr has_path_impl has_path{};
 
 //-------------------------------------------------------------
 
+/**
+ * @brief Implementer of paths_empty().
+ */
+struct paths_empty_impl
+{
+    template <typename T>
+    bool operator() (const T& index,
+                     std::enable_if_t<std::is_base_of<filter_path_index_tag,T>::value,void*> =nullptr) const noexcept
+    {
+        return index.empty();
+    }
+
+    template <typename T>
+    bool operator() (const std::reference_wrapper<T>& index) const noexcept
+    {
+        return index.get().empty();
+    }
+
+    template <typename T>
+    constexpr bool operator() (const T& path_ts,
+                               std::enable_if_t<!std::is_base_of<filter_path_index_tag,T>::value,void*> =nullptr) const noexcept
+    {
+        return hana::is_empty(path_ts);
+    }
+};
+/**
+ * @brief Check if container of paths or index of paths is empty.
+ * @param path_ts Container of paths or index of paths.
+ * @return Boolean result.
+ */
+constexpr paths_empty_impl paths_empty{};
+
+//-------------------------------------------------------------
+
+namespace detail
+{
+
+/**
+ * @brief Type of paths stored in filtering adapter.
+ *
+ * Lists of paths are copied, while an index of paths is referred to if it is passed as lvalue,
+ * so that the index is not copied each time an adapter is constructed.
+ */
+template <typename PathsT, typename=hana::when<true>>
+struct filter_paths_storage
+{
+    using type=std::decay_t<PathsT>;
+};
+
+template <typename PathsT>
+struct filter_paths_storage<PathsT,
+            hana::when<
+                std::is_lvalue_reference<PathsT>::value
+                &&
+                std::is_base_of<filter_path_index_tag,std::decay_t<PathsT>>::value
+            >
+        >
+{
+    using type=std::reference_wrapper<const std::decay_t<PathsT>>;
+};
+
+template <typename PathsT>
+using filter_paths_storage_t=typename filter_paths_storage<PathsT>::type;
+
+}
+
+//-------------------------------------------------------------
+
 /**
  * @brief Adapter traits for member filtering adapter.
  *
@@ -144,14 +229,20 @@ class filter_path_traits : public BaseTraitsT,
          * @param Original adapter traits.
          * @param include_paths Included paths.
          */
-        template <typename BaseTraitsT1>
+        template <typename BaseTraitsT1, typename PathsT,
+                  typename =std::enable_if_t<
+                      std::is_same<std::decay_t<PathsT>,IncludePathsT>::value
+                      &&
+                      !std::is_same<IncludePathsT,ExcludePathsT>::value
+                  >
+                 >
         filter_path_traits(
                 BaseTraitsT1&& traits,
-                IncludePathsT include_paths
+                PathsT&& include_paths
             )
             : filter_path_traits(
                   std::forward<BaseTraitsT1>(traits),
-                  std::move(include_paths),
+                  std::forward<PathsT>(include_paths),
                   ExcludePathsT()
               )
         {}
@@ -161,15 +252,22 @@ class filter_path_traits : public BaseTraitsT,
          * @param Original adapter traits.
          * @param exclude_paths Excluded paths.
          */
-        template <typename BaseTraitsT1>
+        template <typename BaseTraitsT1, typename PathsT,
+                  typename =std::enable_if_t<
+                      std::is_same<std::decay_t<PathsT>,ExcludePathsT>::value
+                      &&
+                      !std::is_same<IncludePathsT,ExcludePathsT>::value
+                  >,
+                  typename =void
+                 >
         filter_path_traits(
                 BaseTraitsT1&& traits,
-                ExcludePathsT exclude_paths
+                PathsT&& exclude_paths
             )
             : filter_path_traits(
                   std::forward<BaseTraitsT1>(traits),
                   IncludePathsT(),
-                  std::move(exclude_paths)
+                  std::forward<PathsT>(exclude_paths)
               )
         {}
 
@@ -181,7 +279,7 @@ class filter_path_traits : public BaseTraitsT,
         template <typename PathT>
         bool filter(const PathT& path) const noexcept
         {
-            bool included=hana::is_empty(_include_paths)
+            bool included=paths_empty(_include_paths)
                     || has_path(_include_paths,path);
 
             return !(included && !has_path(_exclude_paths,path));
@@ -232,7 +330,7 @@ constexpr filter_path_impl filter_path{};
 /**
  * @brief Helper for building filtering adapter with explicit list of included paths.
  * @param adapter Original validation adapter.
- * @param paths Container with list of explicitly included paths.
+ * @param paths Container with list of explicitly included paths or index of paths made with make_filter_path_index(), index passed as lvalue must outlive the adapter.
  * @return Member filtering adapter.
  */
 template <typename AdapterT, typename PathsT>
@@ -240,9 +338,11 @@ auto include_paths(AdapterT adapter, PathsT&& paths)
 {
     auto create=[&](auto traits)
     {
-        return filter_path_traits<std::decay_t<decltype(traits)>,std::decay_t<PathsT>,std::tuple<>>{
+        using paths_type=detail::filter_paths_storage_t<PathsT>;
+        return filter_path_traits<std::decay_t<decltype(traits)>,paths_type,std::tuple<>>{
             std::move(traits),
-            std::forward<PathsT>(paths)
+            paths_type(std::forward<PathsT>(paths)),
+            std::tuple<>()
         };
     };
     return adapter.clone(create);
@@ -253,7 +353,7 @@ auto include_paths(AdapterT adapter, PathsT&& paths)
 /**
  * @brief Helper for building filtering adapter with explicit list of excluded paths.
  * @param adapter Original validation adapter.
- * @param paths Container with list of explicitly excluded paths.
+ * @param paths Container with list of explicitly excluded paths or index of paths made with make_filter_path_index(), index passed as lvalue must outlive the adapter.
  * @return Member filtering adapter.
  */
 template <typename AdapterT, typename PathsT>
@@ -261,9 +361,11 @@ auto exclude_paths(AdapterT adapter, PathsT&& paths)
 {
     auto create=[&](auto traits)
     {
-        return filter_path_traits<std::decay_t<decltype(traits)>,std::tuple<>,std::decay_t<PathsT>>{
+        using paths_type=detail::filter_paths_storage_t<PathsT>;
+        return filter_path_traits<std::decay_t<decltype(traits)>,std::tuple<>,paths_type>{
             std::move(traits),
-            std::forward<PathsT>(paths)
+            std::tuple<>(),
+            paths_type(std::forward<PathsT>(paths))
         };
     };
     return adapter.clone(create);
@@ -274,19 +376,23 @@ auto exclude_paths(AdapterT adapter, PathsT&& paths)
 /**
  * @brief Helper for building filtering adapter with explicit lists of included and excluded paths.
  * @param adapter Original validation adapter.
- * @param in_paths Container with list of explicitly included paths.
- * @param ex_paths Container with list of explicitly excluded paths.
+ * @param in_paths Container with list of explicitly included paths or index of paths.
+ * @param ex_paths Container with list of explicitly excluded paths or index of paths.
  * @return Member filtering adapter.
+ *
+ * Index of paths passed as lvalue is not copied and must outlive the adapter.
  */
 template <typename AdapterT, typename InPathsT, typename ExPathsT>
 auto include_and_exclude_paths(AdapterT adapter, InPathsT&& in_paths, ExPathsT&& ex_paths)
 {
     auto create=[&](auto traits)
     {
-        return filter_path_traits<std::decay_t<decltype(traits)>,std::decay_t<InPathsT>,std::decay_t<ExPathsT>>{
+        using in_paths_type=detail::filter_paths_storage_t<InPathsT>;
+        using ex_paths_type=detail::filter_paths_storage_t<ExPathsT>;
+        return filter_path_traits<std::decay_t<decltype(traits)>,in_paths_type,ex_paths_type>{
             std::move(traits),
-            std::forward<InPathsT>(in_paths),
-            std::forward<ExPathsT>(ex_paths)
+            in_paths_type(std::forward<InPathsT>(in_paths)),
+            ex_paths_type(std::forward<ExPathsT>(ex_paths))
         };
     };
     return adapter.clone(create);
@@ -0,0 +1,544 @@
+/**
+@copyright Evgeny Sidorov 2020
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+*/
+
+/****************************************************************************/
+
+/** @file validator/filter_path_index.hpp
+*
+*  Defines index of paths for filtering members in partial validation.
+*
+*/
+
+/****************************************************************************/
+
+#ifndef HATN_VALIDATOR_FILTER_PATH_INDEX_HPP
+#define HATN_VALIDATOR_FILTER_PATH_INDEX_HPP
+
+#include <cstdint>
+#include <array>
+#include <string>
+#include <vector>
+#include <limits>
+#include <type_traits>
+
+#include <hatn/validator/config.hpp>
+#include <hatn/validator/validator.hpp>
+#include <hatn/validator/filter_path.hpp>
+#include <hatn/validator/static_key.hpp>
+#include <hatn/validator/variadic_arg_tag.hpp>
+#include <hatn/validator/utils/string_view.hpp>
+#include <hatn/validator/utils/unwrap_object.hpp>
+
+HATN_VALIDATOR_NAMESPACE_BEGIN
+
+struct wrap_iterator_tag;
+struct wrap_index_tag;
+struct element_aggregation_tag;
+struct tree_tag;
+
+template <size_t Index, typename AggregationT>
+struct wrap_heterogeneous_index_t;
+
+//-------------------------------------------------------------
+
+namespace detail
+{
+
+/**
+ * @brief Check if key of member's path matches any key.
+ */
+template <typename KeyT, typename=hana::when<true>>
+struct is_path_wildcard : public std::false_type
+{
+};
+
+/**
+ * @brief Keys of element aggregations, trees and variadic arguments match any key.
+ */
+template <typename KeyT>
+struct is_path_wildcard<KeyT,
+            hana::when<
+                hana::is_a<wrap_iterator_tag,KeyT>
+                ||
+                hana::is_a<wrap_index_tag,KeyT>
+                ||
+                hana::is_a<element_aggregation_tag,KeyT>
+                ||
+                hana::is_a<tree_tag,KeyT>
+                ||
+                std::is_base_of<variadic_arg_tag,KeyT>::value
+            >
+        > : public std::true_type
+{
+};
+
+/**
+ * @brief Indexes of elements of heterogeneous containers match any key.
+ */
+template <size_t Index, typename AggregationT>
+struct is_path_wildcard<wrap_heterogeneous_index_t<Index,AggregationT>> : public std::true_type
+{
+};
+
+/**
+ * @brief Kind of segment of member's path.
+ */
+enum class path_segment_kind : uint8_t
+{
+    wildcard,
+    string,
+    integer,
+    negative_integer,
+    property,
+    other
+};
+
+/**
+ * @brief Runtime representation of a key in member's path used for lookups in path index.
+ *
+ * Strings are referenced, names of properties and string representations of other keys are kept in storage.
+ */
+struct path_segment
+{
+    path_segment_kind kind=path_segment_kind::other;
+    bool owns=false;
+    uint64_t number=0;
+    string_view str;
+    std::string storage;
+
+    string_view text() const noexcept
+    {
+        return owns ? string_view(storage) : str;
+    }
+
+    size_t hash() const noexcept
+    {
+        if (kind==path_segment_kind::integer || kind==path_segment_kind::negative_integer)
+        {
+            return static_cast<size_t>(number*1099511628211ull)^static_cast<size_t>(kind);
+        }
+        auto t=text();
+        return static_cast<size_t>(string_hash(t))^static_cast<size_t>(kind);
+    }
+
+    bool operator == (const path_segment& other) const noexcept
+    {
+        return kind==other.kind && number==other.number && text()==other.text();
+    }
+};
+
+/**
+ * @brief Default helper for making path segment from a key, key is converted to string.
+ */
+template <typename T, typename=hana::when<true>>
+struct make_path_segment_t
+{
+    void operator () (const T& key, path_segment& segment) const
+    {
+        segment.kind=path_segment_kind::other;
+        segment.owns=true;
+        segment.storage=to_string(key);
+    }
+};
+
+/**
+ * @brief Make path segment from keys of element aggregations, trees and variadic arguments that match any key.
+ */
+template <typename T>
+struct make_path_segment_t<T,hana::when<is_path_wildcard<T>::value>>
+{
+    void operator () (const T&, path_segment& segment) const noexcept
+    {
+        segment.kind=path_segment_kind::wildcard;
+    }
+};
+
+/**
+ * @brief Make path segment from property.
+ */
+template <typename T>
+struct make_path_segment_t<T,hana::when<!is_path_wildcard<T>::value && hana::is_a<property_tag,T>>>
+{
+    void operator () (const T& key, path_segment& segment) const
+    {
+        segment.kind=path_segment_kind::property;
+        segment.owns=true;
+        segment.storage=std::string(key.name());
+    }
+};
+
+/**
+ * @brief Make path segment from string key.
+ */
+template <typename T>
+struct make_path_segment_t<T,hana::when<
+            !is_path_wildcard<T>::value
+            &&
+            !hana::is_a<property_tag,T>
+            &&
+            std::is_convertible<const T&,string_view>::value
+        >>
+{
+    void operator () (const T& key, path_segment& segment) const noexcept
+    {
+        segment.kind=path_segment_kind::string;
+        segment.str=string_view(key);
+    }
+};
+
+/**
+ * @brief Make path segment from integral or enum key.
+ */
+template <typename T>
+struct make_path_segment_t<T,hana::when<
+            !is_path_wildcard<T>::value
+            &&
+            !hana::is_a<property_tag,T>
+            &&
+            (std::is_integral<T>::value || std::is_enum<T>::value)
+        >>
+{
+    void operator () (const T& key, path_segment& segment) const noexcept
+    {
+        set(key,segment,std::is_enum<T>{});
+    }
+
+    private:
+
+        template <typename T1>
+        static void set(const T1& key, path_segment& segment, std::true_type) noexcept
+        {
+            using type=std::underlying_type_t<T1>;
+            set(static_cast<type>(key),segment,std::false_type{});
+        }
+
+        template <typename T1>
+        static void set(const T1& key, path_segment& segment, std::false_type) noexcept
+        {
+            if (key<T1(0))
+            {
+                segment.kind=path_segment_kind::negative_integer;
+                segment.number=static_cast<uint64_t>(static_cast<int64_t>(key));
+            }
+            else
+            {
+                segment.kind=path_segment_kind::integer;
+                segment.number=static_cast<uint64_t>(key);
+            }
+        }
+};
+
+/**
+ * @brief Make path segment from a key of member's path.
+ * @param key Key.
+ * @param segment Segment to fill.
+ */
+template <typename T>
+void make_path_segment(const T& key, path_segment& segment)
+{
+    const auto& k=unwrap_object(key);
+    make_path_segment_t<std::decay_t<decltype(k)>>{}(k,segment);
+}
+
+}
+
+//-------------------------------------------------------------
+
+/**
+ * @brief Index of members' paths for fast filtering of members in partial validation.
+ *
+ * Index is a trie whose edges are keys of paths' segments stored in a hash table.
+ * It is built once from a list of paths and then can be used instead of the list
+ * in include_paths(), exclude_paths() and include_and_exclude_paths().
+ * Checking if a path starts with one of the paths from the index takes O(depth) time
+ * regardless of the number of paths in the index.
+ *
+ * The semantics is the same as for lists of paths. Keys of element aggregations ALL and ANY,
+ * trees and variadic arguments match any key. String keys of different types are equal
+ * if they have the same characters, integral keys are compared by values.
+ * Keys of other types are compared by their string representations.
+ */
+class filter_path_index : public filter_path_index_tag
+{
+    public:
+
+        /**
+         * @brief Default constructor of empty index.
+         */
+        filter_path_index()
+        {
+            _nodes.emplace_back();
+        }
+
+        /**
+         * @brief Constructor.
+         * @param paths List of paths, e.g. member_path_list(_["field1"],_["field2"]["field3"]), or a container of paths.
+         */
+        template <typename PathsT>
+        explicit filter_path_index(const PathsT& paths) : filter_path_index()
+        {
+            add_paths(paths,hana::is_a<hana::tuple_tag,PathsT>);
+        }
+
+        /**
+         * @brief Add path to the index.
+         * @param path Path of member.
+         */
+        template <typename PathT>
+        void add(const PathT& path)
+        {
+            uint32_t node=0;
+            detail::path_segment segment;
+            hana::for_each(path,
+                [&](auto&& key)
+                {
+                    segment=detail::path_segment();
+                    detail::make_path_segment(key,segment);
+                    node=add_edge(node,std::move(segment));
+                }
+            );
+            _nodes[node].terminal=true;
+            ++_size;
+        }
+
+        /**
+         * @brief Get number of paths added to the index.
+         * @return Number of paths.
+         */
+        size_t size() const noexcept
+        {
+            return _size;
+        }
+
+        /**
+         * @brief Check if index is empty.
+         * @return True if no paths were added.
+         */
+        bool empty() const noexcept
+        {
+            return _size==0;
+        }
+
+        /**
+         * @brief Check if path starts with one of the paths from the index.
+         * @param path Path to test.
+         * @return Boolean result.
+         */
+        template <typename PathT>
+        bool has_path(const PathT& path) const
+        {
+            constexpr size_t depth=decltype(hana::size(path))::value;
+            std::array<detail::path_segment,depth> segments;
+            size_t i=0;
+            hana::for_each(path,
+                [&](auto&& key)
+                {
+                    detail::make_path_segment(key,segments[i++]);
+                }
+            );
+            return match(0,segments.data(),depth);
+        }
+
+    private:
+
+        constexpr static const uint32_t npos=(std::numeric_limits<uint32_t>::max)();
+
+        struct node
+        {
+            bool terminal=false;
+            uint32_t wildcard=npos;
+            std::vector<uint32_t> children;
+        };
+
+        struct edge
+        {
+            size_t hash=0;
+            uint32_t parent=npos;
+            uint32_t child=npos;
+            detail::path_segment segment;
+        };
+
+        template <typename PathsT>
+        void add_paths(const PathsT& paths, hana::true_)
+        {
+            hana::for_each(paths,
+                [this](auto&& path)
+                {
+                    add(path);
+                }
+            );
+        }
+
+        template <typename PathsT>
+        void add_paths(const PathsT& paths, hana::false_)
+        {
+            for (auto&& path : paths)
+            {
+                add(path);
+            }
+        }
+
+        static size_t edge_hash(uint32_t parent, const detail::path_segment& segment) noexcept
+        {
+            auto h=segment.hash();
+            return h^(static_cast<size_t>(parent)+0x9e3779b97f4a7c15ull+(h<<6)+(h>>2));
+        }
+
+        uint32_t find_edge(uint32_t parent, const detail::path_segment& segment) const noexcept
+        {
+            if (_edges.empty())
+            {
+                return npos;
+            }
+            auto h=edge_hash(parent,segment);
+            auto mask=_edges.size()-1;
+            for (auto i=h&mask;;i=(i+1)&mask)
+            {
+                const auto& e=_edges[i];
+                if (e.child==npos)
+                {
+                    return npos;
+                }
+                if (e.hash==h && e.parent==parent && e.segment==segment)
+                {
+                    return e.child;
+                }
+            }
+        }
+
+        void insert_edge(edge&& e)
+        {
+            auto mask=_edges.size()-1;
+            for (auto i=e.hash&mask;;i=(i+1)&mask)
+            {
+                if (_edges[i].child==npos)
+                {
+                    _edges[i]=std::move(e);
+                    return;
+                }
+            }
+        }
+
+        void rehash()
+        {
+            std::vector<edge> edges(_edges.empty() ? 16 : _edges.size()*2);
+            std::swap(edges,_edges);
+            for (auto&& e : edges)
+            {
+                if (e.child!=npos)
+                {
+                    insert_edge(std::move(e));
+                }
+            }
+        }
+
+        uint32_t add_edge(uint32_t parent, detail::path_segment&& segment)
+        {
+            if (segment.kind==detail::path_segment_kind::wildcard)
+            {
+                if (_nodes[parent].wildcard==npos)
+                {
+                    auto child=add_node(parent);
+                    _nodes[parent].wildcard=child;
+                }
+                return _nodes[parent].wildcard;
+            }
+
+            auto child=find_edge(parent,segment);
+            if (child!=npos)
+            {
+                return child;
+            }
+
+            // keep load factor of hash table not greater than 1/2
+            if ((_edges_count+1)*2>_edges.size())
+            {
+                rehash();
+            }
+            if (!segment.owns)
+            {
+                // keep a copy of the key because paths may not outlive the index
+                segment.storage=std::string(segment.str.data(),segment.str.size());
+                segment.owns=true;
+                segment.str=string_view();
+            }
+            edge e;
+            e.hash=edge_hash(parent,segment);
+            e.parent=parent;
+            e.child=add_node(parent);
+            e.segment=std::move(segment);
+            child=e.child;
+            insert_edge(std::move(e));
+            ++_edges_count;
+            return child;
+        }
+
+        uint32_t add_node(uint32_t parent)
+        {
+            auto index=static_cast<uint32_t>(_nodes.size());
+            _nodes.emplace_back();
+            _nodes[parent].children.push_back(index);
+            return index;
+        }
+
+        bool match(uint32_t index, const detail::path_segment* segments, size_t count) const
+        {
+            const auto& n=_nodes[index];
+            if (n.terminal)
+            {
+                return true;
+            }
+            if (count==0)
+            {
+                return false;
+            }
+
+            const auto& segment=segments[0];
+            if (segment.kind==detail::path_segment_kind::wildcard)
+            {
+                // key of aggregation in the path matches any key in the index
+                for (auto child : n.children)
+                {
+                    if (match(child,segments+1,count-1))
+                    {
+                        return true;
+                    }
+                }
+                return false;
+            }
+
+            if (n.wildcard!=npos && match(n.wildcard,segments+1,count-1))
+            {
+                return true;
+            }
+            auto child=find_edge(index,segment);
+            return child!=npos && match(child,segments+1,count-1);
+        }
+
+        std::vector<node> _nodes;
+        std::vector<edge> _edges;
+        size_t _edges_count=0;
+        size_t _size=0;
+};
+
+/**
+ * @brief Make index of paths for filtering members.
+ * @param paths List of paths, e.g. member_path_list(_["field1"],_["field2"]["field3"]), or a container of paths.
+ * @return Index of paths.
+ */
+template <typename PathsT>
+filter_path_index make_filter_path_index(const PathsT& paths)
+{
+    return filter_path_index(paths);
+}
+
+//-------------------------------------------------------------
+
+HATN_VALIDATOR_NAMESPACE_END
+
+#endif // HATN_VALIDATOR_FILTER_PATH_INDEX_HPP
@@ -0,0 +1,319 @@
+/**
+@copyright Evgeny Sidorov 2020
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+*/
+
+/****************************************************************************/
+
+/** @file validator/incremental_validator.hpp
+*
+*  Defines "incremental_validator" that revalidates only conditions depending on changed members.
+*
+*/
+
+/****************************************************************************/
+
+#ifndef HATN_VALIDATOR_INCREMENTAL_VALIDATOR_HPP
+#define HATN_VALIDATOR_INCREMENTAL_VALIDATOR_HPP
+
+#include <string>
+#include <vector>
+#include <map>
+#include <algorithm>
+
+#include <hatn/validator/config.hpp>
+#include <hatn/validator/status.hpp>
+#include <hatn/validator/error.hpp>
+#include <hatn/validator/validator.hpp>
+#include <hatn/validator/changed_paths.hpp>
+#include <hatn/validator/adapters/dependency_tracking_adapter.hpp>
+
+HATN_VALIDATOR_NAMESPACE_BEGIN
+
+//-------------------------------------------------------------
+
+/**
+ * @brief Validator that caches validation results of its nodes and revalidates only nodes affected by changed members.
+ *
+ * Each node is a separate validator. Results of nodes are joined with logical AND.
+ * When a node is validated the paths of members it reads are recorded in a dependency index that maps member paths
+ * to the nodes. On revalidation the index is used to find the nodes that depend on changed members,
+ * only those nodes are validated again while results of the rest nodes are taken from cache.
+ *
+ * A node depends on a changed path if the node reads the changed member, any member nested into the changed member
+ * or any parent of the changed member. Element aggregations make a node depend on the whole container.
+ *
+ * @note Incremental validator keeps state of the last validation, so it must be used with the same object
+ * and changes of that object must be reported to revalidate(). Nodes that use master_sample must be revalidated explicitly
+ * with changed_paths::add_object() when the sample changes.
+ */
+template <typename NodesT>
+class incremental_validator
+{
+    public:
+
+        /**
+         * @brief Constructor.
+         * @param nodes Tuple of validators.
+         */
+        explicit incremental_validator(NodesT nodes)
+            : _nodes(std::move(nodes)),
+              _states(hana::value(hana::length(_nodes))),
+              _validated(false)
+        {}
+
+        /**
+         * @brief Validate all nodes of object.
+         * @param obj Object to validate.
+         * @return Validation status.
+         */
+        template <typename ObjectT>
+        status apply(const ObjectT& obj)
+        {
+            std::vector<bool> selected(_states.size(),true);
+            validate_nodes(obj,selected);
+            _validated=true;
+            return result().first;
+        }
+
+        /**
+         * @brief Validate all nodes of object with validation result put in the last argument.
+         * @param obj Object to validate.
+         * @param err Validation result.
+         */
+        template <typename ObjectT>
+        void apply(const ObjectT& obj, error_report& err)
+        {
+            apply(obj);
+            make_error(err);
+        }
+
+        /**
+         * @brief Revalidate nodes that depend on changed members.
+         * @param obj Object to validate.
+         * @param changes Paths of changed members.
+         * @return Validation status of all nodes.
+         *
+         * If the object was not validated yet then all nodes are validated.
+         */
+        template <typename ObjectT>
+        status revalidate(const ObjectT& obj, const changed_paths& changes)
+        {
+            if (!_validated)
+            {
+                return apply(obj);
+            }
+            validate_nodes(obj,affected_nodes(changes));
+            return result().first;
+        }
+
+        /**
+         * @brief Revalidate nodes that depend on changed members with validation result put in the last argument.
+         * @param obj Object to validate.
+         * @param changes Paths of changed members.
+         * @param err Validation result.
+         */
+        template <typename ObjectT>
+        void revalidate(const ObjectT& obj, const changed_paths& changes, error_report& err)
+        {
+            revalidate(obj,changes);
+            make_error(err);
+        }
+
+        /**
+         * @brief Find nodes that depend on changed members.
+         * @param changes Paths of changed members.
+         * @return Flags of affected nodes.
+         */
+        std::vector<bool> affected_nodes(const changed_paths& changes) const
+        {
+            std::vector<bool> selected(_states.size(),false);
+            auto select=[&selected](const std::vector<size_t>& nodes)
+            {
+                for (auto&& node : nodes)
+                {
+                    selected[node]=true;
+                }
+            };
+
+            for (auto&& path : changes.paths())
+            {
+                // members nested into the changed member and the member itself
+                for (auto it=_index.lower_bound(path);
+                     it!=_index.end() && it->first.compare(0,path.size(),path)==0;
+                     ++it)
+                {
+                    if (is_same_or_parent_path(path,it->first))
+                    {
+                        select(it->second);
+                    }
+                }
+
+                // parents of the changed member
+                if (path.empty())
+                {
+                    continue;
+                }
+                auto root=_index.find(std::string());
+                if (root!=_index.end())
+                {
+                    select(root->second);
+                }
+                for (auto pos=path.find('.');pos!=std::string::npos;pos=path.find('.',pos+1))
+                {
+                    auto it=_index.find(path.substr(0,pos));
+                    if (it!=_index.end())
+                    {
+                        select(it->second);
+                    }
+                }
+            }
+
+            return selected;
+        }
+
+        /**
+         * @brief Get paths of members a node depends on.
+         * @param node Index of the node.
+         * @return Sorted list of paths.
+         */
+        const std::vector<std::string>& dependencies(size_t node) const
+        {
+            return _states.at(node).dependencies;
+        }
+
+        /**
+         * @brief Get number of nodes.
+         * @return Number of nodes.
+         */
+        size_t size() const noexcept
+        {
+            return _states.size();
+        }
+
+        /**
+         * @brief Forget cached results and dependencies.
+         */
+        void reset()
+        {
+            for (auto&& state : _states)
+            {
+                state=node_state();
+            }
+            _index.clear();
+            _validated=false;
+        }
+
+    private:
+
+        struct node_state
+        {
+            status result;
+            std::string report;
+            std::vector<std::string> dependencies;
+        };
+
+        template <typename ObjectT>
+        void validate_nodes(const ObjectT& obj, const std::vector<bool>& selected)
+        {
+            size_t i=0;
+            hana::for_each(_nodes,
+                [&](const auto& node)
+                {
+                    if (selected[i])
+                    {
+                        validate_node(obj,i,node);
+                    }
+                    ++i;
+                }
+            );
+        }
+
+        template <typename ObjectT, typename NodeT>
+        void validate_node(const ObjectT& obj, size_t i, const NodeT& node)
+        {
+            auto& state=_states[i];
+            unindex(i);
+
+            member_dependencies dependencies;
+            state.report.clear();
+            state.result=node.apply(make_dependency_tracking_adapter(dependencies,obj,state.report));
+            state.dependencies=dependencies.paths();
+
+            for (auto&& path : state.dependencies)
+            {
+                _index[path].push_back(i);
+            }
+        }
+
+        void unindex(size_t i)
+        {
+            for (auto&& path : _states[i].dependencies)
+            {
+                auto it=_index.find(path);
+                if (it!=_index.end())
+                {
+                    auto& nodes=it->second;
+                    nodes.erase(std::remove(nodes.begin(),nodes.end(),i),nodes.end());
+                    if (nodes.empty())
+                    {
+                        _index.erase(it);
+                    }
+                }
+            }
+        }
+
+        std::pair<status,const node_state*> result() const
+        {
+            for (auto&& state : _states)
+            {
+                if (!state.result)
+                {
+                    return std::make_pair(state.result,&state);
+                }
+            }
+            return std::make_pair(status(),nullptr);
+        }
+
+        void make_error(error_report& err) const
+        {
+            auto res=result();
+            if (res.second==nullptr)
+            {
+                err=error_report();
+            }
+            else
+            {
+                err=error_report(res.first,res.second->report);
+            }
+        }
+
+        NodesT _nodes;
+        std::vector<node_state> _states;
+        std::map<std::string,std::vector<size_t>> _index;
+        bool _validated;
+};
+
+/**
+ * @brief Create incremental validator.
+ * @param nodes Validators or validation conditions each of which is a separate node of incremental validator.
+ * @return Incremental validator.
+ *
+ * For example, make_incremental_validator(_["field1"](gte,1),_["field2"](lt,_["field1"])) creates a validator with two nodes,
+ * the first node depends on "field1" and the second node depends on both "field1" and "field2".
+ */
+template <typename ...Args>
+auto make_incremental_validator(Args&&... nodes)
+{
+    auto ns=hana::make_tuple(validator(std::forward<Args>(nodes))...);
+    return incremental_validator<decltype(ns)>(std::move(ns));
+}
+
+//-------------------------------------------------------------
+
+HATN_VALIDATOR_NAMESPACE_END
+
+#endif // HATN_VALIDATOR_INCREMENTAL_VALIDATOR_HPP
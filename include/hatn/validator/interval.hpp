@@ -19,6 +19,8 @@ Distributed under the Boost Software License, Version 1.0.
 #ifndef HATN_VALIDATOR_INTERVAL_HPP
 #define HATN_VALIDATOR_INTERVAL_HPP
 
+#include <string>
+
 #include <hatn/validator/config.hpp>
 #include <hatn/validator/utils/adjust_storable_type.hpp>
 #include <hatn/validator/utils/enable_to_string.hpp>
@@ -169,41 +171,57 @@ struct format_operand_t<T,hana::when<hana::is_a<interval_tag,T>>>
     template <typename TraitsT, typename T1>
     auto operator () (const TraitsT& traits, T1&& val, grammar_categories cats) const
     {
-        // format endpoints
-        auto from=format_operand<decltype(val.from)>(traits,val.from,false);
-        auto to=format_operand<decltype(val.to)>(traits,val.to,false);
-
-        // format braces
-        auto left=(val.mode==interval_mode::open || val.mode==interval_mode::open_from)?"(":"[";
-        auto right=(val.mode==interval_mode::open || val.mode==interval_mode::open_to)?")":"]";
-
-        // format interval definition
-        std::string dst;
-        backend_formatter.append(
-           dst,
-           left,
-           from,
-           ",",
-           to,
-           right
-        );
-
-        // decorate operand
-        auto formatted_operand=decorate(traits,std::move(dst));
-
-        // prepend description
-        auto descr=translate(traits,std::string(interval_str),cats);
-        std::string dst1;
-        backend_formatter.append(
-           dst1,
-           descr,
-           " ",
-           formatted_operand
+        return hana::eval_if(
+            detail::is_identity_postprocessing<TraitsT>{},
+            [&](auto&& _)
+            {
+                // neither translate nor decorate, format the whole operand in place
+                const char* descr=interval_str_t::description;
+                std::string dst;
+                backend_formatter.append(dst,descr," ");
+                append_interval(dst,_(traits),_(val));
+                return dst;
+            },
+            [&](auto&& _)
+            {
+                // format interval definition
+                std::string dst;
+                append_interval(dst,_(traits),_(val));
+
+                // decorate operand
+                auto formatted_operand=decorate(_(traits),std::move(dst));
+
+                // prepend description
+                auto descr=translate(_(traits),std::string(interval_str),cats);
+                std::string dst1;
+                backend_formatter.append(
+                   dst1,
+                   descr,
+                   " ",
+                   formatted_operand
+                );
+                return dst1;
+            }
         );
-
-        // done
-        return dst1;
     }
+
+    private:
+
+        /**
+         * @brief Append interval definition with braces to destination string.
+         * @param dst Destination string.
+         * @param traits Formatter traits.
+         * @param val Interval.
+         */
+        template <typename TraitsT, typename T1>
+        static void append_interval(std::string& dst, const TraitsT& traits, const T1& val)
+        {
+            dst.push_back((val.mode==interval_mode::open || val.mode==interval_mode::open_from)?'(':'[');
+            detail::append_operand_element<decltype(val.from)>(dst,traits,val.from);
+            dst.push_back(',');
+            detail::append_operand_element<decltype(val.to)>(dst,traits,val.to);
+            dst.push_back((val.mode==interval_mode::open || val.mode==interval_mode::open_to)?')':']');
+        }
 };
 
 //-------------------------------------------------------------
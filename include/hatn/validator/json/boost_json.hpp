@@ -0,0 +1,489 @@
+/**
+@copyright Evgeny Sidorov 2020
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+*/
+
+/****************************************************************************/
+
+/** @file validator/json/boost_json.hpp
+*
+*  Defines view of Boost.JSON DOM values to validate them without conversion to STL containers.
+*
+*/
+
+/****************************************************************************/
+
+#ifndef HATN_VALIDATOR_BOOST_JSON_HPP
+#define HATN_VALIDATOR_BOOST_JSON_HPP
+
+#include <cstdint>
+#include <iterator>
+
+#include <boost/json/value.hpp>
+#include <boost/json/object.hpp>
+#include <boost/json/array.hpp>
+
+#include <hatn/validator/config.hpp>
+#include <hatn/validator/utils/string_view.hpp>
+#include <hatn/validator/utils/safe_compare.hpp>
+#include <hatn/validator/utils/value_ordering.hpp>
+#include <hatn/validator/utils/get_it.hpp>
+
+HATN_VALIDATOR_NAMESPACE_BEGIN
+
+//-------------------------------------------------------------
+
+/**
+ * @brief Lightweight view of boost::json::value, boost::json::object or boost::json::array.
+ *
+ * The view has the interface expected by the validator:
+ *  - members of objects are looked up with contains(key) and at(key) using string_view keys without allocations;
+ *  - elements of arrays are accessed by index directly;
+ *  - begin() and end() iterate over values of objects and arrays, so element aggregations can be used,
+ *    keys modifier of aggregations gives names of objects' members;
+ *  - size() and empty() return size of string, array or object;
+ *  - values can be compared with numbers, strings, booleans and with other views.
+ *
+ * Values of different kinds are not comparable, so comparison operators return false for them and "!=" returns true.
+ * Missing members are represented by empty view that is not comparable with anything.
+ *
+ * The view does not own the document, the document must outlive the view.
+ */
+class json_value_view : public enable_value_ordering<json_value_view>
+{
+    public:
+
+        class const_iterator;
+        using iterator=const_iterator;
+
+        /**
+         * @brief Constructor of empty view.
+         */
+        json_value_view() noexcept : _value(nullptr),_object(nullptr),_array(nullptr)
+        {}
+
+        /**
+         * @brief Constructor from JSON value.
+         * @param value Value.
+         */
+        json_value_view(const boost::json::value& value) noexcept
+            : _value(&value),_object(value.if_object()),_array(value.if_array())
+        {}
+
+        /**
+         * @brief Constructor from JSON object.
+         * @param object Object.
+         */
+        json_value_view(const boost::json::object& object) noexcept
+            : _value(nullptr),_object(&object),_array(nullptr)
+        {}
+
+        /**
+         * @brief Constructor from JSON array.
+         * @param array Array.
+         */
+        json_value_view(const boost::json::array& array) noexcept
+            : _value(nullptr),_object(nullptr),_array(&array)
+        {}
+
+        /**
+         * @brief Check if view is empty, i.e. it refers to a missing member.
+         * @return Boolean result.
+         */
+        bool is_empty_view() const noexcept
+        {
+            return _value==nullptr && _object==nullptr && _array==nullptr;
+        }
+
+        /**
+         * @brief Check if value is null.
+         * @return Boolean result.
+         */
+        bool is_null() const noexcept
+        {
+            return _value!=nullptr && _value->is_null();
+        }
+
+        /**
+         * @brief Get JSON object.
+         * @return Pointer to object or nullptr if value is not an object.
+         */
+        const boost::json::object* if_object() const noexcept
+        {
+            return _object;
+        }
+
+        /**
+         * @brief Get JSON array.
+         * @return Pointer to array or nullptr if value is not an array.
+         */
+        const boost::json::array* if_array() const noexcept
+        {
+            return _array;
+        }
+
+        /**
+         * @brief Get JSON value.
+         * @return Pointer to value or nullptr if view was constructed from object or array.
+         */
+        const boost::json::value* if_value() const noexcept
+        {
+            return _value;
+        }
+
+        /**
+         * @brief Check if object has a member or array has an element.
+         * @param key Name of object's member.
+         * @return Boolean result.
+         */
+        template <typename T>
+        std::enable_if_t<std::is_constructible<string_view,T>::value && !std::is_integral<T>::value,bool>
+        contains(const T& key) const noexcept
+        {
+            return find_member(string_view(key))!=nullptr;
+        }
+
+        /**
+         * @brief Check if array has an element.
+         * @param index Index of element.
+         * @return Boolean result.
+         */
+        template <typename T>
+        std::enable_if_t<std::is_integral<T>::value && !std::is_same<T,bool>::value,bool>
+        contains(const T& index) const noexcept
+        {
+            return _array!=nullptr && index>=T(0) && safe_compare_less(index,_array->size());
+        }
+
+        /**
+         * @brief Get member of object.
+         * @param key Name of the member.
+         * @return View of member, empty view if member is not found.
+         */
+        template <typename T>
+        std::enable_if_t<std::is_constructible<string_view,T>::value && !std::is_integral<T>::value,json_value_view>
+        at(const T& key) const noexcept
+        {
+            auto val=find_member(string_view(key));
+            return val==nullptr ? json_value_view() : json_value_view(*val);
+        }
+
+        /**
+         * @brief Get element of array.
+         * @param index Index of the element.
+         * @return View of element, empty view if index is out of range.
+         */
+        template <typename T>
+        std::enable_if_t<std::is_integral<T>::value && !std::is_same<T,bool>::value,json_value_view>
+        at(const T& index) const noexcept
+        {
+            if (!contains(index))
+            {
+                return json_value_view();
+            }
+            return json_value_view((*_array)[static_cast<size_t>(index)]);
+        }
+
+        /**
+         * @brief Get iterator to the first value of object or array.
+         * @return Iterator, equal to end() for scalar values.
+         */
+        const_iterator begin() const noexcept;
+
+        /**
+         * @brief Get iterator past the last value of object or array.
+         * @return Iterator.
+         */
+        const_iterator end() const noexcept;
+
+        /**
+         * @brief Get size of string, object or array.
+         * @return Size or 0 for other values.
+         */
+        size_t size() const noexcept
+        {
+            if (_object!=nullptr)
+            {
+                return _object->size();
+            }
+            if (_array!=nullptr)
+            {
+                return _array->size();
+            }
+            if (_value!=nullptr)
+            {
+                auto str=_value->if_string();
+                if (str!=nullptr)
+                {
+                    return str->size();
+                }
+            }
+            return 0;
+        }
+
+        /**
+         * @brief Check if string, object or array is empty.
+         * @return Boolean result.
+         */
+        bool empty() const noexcept
+        {
+            return size()==0;
+        }
+
+    private:
+
+        friend class enable_value_ordering<json_value_view>;
+
+        const boost::json::value* find_member(string_view key) const noexcept
+        {
+            if (_object==nullptr)
+            {
+                return nullptr;
+            }
+            auto it=_object->find(boost::json::string_view(key.data(),key.size()));
+            if (it==_object->end())
+            {
+                return nullptr;
+            }
+            return &it->value();
+        }
+
+        template <typename T>
+        std::enable_if_t<std::is_arithmetic<T>::value && !std::is_same<T,bool>::value,value_ordering>
+        compare(const T& other) const noexcept
+        {
+            if (_value!=nullptr)
+            {
+                if (auto val=_value->if_int64())
+                {
+                    return compare_value_ordering(*val,other);
+                }
+                if (auto val=_value->if_uint64())
+                {
+                    return compare_value_ordering(*val,other);
+                }
+                if (auto val=_value->if_double())
+                {
+                    return compare_value_ordering(*val,other);
+                }
+            }
+            return value_ordering::unordered;
+        }
+
+        template <typename T>
+        std::enable_if_t<std::is_same<T,bool>::value,value_ordering>
+        compare(const T& other) const noexcept
+        {
+            if (_value!=nullptr)
+            {
+                if (auto val=_value->if_bool())
+                {
+                    return compare_value_ordering(*val,other);
+                }
+            }
+            return value_ordering::unordered;
+        }
+
+        template <typename T>
+        std::enable_if_t<std::is_constructible<string_view,T>::value && !std::is_arithmetic<T>::value,value_ordering>
+        compare(const T& other) const noexcept
+        {
+            if (_value!=nullptr)
+            {
+                if (auto val=_value->if_string())
+                {
+                    return compare_string_ordering(string_view(val->data(),val->size()),string_view(other));
+                }
+            }
+            return value_ordering::unordered;
+        }
+
+        value_ordering compare(const json_value_view& other) const noexcept
+        {
+            if (other._value!=nullptr)
+            {
+                if (auto val=other._value->if_int64())
+                {
+                    return compare(*val);
+                }
+                if (auto val=other._value->if_uint64())
+                {
+                    return compare(*val);
+                }
+                if (auto val=other._value->if_double())
+                {
+                    return compare(*val);
+                }
+                if (auto val=other._value->if_bool())
+                {
+                    return compare(*val);
+                }
+                if (auto val=other._value->if_string())
+                {
+                    return compare(string_view(val->data(),val->size()));
+                }
+                if (other._value->is_null() && is_null())
+                {
+                    return value_ordering::equal;
+                }
+            }
+            return value_ordering::unordered;
+        }
+
+        const boost::json::value* _value;
+        const boost::json::object* _object;
+        const boost::json::array* _array;
+};
+
+//-------------------------------------------------------------
+
+/**
+ * @brief Iterator over values of object or array.
+ *
+ * Dereferencing returns view of the value rather than a reference.
+ */
+class json_value_view::const_iterator
+{
+    public:
+
+        using iterator_category=std::forward_iterator_tag;
+        using value_type=json_value_view;
+        using difference_type=std::ptrdiff_t;
+        using pointer=void;
+        using reference=json_value_view;
+
+        const_iterator() noexcept : _array_it(nullptr),_object_it(nullptr)
+        {}
+
+        explicit const_iterator(const boost::json::value* it) noexcept : _array_it(it),_object_it(nullptr)
+        {}
+
+        explicit const_iterator(const boost::json::key_value_pair* it) noexcept : _array_it(nullptr),_object_it(it)
+        {}
+
+        json_value_view operator*() const noexcept
+        {
+            if (_object_it!=nullptr)
+            {
+                return json_value_view(_object_it->value());
+            }
+            return json_value_view(*_array_it);
+        }
+
+        /**
+         * @brief Get name of object's member.
+         * @return Name of member or empty string for elements of arrays.
+         */
+        string_view key() const noexcept
+        {
+            if (_object_it!=nullptr)
+            {
+                return string_view(_object_it->key().data(),_object_it->key().size());
+            }
+            return string_view();
+        }
+
+        const_iterator& operator++() noexcept
+        {
+            if (_object_it!=nullptr)
+            {
+                ++_object_it;
+            }
+            else
+            {
+                ++_array_it;
+            }
+            return *this;
+        }
+
+        const_iterator operator++(int) noexcept
+        {
+            auto tmp=*this;
+            ++(*this);
+            return tmp;
+        }
+
+        bool operator==(const const_iterator& other) const noexcept
+        {
+            return _array_it==other._array_it && _object_it==other._object_it;
+        }
+
+        bool operator!=(const const_iterator& other) const noexcept
+        {
+            return !(*this==other);
+        }
+
+    private:
+
+        const boost::json::value* _array_it;
+        const boost::json::key_value_pair* _object_it;
+};
+
+inline json_value_view::const_iterator json_value_view::begin() const noexcept
+{
+    if (_object!=nullptr)
+    {
+        return const_iterator(_object->begin());
+    }
+    if (_array!=nullptr)
+    {
+        return const_iterator(_array->begin());
+    }
+    return const_iterator();
+}
+
+inline json_value_view::const_iterator json_value_view::end() const noexcept
+{
+    if (_object!=nullptr)
+    {
+        return const_iterator(_object->end());
+    }
+    if (_array!=nullptr)
+    {
+        return const_iterator(_array->end());
+    }
+    return const_iterator();
+}
+
+/**
+ * @brief Helper for getting value from iterator of JSON view.
+ *
+ * Values are returned by value because iterator creates views on the fly.
+ */
+template <typename T>
+struct get_it_t<T,
+            hana::when<std::is_same<std::decay_t<T>,json_value_view::const_iterator>::value>
+        >
+{
+    template <typename T1>
+    auto operator() (T1&& it) const
+    {
+        return *it;
+    }
+
+    template <typename T1>
+    static auto key(T1&& it)
+    {
+        return it.key();
+    }
+};
+
+/**
+ * @brief Make view of Boost.JSON value, object or array for validation.
+ * @param value JSON value, object or array, it must outlive the view.
+ * @return View to pass to validator instead of the value.
+ */
+template <typename T>
+json_value_view json_view(const T& value) noexcept
+{
+    return json_value_view(value);
+}
+
+//-------------------------------------------------------------
+
+HATN_VALIDATOR_NAMESPACE_END
+
+#endif // HATN_VALIDATOR_BOOST_JSON_HPP
@@ -0,0 +1,107 @@
+/**
+@copyright Evgeny Sidorov 2020
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+*/
+
+/****************************************************************************/
+
+/** @file validator/json/json_key.hpp
+*
+*  Defines key of member's path in JSON document.
+*
+*/
+
+/****************************************************************************/
+
+#ifndef HATN_VALIDATOR_JSON_KEY_HPP
+#define HATN_VALIDATOR_JSON_KEY_HPP
+
+#include <string>
+#include <type_traits>
+
+#include <hatn/validator/config.hpp>
+#include <hatn/validator/utils/string_view.hpp>
+
+HATN_VALIDATOR_NAMESPACE_BEGIN
+
+//-------------------------------------------------------------
+
+/**
+ * @brief Key of member's path in JSON document.
+ *
+ * The key is either a name of object's member or an index of array's element.
+ * It can be compared with string keys and integral keys of validator's members, so that a path of JSON keys
+ * matches member paths of validator, e.g. path of JSON keys "field1",2 matches both _["field1"][2] and _["field1"][ALL].
+ */
+class json_key
+{
+    public:
+
+        /**
+         * @brief Constructor of key of object's member.
+         * @param name Name of the member, it must outlive the key.
+         */
+        explicit json_key(const std::string& name) noexcept : _name(&name),_index(0)
+        {}
+
+        /**
+         * @brief Constructor of key of array's element.
+         * @param index Index of the element.
+         */
+        explicit json_key(size_t index) noexcept : _name(nullptr),_index(index)
+        {}
+
+        bool is_index() const noexcept
+        {
+            return _name==nullptr;
+        }
+
+        string_view name() const noexcept
+        {
+            return is_index() ? string_view() : string_view(*_name);
+        }
+
+        size_t index() const noexcept
+        {
+            return _index;
+        }
+
+        template <typename T>
+        std::enable_if_t<std::is_constructible<string_view,T>::value && !std::is_integral<T>::value,bool>
+        operator == (const T& other) const
+        {
+            return !is_index() && name()==string_view(other);
+        }
+
+        template <typename T>
+        std::enable_if_t<std::is_integral<T>::value && !std::is_same<T,bool>::value,bool>
+        operator == (const T& other) const
+        {
+            return is_index() && other>=T(0) && static_cast<size_t>(other)==_index;
+        }
+
+        bool operator == (const json_key& other) const noexcept
+        {
+            return is_index() ? (other.is_index() && _index==other._index) : (other==name());
+        }
+
+        template <typename T>
+        auto operator != (const T& other) const -> decltype(!(*this==other))
+        {
+            return !(*this==other);
+        }
+
+    private:
+
+        const std::string* _name;
+        size_t _index;
+};
+
+//-------------------------------------------------------------
+
+HATN_VALIDATOR_NAMESPACE_END
+
+#endif // HATN_VALIDATOR_JSON_KEY_HPP
@@ -0,0 +1,472 @@
+/**
+@copyright Evgeny Sidorov 2020
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+*/
+
+/****************************************************************************/
+
+/** @file validator/json/json_sax_validator.hpp
+*
+*  Defines handler of SAX events of JSON parser that validates JSON document while it is being parsed.
+*
+*/
+
+/****************************************************************************/
+
+#ifndef HATN_VALIDATOR_JSON_SAX_VALIDATOR_HPP
+#define HATN_VALIDATOR_JSON_SAX_VALIDATOR_HPP
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <deque>
+#include <limits>
+#include <system_error>
+
+#include <hatn/validator/config.hpp>
+#include <hatn/validator/status.hpp>
+#include <hatn/validator/error.hpp>
+#include <hatn/validator/make_member.hpp>
+#include <hatn/validator/properties/size.hpp>
+#include <hatn/validator/properties/empty.hpp>
+#include <hatn/validator/operators/exists.hpp>
+#include <hatn/validator/utils/string_view.hpp>
+#include <hatn/validator/json/json_key.hpp>
+#include <hatn/validator/json/json_scope_adapter.hpp>
+
+HATN_VALIDATOR_NAMESPACE_BEGIN
+
+//-------------------------------------------------------------
+
+namespace detail
+{
+HATN_VALIDATOR_INLINE_LAMBDA auto can_assign_std_error_code=hana::is_valid([](auto&& ec) -> decltype(
+            (void)(ec=std::make_error_code(std::errc::invalid_argument))
+        ){});
+}
+
+/**
+ * @brief Handler of SAX events of JSON parser that validates JSON document while it is being parsed.
+ *
+ * The handler implements interface of handler of boost::json::basic_parser, so it can be used as
+ * boost::json::basic_parser<json_sax_validator<ValidatorT>>. Any other event source can invoke the same methods.
+ * Error code arguments are not used, if validation fails then the handler returns false to stop parsing
+ * and sets error code to std::errc::invalid_argument if the error code is assignable from std::error_code.
+ *
+ * Members of the document are not stored, each value is pre-validated as soon as it is parsed with the same rules as set_validated().
+ * Strings and keys split into parts by parser are buffered until they are complete.
+ * When a container is closed its size is pre-validated with "size" and "empty" properties. When an object's member is found
+ * then "exists" rules of the member are pre-validated, and if the member is used in "exists" rules then its name is kept until
+ * the object is closed, so that rules requiring members to exist are validated when the object is closed.
+ * Values are compared with master samples as soon as they are parsed.
+ *
+ * Rules comparing members with other members, e.g. _["a"](gte,_["b"]), need values that are parsed at different times.
+ * Only values of members used in such rules are buffered: a value of the reference member is kept until the innermost container
+ * holding both members is closed, a value of the validated member is compared immediately if the reference value is already known,
+ * otherwise it is kept and compared when that container is closed. Rules where the reference member contains ALL or ANY are not checked,
+ * as well as rules where the validated member contains ANY.
+ *
+ * Thus, memory used by the handler is bounded by depth of the document, by the longest string, by the number of names used in "exists" rules
+ * and by the number of buffered values rather than by size of the document.
+ * Members deeper than the deepest member used in rules of the validator are skipped, so the shape of the document
+ * does not matter beyond that depth. The deepest member is found once when the handler is constructed.
+ * Rules can be matched only with members not deeper than MaxDepth, thus if the validator uses deeper members
+ * and the document contains members at such depths then validation fails.
+ */
+template <typename ValidatorT, size_t MaxDepth=4>
+class json_sax_validator
+{
+    public:
+
+        constexpr static const size_t max_object_size=(std::numeric_limits<size_t>::max)();
+        constexpr static const size_t max_array_size=(std::numeric_limits<size_t>::max)();
+        constexpr static const size_t max_key_size=(std::numeric_limits<size_t>::max)();
+        constexpr static const size_t max_string_size=(std::numeric_limits<size_t>::max)();
+
+        /**
+         * @brief Constructor.
+         * @param validator Validator, it must outlive the handler.
+         */
+        explicit json_sax_validator(const ValidatorT& validator)
+            : _validator(validator),
+              _validated_depth(json_validated_depth(validator))
+        {}
+
+        /**
+         * @brief Get validation result.
+         * @return Error report of the first failed value, or empty report if validation succeeded.
+         */
+        const error_report& error() const noexcept
+        {
+            return _error;
+        }
+
+        /**
+         * @brief Check if validation failed.
+         * @return Boolean result.
+         */
+        bool failed() const noexcept
+        {
+            return static_cast<bool>(_error);
+        }
+
+        /**
+         * @brief Reset state to validate next document.
+         */
+        void reset()
+        {
+            _error.reset();
+            _names.clear();
+            _path.clear();
+            _containers.clear();
+            _buffer.clear();
+            _operands.clear();
+        }
+
+        template <typename ErrorCodeT>
+        bool on_document_begin(ErrorCodeT&)
+        {
+            reset();
+            return true;
+        }
+
+        template <typename ErrorCodeT>
+        bool on_document_end(ErrorCodeT& ec)
+        {
+            return result(ec);
+        }
+
+        template <typename ErrorCodeT>
+        bool on_object_begin(ErrorCodeT&)
+        {
+            begin_value();
+            _containers.push_back(json_container{false,0,{}});
+            return true;
+        }
+
+        template <typename ErrorCodeT>
+        bool on_object_end(size_t, ErrorCodeT& ec)
+        {
+            return end_container(ec);
+        }
+
+        template <typename ErrorCodeT>
+        bool on_array_begin(ErrorCodeT&)
+        {
+            begin_value();
+            _containers.push_back(json_container{true,0,{}});
+            return true;
+        }
+
+        template <typename ErrorCodeT>
+        bool on_array_end(size_t, ErrorCodeT& ec)
+        {
+            return end_container(ec);
+        }
+
+        template <typename StringViewT, typename ErrorCodeT>
+        bool on_key_part(const StringViewT& s, size_t, ErrorCodeT&)
+        {
+            _buffer.append(s.data(),s.size());
+            return true;
+        }
+
+        template <typename StringViewT, typename ErrorCodeT>
+        bool on_key(const StringViewT& s, size_t, ErrorCodeT& ec)
+        {
+            _buffer.append(s.data(),s.size());
+            _names.push_back(_buffer);
+            _buffer.clear();
+            _path.emplace_back(_names.back());
+            bool exists_member=false;
+            auto ok=with_member(ec,
+                [&](auto&& member)
+                {
+                    return prevalidate(member[exists],true,ec,&exists_member);
+                }
+            );
+            if (ok && exists_member)
+            {
+                _containers.back().keys.push_back(_names.back());
+            }
+            return ok;
+        }
+
+        template <typename StringViewT, typename ErrorCodeT>
+        bool on_string_part(const StringViewT& s, size_t, ErrorCodeT&)
+        {
+            _buffer.append(s.data(),s.size());
+            return true;
+        }
+
+        template <typename StringViewT, typename ErrorCodeT>
+        bool on_string(const StringViewT& s, size_t, ErrorCodeT& ec)
+        {
+            if (_buffer.empty())
+            {
+                return scalar(string_view(s.data(),s.size()),ec);
+            }
+            _buffer.append(s.data(),s.size());
+            auto ok=scalar(string_view(_buffer),ec);
+            _buffer.clear();
+            return ok;
+        }
+
+        template <typename StringViewT, typename ErrorCodeT>
+        bool on_number_part(const StringViewT&, ErrorCodeT&)
+        {
+            return true;
+        }
+
+        template <typename StringViewT, typename ErrorCodeT>
+        bool on_int64(int64_t val, const StringViewT&, ErrorCodeT& ec)
+        {
+            return scalar(val,ec);
+        }
+
+        template <typename StringViewT, typename ErrorCodeT>
+        bool on_uint64(uint64_t val, const StringViewT&, ErrorCodeT& ec)
+        {
+            return scalar(val,ec);
+        }
+
+        template <typename StringViewT, typename ErrorCodeT>
+        bool on_double(double val, const StringViewT&, ErrorCodeT& ec)
+        {
+            return scalar(val,ec);
+        }
+
+        template <typename ErrorCodeT>
+        bool on_bool(bool val, ErrorCodeT& ec)
+        {
+            return scalar(val,ec);
+        }
+
+        template <typename ErrorCodeT>
+        bool on_null(ErrorCodeT&)
+        {
+            begin_value();
+            end_value();
+            return true;
+        }
+
+        template <typename StringViewT, typename ErrorCodeT>
+        bool on_comment_part(const StringViewT&, ErrorCodeT&)
+        {
+            return true;
+        }
+
+        template <typename StringViewT, typename ErrorCodeT>
+        bool on_comment(const StringViewT&, ErrorCodeT&)
+        {
+            return true;
+        }
+
+    private:
+
+        void begin_value()
+        {
+            if (!_containers.empty() && _containers.back().is_array)
+            {
+                _path.emplace_back(_containers.back().count);
+            }
+        }
+
+        void end_value()
+        {
+            if (!_containers.empty())
+            {
+                if (!_containers.back().is_array)
+                {
+                    _names.pop_back();
+                }
+                _path.pop_back();
+                ++_containers.back().count;
+            }
+        }
+
+        template <typename ErrorCodeT>
+        bool end_container(ErrorCodeT& ec)
+        {
+            auto count=_containers.back().count;
+            auto ok=prevalidate_suffix(size,count,ec)
+                    && prevalidate_suffix(empty,count==0,ec)
+                    && (_path.size()>=_validated_depth || validate_scope(ec));
+            _operands.close(_path.size());
+            _containers.pop_back();
+            end_value();
+            return ok;
+        }
+
+        template <typename ErrorCodeT>
+        bool validate_scope(ErrorCodeT& ec)
+        {
+            if (failed())
+            {
+                return false;
+            }
+            std::string report;
+            auto ret=_validator.apply(make_json_scope_adapter(_operands,_path,_containers.back(),report));
+            if (ret)
+            {
+                return true;
+            }
+            _error=error_report(ret,std::move(report));
+            return result(ec);
+        }
+
+        template <typename T, typename ErrorCodeT>
+        bool scalar(const T& val, ErrorCodeT& ec)
+        {
+            begin_value();
+            auto ok=with_member(ec,
+                [&](auto&& member)
+                {
+                    return prevalidate(member,val,ec);
+                }
+            );
+            end_value();
+            return ok;
+        }
+
+        template <typename KeyT, typename T, typename ErrorCodeT>
+        bool prevalidate_suffix(const KeyT& key, const T& val, ErrorCodeT& ec)
+        {
+            return with_member(ec,
+                [&](auto&& member)
+                {
+                    return prevalidate(member[key],val,ec);
+                }
+            );
+        }
+
+        template <typename ErrorCodeT, typename HandlerT>
+        bool with_member(ErrorCodeT& ec, const HandlerT& handler)
+        {
+            if (failed())
+            {
+                return false;
+            }
+            if (_path.size()>_validated_depth)
+            {
+                // no rule can be applied to this member
+                return true;
+            }
+            if (_path.size()>MaxDepth)
+            {
+                too_deep();
+                return result(ec);
+            }
+
+            bool ok=true;
+            auto self=this;
+            hana::for_each(
+                hana::make_range(hana::size_c<1>,hana::size_c<MaxDepth+1>),
+                [&](auto depth)
+                {
+                    if (depth==self->_path.size())
+                    {
+                        auto keys=hana::unpack(hana::make_range(hana::size_c<0>,depth),
+                            [&](auto... i)
+                            {
+                                return hana::make_tuple(self->_path[i]...);
+                            }
+                        );
+                        ok=handler(make_member(std::move(keys)));
+                    }
+                }
+            );
+            return ok;
+        }
+
+        void too_deep()
+        {
+            std::string report;
+            for (auto&& key : _path)
+            {
+                if (!report.empty())
+                {
+                    report+=".";
+                }
+                if (key.is_index())
+                {
+                    report+=std::to_string(key.index());
+                }
+                else
+                {
+                    report.append(key.name().data(),key.name().size());
+                }
+            }
+            report+=" exceeds max depth of validated members";
+            _error=error_report(status(status::code::fail),std::move(report));
+        }
+
+        template <typename MemberT, typename T, typename ErrorCodeT>
+        bool prevalidate(MemberT&& member, const T& val, ErrorCodeT& ec, bool* exists_member=nullptr)
+        {
+            std::string report;
+            auto adapter=make_json_prevalidation_adapter(std::forward<MemberT>(member),val,report,_operands,_path);
+            auto ret=_validator.apply(adapter);
+            if (exists_member!=nullptr)
+            {
+                *exists_member=traits_of(adapter).next_adapter_impl().is_exists_member();
+            }
+            if (ret)
+            {
+                return true;
+            }
+            _error=error_report(ret,std::move(report));
+            return result(ec);
+        }
+
+        template <typename ErrorCodeT>
+        bool result(ErrorCodeT& ec) const
+        {
+            if (!failed())
+            {
+                return true;
+            }
+            hana::eval_if(
+                detail::can_assign_std_error_code(ec),
+                [&](auto&& _)
+                {
+                    _(ec)=std::make_error_code(std::errc::invalid_argument);
+                },
+                [](auto&&)
+                {}
+            );
+            return false;
+        }
+
+        const ValidatorT& _validator;
+        size_t _validated_depth;
+        error_report _error;
+
+        std::deque<std::string> _names;
+        std::vector<json_key> _path;
+        std::vector<json_container> _containers;
+        std::string _buffer;
+        json_operand_buffer _operands;
+};
+
+/**
+ * @brief Create handler of SAX events of JSON parser that validates JSON document.
+ * @param validator Validator, it must outlive the handler.
+ * @return Handler of SAX events.
+ *
+ * Max depth of members paths used in rules can be given in template argument, e.g. make_json_sax_validator<8>(v).
+ */
+template <size_t MaxDepth=4, typename ValidatorT>
+auto make_json_sax_validator(const ValidatorT& validator)
+{
+    return json_sax_validator<ValidatorT,MaxDepth>(validator);
+}
+
+//-------------------------------------------------------------
+
+HATN_VALIDATOR_NAMESPACE_END
+
+#endif // HATN_VALIDATOR_JSON_SAX_VALIDATOR_HPP
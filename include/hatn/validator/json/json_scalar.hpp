@@ -0,0 +1,204 @@
+/**
+@copyright Evgeny Sidorov 2020
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+*/
+
+/****************************************************************************/
+
+/** @file validator/json/json_scalar.hpp
+*
+*  Defines scalar value of JSON document.
+*
+*/
+
+/****************************************************************************/
+
+#ifndef HATN_VALIDATOR_JSON_SCALAR_HPP
+#define HATN_VALIDATOR_JSON_SCALAR_HPP
+
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
+#include <hatn/validator/config.hpp>
+#include <hatn/validator/utils/string_view.hpp>
+#include <hatn/validator/utils/value_ordering.hpp>
+
+HATN_VALIDATOR_NAMESPACE_BEGIN
+
+//-------------------------------------------------------------
+
+/**
+ * @brief Scalar value of JSON document.
+ *
+ * The value keeps a copy of number, boolean, string or null parsed from JSON document,
+ * so that it can be compared with other values after the parser moved on.
+ * Values of different types are unordered, except for numbers that are compared safely regardless of their types.
+ */
+class json_scalar : public enable_value_ordering<json_scalar>
+{
+    public:
+
+        /**
+         * @brief Type of scalar value.
+         */
+        enum class type : int
+        {
+            null_value,
+            bool_value,
+            int64_value,
+            uint64_value,
+            double_value,
+            string_value
+        };
+
+        /**
+         * @brief Constructor of null value.
+         */
+        json_scalar() noexcept : _type(type::null_value),_int64(0)
+        {}
+
+        /**
+         * @brief Constructor of boolean value.
+         * @param val Value.
+         */
+        explicit json_scalar(bool val) noexcept : _type(type::bool_value),_bool(val)
+        {}
+
+        /**
+         * @brief Constructor of signed integer value.
+         * @param val Value.
+         */
+        explicit json_scalar(int64_t val) noexcept : _type(type::int64_value),_int64(val)
+        {}
+
+        /**
+         * @brief Constructor of unsigned integer value.
+         * @param val Value.
+         */
+        explicit json_scalar(uint64_t val) noexcept : _type(type::uint64_value),_uint64(val)
+        {}
+
+        /**
+         * @brief Constructor of floating point value.
+         * @param val Value.
+         */
+        explicit json_scalar(double val) noexcept : _type(type::double_value),_double(val)
+        {}
+
+        /**
+         * @brief Constructor of string value.
+         * @param val Value, it is copied.
+         */
+        explicit json_scalar(string_view val) : _type(type::string_value),_int64(0),_string(val.data(),val.size())
+        {}
+
+        /**
+         * @brief Get type of the value.
+         * @return Type.
+         */
+        type value_type() const noexcept
+        {
+            return _type;
+        }
+
+        /**
+         * @brief Check if value is null.
+         * @return Boolean result.
+         */
+        bool is_null() const noexcept
+        {
+            return _type==type::null_value;
+        }
+
+        /**
+         * @brief Get size of string.
+         * @return Size of string or 0 for other values.
+         */
+        size_t size() const noexcept
+        {
+            return _string.size();
+        }
+
+        /**
+         * @brief Check if string is empty.
+         * @return Boolean result.
+         */
+        bool empty() const noexcept
+        {
+            return _string.empty();
+        }
+
+    private:
+
+        friend class enable_value_ordering<json_scalar>;
+
+        template <typename T>
+        std::enable_if_t<std::is_arithmetic<T>::value && !std::is_same<T,bool>::value,value_ordering>
+        compare(const T& other) const noexcept
+        {
+            switch (_type)
+            {
+                case type::int64_value: return compare_value_ordering(_int64,other);
+                case type::uint64_value: return compare_value_ordering(_uint64,other);
+                case type::double_value: return compare_value_ordering(_double,other);
+                default: break;
+            }
+            return value_ordering::unordered;
+        }
+
+        template <typename T>
+        std::enable_if_t<std::is_same<T,bool>::value,value_ordering>
+        compare(const T& other) const noexcept
+        {
+            if (_type==type::bool_value)
+            {
+                return compare_value_ordering(_bool,other);
+            }
+            return value_ordering::unordered;
+        }
+
+        template <typename T>
+        std::enable_if_t<std::is_constructible<string_view,T>::value && !std::is_arithmetic<T>::value,value_ordering>
+        compare(const T& other) const noexcept
+        {
+            if (_type==type::string_value)
+            {
+                return compare_string_ordering(string_view(_string),string_view(other));
+            }
+            return value_ordering::unordered;
+        }
+
+        value_ordering compare(const json_scalar& other) const noexcept
+        {
+            switch (other._type)
+            {
+                case type::bool_value: return compare(other._bool);
+                case type::int64_value: return compare(other._int64);
+                case type::uint64_value: return compare(other._uint64);
+                case type::double_value: return compare(other._double);
+                case type::string_value: return compare(string_view(other._string));
+                case type::null_value: return is_null() ? value_ordering::equal : value_ordering::unordered;
+            }
+            return value_ordering::unordered;
+        }
+
+        type _type;
+        union
+        {
+            bool _bool;
+            int64_t _int64;
+            uint64_t _uint64;
+            double _double;
+        };
+        std::string _string;
+};
+
+//-------------------------------------------------------------
+
+HATN_VALIDATOR_NAMESPACE_END
+
+#endif // HATN_VALIDATOR_JSON_SCALAR_HPP
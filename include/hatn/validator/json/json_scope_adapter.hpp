@@ -0,0 +1,918 @@
+/**
+@copyright Evgeny Sidorov 2020
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+*/
+
+/****************************************************************************/
+
+/** @file validator/json/json_scope_adapter.hpp
+*
+*  Defines adapters used by json_sax_validator to validate rules that depend on more than one value of JSON document
+*  and to find depth of validated members.
+*
+*/
+
+/****************************************************************************/
+
+#ifndef HATN_VALIDATOR_JSON_SCOPE_ADAPTER_HPP
+#define HATN_VALIDATOR_JSON_SCOPE_ADAPTER_HPP
+
+#include <string>
+#include <vector>
+#include <deque>
+#include <list>
+#include <algorithm>
+
+#include <hatn/validator/config.hpp>
+#include <hatn/validator/status.hpp>
+#include <hatn/validator/property.hpp>
+#include <hatn/validator/extract.hpp>
+#include <hatn/validator/apply.hpp>
+#include <hatn/validator/get_member.hpp>
+#include <hatn/validator/check_exists.hpp>
+#include <hatn/validator/check_member_path.hpp>
+#include <hatn/validator/aggregation/element_aggregation.hpp>
+#include <hatn/validator/operators/exists.hpp>
+#include <hatn/validator/properties/size.hpp>
+#include <hatn/validator/properties/empty.hpp>
+#include <hatn/validator/utils/object_wrapper.hpp>
+#include <hatn/validator/utils/safe_compare.hpp>
+#include <hatn/validator/adapter.hpp>
+#include <hatn/validator/reporting/reporter.hpp>
+#include <hatn/validator/reporting/reporting_adapter_impl.hpp>
+#include <hatn/validator/adapters/prevalidation_adapter.hpp>
+#include <hatn/validator/json/json_key.hpp>
+#include <hatn/validator/json/json_scalar.hpp>
+
+HATN_VALIDATOR_NAMESPACE_BEGIN
+
+//-------------------------------------------------------------
+
+/**
+ * @brief Scalar value of JSON document together with its path.
+ *
+ * Scope depth is a size of path of the container that must be closed before the value can be dropped.
+ */
+class json_buffered_value
+{
+    public:
+
+        /**
+         * @brief Constructor.
+         * @param path Path of the value, names of members are copied.
+         * @param value Value.
+         * @param scope_depth Scope depth.
+         */
+        json_buffered_value(const std::vector<json_key>& path, json_scalar value, size_t scope_depth)
+            : _value(std::move(value)),
+              _scope_depth(scope_depth)
+        {
+            _path.reserve(path.size());
+            for (auto&& key : path)
+            {
+                if (key.is_index())
+                {
+                    _path.emplace_back(key.index());
+                }
+                else
+                {
+                    _names.emplace_back(key.name().data(),key.name().size());
+                    _path.emplace_back(_names.back());
+                }
+            }
+        }
+
+        json_buffered_value(const json_buffered_value&)=delete;
+        json_buffered_value& operator =(const json_buffered_value&)=delete;
+
+        const std::vector<json_key>& path() const noexcept
+        {
+            return _path;
+        }
+
+        const json_scalar& value() const noexcept
+        {
+            return _value;
+        }
+
+        size_t scope_depth() const noexcept
+        {
+            return _scope_depth;
+        }
+
+        void set_scope_depth(size_t depth) noexcept
+        {
+            _scope_depth=depth;
+        }
+
+    private:
+
+        std::deque<std::string> _names;
+        std::vector<json_key> _path;
+        json_scalar _value;
+        size_t _scope_depth;
+};
+
+namespace detail
+{
+
+/**
+ * @brief Check if path of JSON keys matches path of member.
+ */
+template <typename PathT>
+bool json_path_equal(const std::vector<json_key>& path, const PathT& member_path)
+{
+    if (path.size()!=hana::value(hana::size(member_path)))
+    {
+        return false;
+    }
+    size_t i=0;
+    bool ok=true;
+    hana::for_each(
+        member_path,
+        [&](auto&& key)
+        {
+            if (ok)
+            {
+                ok=safe_compare_equal(path[i],unwrap_object(key));
+            }
+            ++i;
+        }
+    );
+    return ok;
+}
+
+/**
+ * @brief Get size of common prefix of member paths, the prefix ends before the first element aggregation.
+ */
+template <typename PathT, typename OtherPathT>
+size_t json_scope_depth(const PathT& path, const OtherPathT& other_path)
+{
+    using size_type=decltype(hana::minus(
+                        hana::min(hana::size(path),hana::size(other_path)),
+                        hana::size_c<1>
+                    ));
+    size_t depth=0;
+    bool same=true;
+    hana::for_each(
+        hana::make_range(hana::size_c<0>,size_type{}),
+        [&](auto i)
+        {
+            using key_type=unwrap_object_t<decltype(hana::at(path,i))>;
+            if (same && !hana::is_a<element_aggregation_tag,key_type>
+                && safe_compare_equal(unwrap_object(hana::at(path,i)),unwrap_object(hana::at(other_path,i)))
+               )
+            {
+                ++depth;
+            }
+            else
+            {
+                same=false;
+            }
+        }
+    );
+    return depth;
+}
+
+HATN_VALIDATOR_INLINE_LAMBDA auto json_can_compare=hana::is_valid([](auto&& op, auto&& prop, auto&& a, auto&& b) -> decltype(
+            (void)op(property(a,prop),property(b,prop))
+        ){});
+
+/**
+ * @brief Compare value of JSON document with other value if operator can be applied to them.
+ */
+template <typename OpT, typename PropT, typename T1, typename T2>
+status json_compare(const OpT& op, const PropT& prop, const T1& a, const T2& b)
+{
+    return hana::eval_if(
+        json_can_compare(op,prop,a,b),
+        [&](auto&& _)
+        {
+            return status(_(op)(property(_(a),prop),property(_(b),prop)));
+        },
+        [](auto&&)
+        {
+            return status(status::code::ignore);
+        }
+    );
+}
+
+}
+
+/**
+ * @brief Buffer of values of JSON document that are operands of rules comparing members with other members.
+ *
+ * Operands are values of members that are used as reference arguments of rules.
+ * Pending values are values of members that must be compared with operands not parsed yet.
+ * Values are kept only until the innermost container holding both the member and the operand is closed.
+ */
+class json_operand_buffer
+{
+    public:
+
+        /**
+         * @brief Add operand.
+         * @param path Path of operand.
+         * @param value Value of operand.
+         * @param scope_depth Scope depth.
+         */
+        void add_operand(const std::vector<json_key>& path, const json_scalar& value, size_t scope_depth)
+        {
+            auto it=std::find_if(_operands.begin(),_operands.end(),
+                [&path](const json_buffered_value& operand)
+                {
+                    return operand.path()==path;
+                }
+            );
+            if (it!=_operands.end())
+            {
+                it->set_scope_depth((std::min)(it->scope_depth(),scope_depth));
+                return;
+            }
+            _operands.emplace_back(path,value,scope_depth);
+        }
+
+        /**
+         * @brief Find operand.
+         * @param path Path of member used as operand.
+         * @return Pointer to value of operand or nullptr if operand is not found.
+         */
+        template <typename PathT>
+        const json_scalar* find_operand(const PathT& path) const
+        {
+            for (auto&& operand : _operands)
+            {
+                if (detail::json_path_equal(operand.path(),path))
+                {
+                    return &operand.value();
+                }
+            }
+            return nullptr;
+        }
+
+        /**
+         * @brief Add pending value.
+         * @param path Path of the value.
+         * @param value Value.
+         * @param scope_depth Scope depth.
+         */
+        void add_pending(const std::vector<json_key>& path, json_scalar value, size_t scope_depth)
+        {
+            if (!_pending.empty() && _pending.back().scope_depth()==scope_depth && _pending.back().path()==path)
+            {
+                return;
+            }
+            _pending.emplace_back(path,std::move(value),scope_depth);
+        }
+
+        /**
+         * @brief Compare pending values of a member with operand when the scope of the values is closed.
+         * @param scope_depth Depth of closed scope.
+         * @param path Path of member.
+         * @param other_path Path of operand.
+         * @param handler Handler to invoke with pending value and operand.
+         * @return Status of the first failed comparison, or ignore if nothing was compared.
+         */
+        template <typename PathT, typename OtherPathT, typename HandlerT>
+        status compare_pending(size_t scope_depth, const PathT& path, const OtherPathT& other_path, const HandlerT& handler) const
+        {
+            status ret{status::code::ignore};
+            for (auto&& pending : _pending)
+            {
+                if (pending.scope_depth()!=scope_depth || !detail::json_path_equal(pending.path(),path))
+                {
+                    continue;
+                }
+                auto other=find_operand(other_path);
+                if (other==nullptr)
+                {
+                    break;
+                }
+                auto st=handler(pending.value(),*other);
+                if (!st)
+                {
+                    return st;
+                }
+                if (!st.ignore())
+                {
+                    ret=st;
+                }
+            }
+            return ret;
+        }
+
+        /**
+         * @brief Drop values whose scope is closed.
+         * @param scope_depth Depth of closed scope.
+         */
+        void close(size_t scope_depth)
+        {
+            auto pred=[scope_depth](const json_buffered_value& val)
+            {
+                return val.scope_depth()>=scope_depth;
+            };
+            _pending.remove_if(pred);
+            _operands.remove_if(pred);
+        }
+
+        /**
+         * @brief Clear buffer.
+         */
+        void clear() noexcept
+        {
+            _pending.clear();
+            _operands.clear();
+        }
+
+        /**
+         * @brief Check if buffer is empty.
+         * @return Boolean result.
+         */
+        bool empty() const noexcept
+        {
+            return _pending.empty() && _operands.empty();
+        }
+
+    private:
+
+        std::list<json_buffered_value> _operands;
+        std::list<json_buffered_value> _pending;
+};
+
+/**
+ * @brief Container of JSON document as seen by json_sax_validator.
+ *
+ * Keys are names of object's members that are used in "exists" rules.
+ */
+struct json_container
+{
+    bool is_array;
+    size_t count;
+    std::vector<std::string> keys;
+};
+
+//-------------------------------------------------------------
+
+/**
+ * @brief Implementation of prevalidation of JSON values.
+ *
+ * Besides rules checked by prevalidation_adapter_impl it validates members with master samples,
+ * buffers values used in rules comparing members with other members and compares them if the operands are already known.
+ * It also detects if the checked member is used in "exists" rules.
+ */
+template <typename CheckMemberT>
+class json_prevalidation_adapter_impl : public prevalidation_adapter_impl<CheckMemberT>
+{
+    public:
+
+        using prevalidation_adapter_impl<CheckMemberT>::prevalidation_adapter_impl;
+
+        /**
+         * @brief Set buffer of operands and path of checked member.
+         * @param buffer Buffer of operands.
+         * @param path Path of checked member.
+         */
+        void set_operand_buffer(json_operand_buffer& buffer, const std::vector<json_key>& path) noexcept
+        {
+            _buffer=&buffer;
+            _path=&path;
+        }
+
+        /**
+         * @brief Check if checked member is used in "exists" rules.
+         * @return Boolean result.
+         */
+        bool is_exists_member() const noexcept
+        {
+            return _exists_member;
+        }
+
+        template <typename AdapterT, typename T2, typename OpT, typename MemberT>
+        status validate_exists(AdapterT&& adpt, MemberT&& member, OpT&& op, T2&& b, bool from_check_member=false, bool skip_check=false) const
+        {
+            auto ret=prevalidation_adapter_impl<CheckMemberT>::validate_exists(adpt,member,op,b,from_check_member,skip_check);
+            if (!ret.ignore())
+            {
+                _exists_member=true;
+            }
+            return ret;
+        }
+
+        template <typename AdapterT, typename T2, typename OpT, typename PropT, typename MemberT>
+        status validate_with_other_member(AdapterT&& adpt, MemberT&& member, PropT&& prop, OpT&& op, T2&& b) const
+        {
+            if (is_property_check() || (member.has_any() && !this->is_strict_any()) || std::decay_t<T2>::is_aggregated::value)
+            {
+                return status(status::code::ignore);
+            }
+            auto is_member=this->check_member().equals(member);
+            auto is_operand=this->check_member().equals(b);
+            if (!is_member && !is_operand)
+            {
+                return status(status::code::ignore);
+            }
+
+            auto scope_depth=detail::json_scope_depth(member.path(),b.path());
+            json_scalar val(extract(traits_of(adpt).get()));
+            if (is_operand)
+            {
+                _buffer->add_operand(*_path,val,scope_depth);
+            }
+            if (!is_member)
+            {
+                return status(status::code::ignore);
+            }
+            auto other=_buffer->find_operand(b.path());
+            if (other==nullptr)
+            {
+                _buffer->add_pending(*_path,std::move(val),scope_depth);
+                return status(status::code::ignore);
+            }
+            return detail::json_compare(op,prop,val,*other);
+        }
+
+        template <typename AdapterT, typename T2, typename OpT, typename PropT, typename MemberT>
+        status validate_with_master_sample(AdapterT&& adpt, MemberT&& member, PropT&& prop, OpT&& op, T2&& b) const
+        {
+            if (is_property_check() || !this->check_member().equals(member))
+            {
+                return status(status::code::ignore);
+            }
+
+            const auto& sample=extract(b)();
+            return hana::if_(
+                hana::and_(
+                    hana::bool_c<!std::decay_t<MemberT>::is_aggregated::value>,
+                    is_member_path_valid(sample,member.path())
+                ),
+                [&adpt,&prop,&op,&sample](auto&& path)
+                {
+                    if (!check_exists(sample,path))
+                    {
+                        // if sample does not have member then ignore check
+                        return status(status::code::ignore);
+                    }
+                    return detail::json_compare(op,prop,json_scalar(extract(traits_of(adpt).get())),get_member(sample,path));
+                },
+                [](auto&&)
+                {
+                    return status(status::code::ignore);
+                }
+            )(member.path());
+        }
+
+    private:
+
+        constexpr static bool is_property_check() noexcept
+        {
+            // checked member is [exists], [size] or [empty] suffix of JSON value
+            using key_type=std::decay_t<decltype(std::declval<CheckMemberT>().key())>;
+            return std::is_same<std::decay_t<decltype(exists)>,key_type>::value
+                    || std::is_same<std::decay_t<decltype(size)>,key_type>::value
+                    || std::is_same<std::decay_t<decltype(empty)>,key_type>::value;
+        }
+
+        json_operand_buffer* _buffer=nullptr;
+        const std::vector<json_key>* _path=nullptr;
+        mutable bool _exists_member=false;
+};
+
+/**
+ * @brief Create adapter for prevalidation of JSON value.
+ * @param member Member to validate.
+ * @param val Value of the member.
+ * @param dst Destination object where to put validation report if validation fails.
+ * @param buffer Buffer of operands.
+ * @param path Path of the member.
+ * @return Adapter.
+ */
+template <typename MemberT, typename T, typename DstT>
+auto make_json_prevalidation_adapter(
+        MemberT&& member,
+        T&& val,
+        DstT& dst,
+        json_operand_buffer& buffer,
+        const std::vector<json_key>& path
+    )
+{
+    using value_type=decltype(adjust_view_type(std::forward<T>(val)));
+    using reporter_type=decltype(make_reporter(dst));
+    using impl_type=json_prevalidation_adapter_impl<MemberT>;
+    auto adapter=prevalidation_adapter<MemberT,value_type,reporter_type,value_type,impl_type>(
+                std::forward<MemberT>(member),
+                adjust_view_type(std::forward<T>(val)),
+                make_reporter(dst)
+            );
+    traits_of(adapter).next_adapter_impl().set_operand_buffer(buffer,path);
+    return adapter;
+}
+
+//-------------------------------------------------------------
+
+/**
+ * @brief Implementation of adapter that validates rules of JSON container when the container is closed.
+ *
+ * "exists" rules of container's members are validated with the keys found in the container
+ * and pending values of rules comparing members with other members are compared with their operands.
+ * Other rules are ignored.
+ */
+class json_scope_adapter_impl
+{
+    public:
+
+        /**
+         * @brief Constructor.
+         * @param buffer Buffer of operands.
+         * @param path Path of container.
+         * @param container Container.
+         */
+        json_scope_adapter_impl(const json_operand_buffer& buffer, const std::vector<json_key>& path, const json_container& container)
+            : _buffer(&buffer),
+              _path(&path),
+              _container(&container)
+        {}
+
+        template <typename AdapterT, typename T2, typename OpT>
+        status validate_operator(AdapterT&&, OpT&&, T2&&) const
+        {
+            return status(status::code::ignore);
+        }
+
+        template <typename AdapterT, typename T2, typename OpT, typename PropT>
+        status validate_property(AdapterT&&, PropT&&, OpT&&, T2&&) const
+        {
+            return status(status::code::ignore);
+        }
+
+        template <typename AdapterT, typename T2, typename OpT, typename PropT, typename MemberT>
+        status validate(AdapterT&&, MemberT&&, PropT&&, OpT&&, T2&&) const
+        {
+            return status(status::code::ignore);
+        }
+
+        template <typename AdapterT, typename T2, typename OpT, typename MemberT>
+        status validate_exists(AdapterT&&, MemberT&& member, OpT&&, T2&& b, bool =false, bool =false) const
+        {
+            using key_type=unwrap_object_t<decltype(hana::back(member.path()))>;
+            if (hana::is_a<element_aggregation_tag,key_type> || !detail::json_path_equal(*_path,hana::drop_back(member.path())))
+            {
+                return status(status::code::ignore);
+            }
+
+            const auto& key=unwrap_object(hana::back(member.path()));
+            auto found=hana::eval_if(
+                std::is_integral<key_type>{},
+                [&](auto&& _)
+                {
+                    return _(this)->_container->is_array && _(key)>=key_type(0) && safe_compare_less(_(key),_(this)->_container->count);
+                },
+                [&](auto&& _)
+                {
+                    const auto& keys=_(this)->_container->keys;
+                    return !_(this)->_container->is_array
+                            &&
+                           std::any_of(keys.begin(),keys.end(),
+                                [&](const std::string& name)
+                                {
+                                    return safe_compare_equal(_(key),name);
+                                }
+                            );
+                }
+            );
+            return status(b==found);
+        }
+
+        template <typename AdapterT, typename T2, typename OpT, typename PropT, typename MemberT>
+        status validate_with_other_member(AdapterT&&, MemberT&& member, PropT&& prop, OpT&& op, T2&& b) const
+        {
+            if (member.has_any()
+                || std::decay_t<T2>::is_aggregated::value
+                || detail::json_scope_depth(member.path(),b.path())!=_path->size()
+                )
+            {
+                return status(status::code::ignore);
+            }
+            return _buffer->compare_pending(_path->size(),member.path(),b.path(),
+                [&](const json_scalar& val, const json_scalar& other)
+                {
+                    return detail::json_compare(op,prop,val,other);
+                }
+            );
+        }
+
+        template <typename AdapterT, typename T2, typename OpT, typename PropT, typename MemberT>
+        status validate_with_master_sample(AdapterT&&, MemberT&&, PropT&&, OpT&&, T2&&) const
+        {
+            // master samples are validated when values are parsed
+            return status(status::code::ignore);
+        }
+
+        template <typename AdapterT, typename OpsT>
+        status validate_and(AdapterT&& adpt, OpsT&& ops) const
+        {
+            return default_adapter_impl::validate_and(std::forward<AdapterT>(adpt),std::forward<OpsT>(ops));
+        }
+
+        template <typename AdapterT, typename MemberT, typename OpsT>
+        status validate_and(AdapterT&& adpt, MemberT&& member, OpsT&& ops) const
+        {
+            return default_adapter_impl::validate_and(std::forward<AdapterT>(adpt),std::forward<MemberT>(member),std::forward<OpsT>(ops));
+        }
+
+        template <typename AdapterT, typename OpsT>
+        status validate_or(AdapterT&& adpt, OpsT&& ops) const
+        {
+            return default_adapter_impl::validate_or(std::forward<AdapterT>(adpt),std::forward<OpsT>(ops));
+        }
+
+        template <typename AdapterT, typename MemberT, typename OpsT>
+        status validate_or(AdapterT&& adpt, MemberT&& member, OpsT&& ops) const
+        {
+            return default_adapter_impl::validate_or(std::forward<AdapterT>(adpt),std::forward<MemberT>(member),std::forward<OpsT>(ops));
+        }
+
+        template <typename AdapterT, typename OpT>
+        status validate_not(AdapterT&& adpt, OpT&& op) const
+        {
+            // ignored rules must stay ignored
+            status ret=apply(adpt,std::forward<OpT>(op));
+            return ret.ignore() ? ret : status(!ret);
+        }
+
+        template <typename AdapterT, typename MemberT, typename OpT>
+        status validate_not(AdapterT&& adpt, MemberT&& member, OpT&& op) const
+        {
+            status ret=apply_member(adpt,std::forward<OpT>(op),member);
+            return ret.ignore() ? ret : status(!ret);
+        }
+
+        template <typename PredicateT, typename AdapterT, typename OpsT, typename MemberT>
+        static status validate_member_aggregation(const PredicateT& pred, AdapterT&& adapter, MemberT&& member, OpsT&& ops)
+        {
+            return while_each(
+                      ops,
+                      pred,
+                      status(status::code::ignore),
+                      [&member,&adapter](auto&& op)
+                      {
+                        return status(
+                                    apply_member(
+                                        adapter,
+                                        std::forward<decltype(op)>(op),
+                                        member
+                                    )
+                                 );
+                      }
+                  );
+        }
+
+    private:
+
+        const json_operand_buffer* _buffer;
+        const std::vector<json_key>* _path;
+        const json_container* _container;
+};
+
+/**
+ * @brief Traits of adapter that validates rules of JSON container when the container is closed.
+ */
+template <typename ReporterT>
+class json_scope_adapter_traits : public adapter_traits,
+                                  public object_wrapper<const json_container&>,
+                                  public reporting_adapter_impl<ReporterT,json_scope_adapter_impl>,
+                                  public with_check_member_exists<json_scope_adapter_traits<ReporterT>>
+{
+    public:
+
+        using expand_aggregation_members=std::integral_constant<bool,false>;
+        using filter_if_not_exists=std::integral_constant<bool,false>;
+
+        /**
+         * @brief Constructor.
+         * @param buffer Buffer of operands.
+         * @param path Path of container.
+         * @param container Container.
+         * @param reporter Reporter to use for report construction if validation fails.
+         */
+        json_scope_adapter_traits(
+                    const json_operand_buffer& buffer,
+                    const std::vector<json_key>& path,
+                    const json_container& container,
+                    ReporterT&& reporter
+                ) : object_wrapper<const json_container&>(container),
+                    reporting_adapter_impl<ReporterT,json_scope_adapter_impl>(
+                        std::forward<ReporterT>(reporter),
+                        buffer,
+                        path,
+                        container
+                    ),
+                    with_check_member_exists<json_scope_adapter_traits<ReporterT>>(*this)
+        {}
+
+        template <typename PredicateT, typename AdapterT, typename OpsT, typename MemberT>
+        static status validate_member_aggregation(const PredicateT& pred, AdapterT&& adapter, MemberT&& member, OpsT&& ops)
+        {
+            return json_scope_adapter_impl::validate_member_aggregation(
+                            pred,
+                            std::forward<AdapterT>(adapter),
+                            std::forward<MemberT>(member),
+                            std::forward<OpsT>(ops)
+                        );
+        }
+};
+
+/**
+ * @brief Adapter that validates rules of JSON container when the container is closed.
+ */
+template <typename ReporterT>
+class json_scope_adapter : public adapter<json_scope_adapter_traits<ReporterT>>
+{
+    public:
+
+        using reporter_type=ReporterT;
+
+        using adapter<json_scope_adapter_traits<ReporterT>>::adapter;
+};
+
+/**
+ * @brief Create adapter that validates rules of JSON container when the container is closed.
+ * @param buffer Buffer of operands.
+ * @param path Path of container.
+ * @param container Container.
+ * @param dst Destination object where to put validation report if validation fails.
+ * @return Adapter.
+ */
+template <typename DstT>
+auto make_json_scope_adapter(
+        const json_operand_buffer& buffer,
+        const std::vector<json_key>& path,
+        const json_container& container,
+        DstT& dst
+    )
+{
+    return json_scope_adapter<decltype(make_reporter(dst))>(buffer,path,container,make_reporter(dst));
+}
+
+//-------------------------------------------------------------
+
+/**
+ * @brief Implementation of adapter that finds the deepest path of members used in rules of validator.
+ *
+ * All rules are ignored, only depths of paths of validated members and of their operands are recorded.
+ * Depth of each path is known at compile time.
+ */
+class json_depth_adapter_impl
+{
+    public:
+
+        /**
+         * @brief Constructor.
+         * @param depth Where to put the deepest path depth.
+         */
+        explicit json_depth_adapter_impl(size_t& depth) : _depth(&depth)
+        {}
+
+        template <typename AdapterT, typename T2, typename OpT>
+        status validate_operator(AdapterT&&, OpT&&, T2&&) const
+        {
+            return status(status::code::ignore);
+        }
+
+        template <typename AdapterT, typename T2, typename OpT, typename PropT>
+        status validate_property(AdapterT&&, PropT&&, OpT&&, T2&&) const
+        {
+            return status(status::code::ignore);
+        }
+
+        template <typename AdapterT, typename T2, typename OpT, typename PropT, typename MemberT>
+        status validate(AdapterT&&, MemberT&&, PropT&&, OpT&&, T2&&) const
+        {
+            return record(std::decay_t<MemberT>::path_depth());
+        }
+
+        template <typename AdapterT, typename T2, typename OpT, typename MemberT>
+        status validate_exists(AdapterT&&, MemberT&&, OpT&&, T2&&, bool =false, bool =false) const
+        {
+            return record(std::decay_t<MemberT>::path_depth());
+        }
+
+        template <typename AdapterT, typename T2, typename OpT, typename PropT, typename MemberT>
+        status validate_with_other_member(AdapterT&&, MemberT&&, PropT&&, OpT&&, T2&&) const
+        {
+            return record((std::max)(std::decay_t<MemberT>::path_depth(),std::decay_t<T2>::path_depth()));
+        }
+
+        template <typename AdapterT, typename T2, typename OpT, typename PropT, typename MemberT>
+        status validate_with_master_sample(AdapterT&&, MemberT&&, PropT&&, OpT&&, T2&&) const
+        {
+            return record(std::decay_t<MemberT>::path_depth());
+        }
+
+        template <typename AdapterT, typename OpsT>
+        status validate_and(AdapterT&& adpt, OpsT&& ops) const
+        {
+            return default_adapter_impl::validate_and(std::forward<AdapterT>(adpt),std::forward<OpsT>(ops));
+        }
+
+        template <typename AdapterT, typename MemberT, typename OpsT>
+        status validate_and(AdapterT&& adpt, MemberT&& member, OpsT&& ops) const
+        {
+            return default_adapter_impl::validate_and(std::forward<AdapterT>(adpt),std::forward<MemberT>(member),std::forward<OpsT>(ops));
+        }
+
+        template <typename AdapterT, typename OpsT>
+        status validate_or(AdapterT&& adpt, OpsT&& ops) const
+        {
+            return default_adapter_impl::validate_or(std::forward<AdapterT>(adpt),std::forward<OpsT>(ops));
+        }
+
+        template <typename AdapterT, typename MemberT, typename OpsT>
+        status validate_or(AdapterT&& adpt, MemberT&& member, OpsT&& ops) const
+        {
+            return default_adapter_impl::validate_or(std::forward<AdapterT>(adpt),std::forward<MemberT>(member),std::forward<OpsT>(ops));
+        }
+
+        template <typename AdapterT, typename OpT>
+        status validate_not(AdapterT&& adpt, OpT&& op) const
+        {
+            return apply(adpt,std::forward<OpT>(op));
+        }
+
+        template <typename AdapterT, typename MemberT, typename OpT>
+        status validate_not(AdapterT&& adpt, MemberT&& member, OpT&& op) const
+        {
+            return apply_member(adpt,std::forward<OpT>(op),member);
+        }
+
+    private:
+
+        status record(size_t depth) const noexcept
+        {
+            *_depth=(std::max)(*_depth,depth);
+            return status(status::code::ignore);
+        }
+
+        size_t* _depth;
+};
+
+/**
+ * @brief Traits of adapter that finds the deepest path of members used in rules of validator.
+ */
+class json_depth_adapter_traits : public adapter_traits,
+                                  public object_wrapper<const json_container&>,
+                                  public json_depth_adapter_impl,
+                                  public with_check_member_exists<json_depth_adapter_traits>
+{
+    public:
+
+        using expand_aggregation_members=std::integral_constant<bool,false>;
+        using filter_if_not_exists=std::integral_constant<bool,false>;
+
+        /**
+         * @brief Constructor.
+         * @param container Empty container used as validated object.
+         * @param depth Where to put the deepest path depth.
+         */
+        json_depth_adapter_traits(const json_container& container, size_t& depth)
+            : object_wrapper<const json_container&>(container),
+              json_depth_adapter_impl(depth),
+              with_check_member_exists<json_depth_adapter_traits>(*this)
+        {}
+
+        template <typename PredicateT, typename AdapterT, typename OpsT, typename MemberT>
+        static status validate_member_aggregation(const PredicateT& pred, AdapterT&& adapter, MemberT&& member, OpsT&& ops)
+        {
+            return json_scope_adapter_impl::validate_member_aggregation(
+                            pred,
+                            std::forward<AdapterT>(adapter),
+                            std::forward<MemberT>(member),
+                            std::forward<OpsT>(ops)
+                        );
+        }
+};
+
+/**
+ * @brief Find the deepest path of members used in rules of validator.
+ * @param validator Validator.
+ * @return Size of the deepest path of validated members or of their operands, 0 if validator has no member rules.
+ *
+ * Validators are made of closures that do not expose their members in types,
+ * so depths of members known at compile time are collected by walking the validator once.
+ */
+template <typename ValidatorT>
+size_t json_validated_depth(const ValidatorT& validator)
+{
+    size_t depth=0;
+    json_container container{false,0,{}};
+    validator.apply(adapter<json_depth_adapter_traits>(container,depth));
+    return depth;
+}
+
+//-------------------------------------------------------------
+
+HATN_VALIDATOR_NAMESPACE_END
+
+#endif // HATN_VALIDATOR_JSON_SCOPE_ADAPTER_HPP
@@ -90,7 +90,7 @@ class member
          * @param parent_path Path to parent member which is of previous (upper) level.
          */
         template <typename T1, typename ParentPathTs>
-        member(T1&& key, ParentPathTs&& parent_path,
+        constexpr member(T1&& key, ParentPathTs&& parent_path,
                std::enable_if_t<!std::is_constructible<std::string,ParentPathTs>::value,void*> =nullptr)
              : _path(hana::append(std::forward<ParentPathTs>(parent_path),std::forward<T1>(key)))
         {}
@@ -101,7 +101,7 @@ class member
          * @param parent_path Path to parent member which is of previous (upper) level.
          */
         template <typename ParentPathTs>
-        member(type&& key, ParentPathTs&& parent_path,
+        constexpr member(type&& key, ParentPathTs&& parent_path,
                std::enable_if_t<!std::is_constructible<std::string,ParentPathTs>::value,void*> =nullptr)
              : _path(hana::append(std::forward<ParentPathTs>(parent_path),std::move(key)))
         {}
@@ -111,7 +111,7 @@ class member
          * @param key Key of current member.
          */
         template <typename T1>
-        member(T1&& key)
+        constexpr member(T1&& key)
              : _path(hana::make_tuple(T(std::forward<T1>(key))))
         {}
 
@@ -119,7 +119,7 @@ class member
          * @brief Constructor from path.
          * @param path Member's path.
          */
-        member(path_type path)
+        constexpr member(path_type path)
              : _path(std::move(path))
         {}
 
@@ -20,6 +20,7 @@ Distributed under the Boost Software License, Version 1.0.
 #define HATN_VALIDATOR_NUMBER_PATTERNS_HPP
 
 #include <hatn/validator/config.hpp>
+#include <hatn/validator/utils/string_view.hpp>
 #include <hatn/validator/operators/regex.hpp>
 #include <hatn/validator/operators/op_report_without_operand.hpp>
 
@@ -29,16 +30,93 @@ HATN_VALIDATOR_NAMESPACE_BEGIN
 
 namespace detail
 {
-// from https://stackoverflow.com/a/2845275
-inline bool is_integer(const std::string& s)
+
+/**
+ * @brief Check if character is a decimal digit.
+ * @param c Character.
+ * @return Check result.
+ */
+constexpr bool is_digit(char c) noexcept
+{
+    return c>='0' && c<='9';
+}
+
+/**
+ * @brief Skip decimal digits.
+ * @param s String.
+ * @param pos Position to start from, after return it points to the first character that is not a digit.
+ * @return Number of skipped digits.
+ */
+inline size_t skip_digits(string_view s, size_t& pos) noexcept
 {
-   if(s.empty() || ((!isdigit(s[0])) && (s[0] != '-') && (s[0] != '+'))) return false;
+    auto start=pos;
+    while (pos<s.size() && is_digit(s[pos]))
+    {
+        ++pos;
+    }
+    return pos-start;
+}
+
+/**
+ * @brief Skip optional sign.
+ * @param s String.
+ * @param pos Position to start from, after return it points to the first character after sign.
+ */
+inline void skip_sign(string_view s, size_t& pos) noexcept
+{
+    if (pos<s.size() && (s[pos]=='-' || s[pos]=='+'))
+    {
+        ++pos;
+    }
+}
 
-   char * p;
-   strtol(s.c_str(), &p, 10);
+/**
+ * @brief Check if string is an integer number.
+ * @param s String.
+ * @return Check result.
+ *
+ * String must match [-+]?[0-9]+ pattern.
+ */
+inline bool is_integer(string_view s) noexcept
+{
+    size_t pos=0;
+    skip_sign(s,pos);
+    return skip_digits(s,pos)!=0 && pos==s.size();
+}
 
-   return (*p == 0);
+/**
+ * @brief Check if string is a floating point number.
+ * @param s String.
+ * @return Check result.
+ *
+ * String must match [-+]?[0-9]*\.?[0-9]+([eE][-+]?[0-9]+)? pattern.
+ */
+inline bool is_float(string_view s) noexcept
+{
+    size_t pos=0;
+    skip_sign(s,pos);
+    auto digits=skip_digits(s,pos);
+    if (pos<s.size() && s[pos]=='.')
+    {
+        ++pos;
+        digits=skip_digits(s,pos);
+    }
+    if (digits==0)
+    {
+        return false;
+    }
+    if (pos<s.size() && (s[pos]=='e' || s[pos]=='E'))
+    {
+        ++pos;
+        skip_sign(s,pos);
+        if (skip_digits(s,pos)==0)
+        {
+            return false;
+        }
+    }
+    return pos==s.size();
 }
+
 }
 
 /**
@@ -73,8 +151,7 @@ struct str_float_t : public op_report_without_operand<str_float_t>
     template <typename T1, typename T2>
     bool operator() (const T1& a, const T2& b) const
     {
-        static const std::regex e("[-+]?[0-9]*\\.?[0-9]+([eE][-+]?[0-9]+)?");
-        return regex_match(a,e)==b;
+        return detail::is_float(a)==b;
     }
 };
 
@@ -84,12 +84,12 @@ struct op_report_without_operand : public op_report_without_operand_t,
         return DerivedT::n_description;
     }
 
-    static auto str()
+    constexpr static auto str()
     {
         return DerivedT::description;
     }
 
-    static auto n_str()
+    constexpr static auto n_str()
     {
         return DerivedT::n_description;
     }
@@ -23,12 +23,131 @@ Distributed under the Boost Software License, Version 1.0.
 #include <boost/regex.hpp>
 
 #include <hatn/validator/config.hpp>
+#include <hatn/validator/utils/string_view.hpp>
 #include <hatn/validator/operators/operator.hpp>
 
 HATN_VALIDATOR_NAMESPACE_BEGIN
 
 //-------------------------------------------------------------
 
+namespace detail
+{
+
+/**
+ * @brief Construct std::regex from expression.
+ * @param e Expression.
+ * @return Regular expression.
+ */
+template <typename T>
+std::regex make_std_regex(const T& e)
+{
+    return std::regex(e);
+}
+
+/**
+ * @brief Construct std::regex from string view of expression.
+ * @param e Expression.
+ * @return Regular expression.
+ */
+inline std::regex make_std_regex(string_view e)
+{
+    return std::regex(e.data(),e.size());
+}
+
+/**
+ * @brief Match value against regular expression.
+ * @param a Value.
+ * @param e Regular expression.
+ * @return Match result.
+ */
+template <typename T, typename RegexT>
+bool regex_match(const T& a, const RegexT& e)
+{
+    return std::regex_match(a,e);
+}
+
+/**
+ * @brief Match string view against std::regex without copying it to string.
+ * @param a String view.
+ * @param e Regular expression.
+ * @return Match result.
+ */
+inline bool regex_match(string_view a, const std::regex& e)
+{
+    return std::regex_match(a.data(),a.data()+a.size(),e);
+}
+
+/**
+ * @brief Match value against boost::regex.
+ * @param a Value.
+ * @param e Regular expression.
+ * @return Match result.
+ */
+template <typename T>
+bool regex_match(const T& a, const boost::regex& e)
+{
+    return boost::regex_match(a,e);
+}
+
+/**
+ * @brief Match string view against boost::regex without copying it to string.
+ * @param a String view.
+ * @param e Regular expression.
+ * @return Match result.
+ */
+inline bool regex_match(string_view a, const boost::regex& e)
+{
+    return boost::regex_match(a.data(),a.data()+a.size(),e);
+}
+
+/**
+ * @brief Search regular expression in value.
+ * @param a Value.
+ * @param e Regular expression.
+ * @return Search result.
+ */
+template <typename T, typename RegexT>
+bool regex_search(const T& a, const RegexT& e)
+{
+    return std::regex_search(a,e);
+}
+
+/**
+ * @brief Search std::regex in string view without copying it to string.
+ * @param a String view.
+ * @param e Regular expression.
+ * @return Search result.
+ */
+inline bool regex_search(string_view a, const std::regex& e)
+{
+    return std::regex_search(a.data(),a.data()+a.size(),e);
+}
+
+/**
+ * @brief Search boost::regex in value.
+ * @param a Value.
+ * @param e Regular expression.
+ * @return Search result.
+ */
+template <typename T>
+bool regex_search(const T& a, const boost::regex& e)
+{
+    return boost::regex_search(a,e);
+}
+
+/**
+ * @brief Search boost::regex in string view without copying it to string.
+ * @param a String view.
+ * @param e Regular expression.
+ * @return Search result.
+ */
+inline bool regex_search(string_view a, const boost::regex& e)
+{
+    return boost::regex_search(a.data(),a.data()+a.size(),e);
+}
+
+}
+
 /**
  * @brief Definition of operator "match regular expression".
  */
@@ -40,19 +159,19 @@ struct regex_match_t : public op<regex_match_t>
     template <typename T1, typename T2>
     constexpr bool operator() (const T1& a, const T2& b) const
     {
-        return std::regex_match(a,std::regex(b));
+        return detail::regex_match(a,detail::make_std_regex(b));
     }
 
     template <typename T1>
     constexpr bool operator() (const T1& a, const std::regex& b) const
     {
-        return std::regex_match(a,b);
+        return detail::regex_match(a,b);
     }
 
     template <typename T1>
     constexpr bool operator() (const T1& a, const boost::regex& b) const
     {
-        return boost::regex_match(a,b);
+        return detail::regex_match(a,b);
     }
 };
 
@@ -92,19 +211,19 @@ struct regex_contains_t : public op<regex_contains_t>
     template <typename T1, typename T2>
     constexpr bool operator() (const T1& a, const T2& b) const
     {
-        return std::regex_search(a,std::regex(b));
+        return detail::regex_search(a,detail::make_std_regex(b));
     }
 
     template <typename T1>
     constexpr bool operator() (const T1& a, const std::regex& b) const
     {
-        return std::regex_search(a,b);
+        return detail::regex_search(a,b);
     }
 
     template <typename T1>
     constexpr bool operator() (const T1& a, const boost::regex& b) const
     {
-        return boost::regex_search(a,b);
+        return detail::regex_search(a,b);
     }
 };
 
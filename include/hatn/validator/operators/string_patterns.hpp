@@ -19,9 +19,8 @@ Distributed under the Boost Software License, Version 1.0.
 #ifndef HATN_VALIDATOR_STRING_PATTERNS_HPP
 #define HATN_VALIDATOR_STRING_PATTERNS_HPP
 
-#include <boost/regex.hpp>
-
 #include <hatn/validator/config.hpp>
+#include <hatn/validator/utils/string_view.hpp>
 #include <hatn/validator/operators/operator.hpp>
 #include <hatn/validator/operators/op_report_without_operand.hpp>
 #include <hatn/validator/operators/regex.hpp>
@@ -30,6 +29,53 @@ HATN_VALIDATOR_NAMESPACE_BEGIN
 
 //-------------------------------------------------------------
 
+namespace detail
+{
+
+/**
+ * @brief Check if string contains only letters, digits and underscores.
+ * @param s String.
+ * @return Check result.
+ *
+ * String must match [0-9a-zA-Z_]* pattern.
+ */
+inline bool is_alpha(string_view s) noexcept
+{
+    for (auto c:s)
+    {
+        if (!((c>='0' && c<='9') || (c>='a' && c<='z') || (c>='A' && c<='Z') || c=='_'))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Check if string is a hexadecimal number.
+ * @param s String.
+ * @return Check result.
+ *
+ * String must match [0-9a-fA-F]+ pattern.
+ */
+inline bool is_hex(string_view s) noexcept
+{
+    if (s.empty())
+    {
+        return false;
+    }
+    for (auto c:s)
+    {
+        if (!((c>='0' && c<='9') || (c>='a' && c<='f') || (c>='A' && c<='F')))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+}
+
 /**
  * @brief Definition of operator "must contain only alpha symbols".
  */
@@ -41,8 +87,7 @@ struct str_alpha_t : public op_report_without_operand<str_alpha_t>
     template <typename T1, typename T2>
     bool operator() (const T1& a, const T2& b) const
     {
-        static const std::regex e("[0-9a-zA-Z_]*");
-        return regex_match(a,e)==b;
+        return detail::is_alpha(a)==b;
     }
 };
 
@@ -62,8 +107,7 @@ struct str_hex_t : public op_report_without_operand<str_hex_t>
     template <typename T1, typename T2>
     bool operator() (const T1& a, const T2& b) const
     {
-        static const std::regex e("[0-9a-fA-F]+");
-        return regex_match(a,e)==b;
+        return detail::is_hex(a)==b;
     }
 };
 
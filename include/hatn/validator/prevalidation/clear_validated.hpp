@@ -20,6 +20,7 @@ Distributed under the Boost Software License, Version 1.0.
 #define HATN_VALIDATOR_CLEAR_VALIDATED_HPP
 
 #include <hatn/validator/validate.hpp>
+#include <hatn/validator/changed_paths.hpp>
 #include <hatn/validator/utils/get_it.hpp>
 #include <hatn/validator/prevalidation/validate_empty.hpp>
 #include <hatn/validator/prevalidation/validate_value.hpp>
@@ -124,6 +125,51 @@ void clear_validated(
     }
 }
 
+/**
+ * @brief Clear object's member with pre-validation with validation result put in the last but one argument and tracking of changed member.
+ * @param obj Object whose member to clear.
+ * @param member Member name.
+ * @param validator Validator to use for validation. If wrapped into strict_any then strict ANY validation will be invoked.
+ * @param err Validation result.
+ * @param changes Tracker of changed members where to add the member if it was cleared.
+ */
+template <typename ObjectT, typename MemberT, typename ValidatorT>
+void clear_validated(
+        ObjectT& obj,
+        MemberT&& member,
+        ValidatorT&& validator,
+        error_report& err,
+        changed_paths& changes
+    )
+{
+    clear_validated(obj,member,std::forward<ValidatorT>(validator),err);
+    if (!err)
+    {
+        changes.add(member);
+    }
+}
+
+/**
+ * @brief Clear object's member with pre-validation with exception if validation fails and tracking of changed member.
+ * @param obj Object whose member to clear.
+ * @param member Member name.
+ * @param validator Validator to use for validation. If wrapped into strict_any then strict ANY validation will be invoked.
+ * @param changes Tracker of changed members where to add the member if it was cleared.
+ *
+ * @throws validation_error if validation fails.
+ */
+template <typename ObjectT, typename MemberT, typename ValidatorT>
+void clear_validated(
+        ObjectT& obj,
+        MemberT&& member,
+        ValidatorT&& validator,
+        changed_paths& changes
+    )
+{
+    clear_validated(obj,member,std::forward<ValidatorT>(validator));
+    changes.add(member);
+}
+
 HATN_VALIDATOR_NAMESPACE_END
 
 #endif // HATN_VALIDATOR_CLEAR_VALIDATED_HPP
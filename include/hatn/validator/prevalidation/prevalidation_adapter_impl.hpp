@@ -32,6 +32,7 @@ Distributed under the Boost Software License, Version 1.0.
 #include <hatn/validator/utils/value_as_container.hpp>
 #include <hatn/validator/prevalidation/strict_any.hpp>
 #include <hatn/validator/range.hpp>
+#include <hatn/validator/detail/validate_range.hpp>
 #include <hatn/validator/filter_member.hpp>
 
 HATN_VALIDATOR_NAMESPACE_BEGIN
@@ -71,26 +72,7 @@ class prevalidation_adapter_impl : public strict_any_tag
                 hana::is_a<range_tag,decltype(obj)>,
                 [&](auto&& _)
                 {
-                    auto ok=!any;
-                    for (auto&& it : _(obj).container)
-                    {
-                        ok=op(property(it,prop),val);
-                        if (any)
-                        {
-                            if (ok)
-                            {
-                               break;
-                            }
-                        }
-                        else
-                        {
-                            if (!ok)
-                            {
-                                break;
-                            }
-                        }
-                    }
-                    return ok;
+                    return detail::validate_range(_(obj).container,prop,op,val,any,_(obj).threads);
                 },
                 [&](auto&&)
                 {
@@ -176,6 +158,11 @@ class prevalidation_adapter_impl : public strict_any_tag
             {
                 return status(status::code::ignore);
             }
+            if (is_exists_check())
+            {
+                // [exists] suffix is checked only in validate_exists(), otherwise it would match element aggregations
+                return status(status::code::ignore);
+            }
 
             const auto& obj=extract(traits_of(adpt).get());
             return hana::if_(
@@ -280,7 +267,7 @@ class prevalidation_adapter_impl : public strict_any_tag
         template <typename AdapterT, typename T2, typename OpT, typename PropT, typename MemberT>
         status validate_with_master_sample(AdapterT&& adpt, MemberT&& member, PropT&& prop, OpT&& op, T2&& b) const
         {
-            if (member.has_any() && !is_strict_any())
+            if ((member.has_any() && !is_strict_any()) || is_exists_check())
             {
                 return status(status::code::ignore);
             }
@@ -403,6 +390,11 @@ class prevalidation_adapter_impl : public strict_any_tag
 
     private:
 
+        constexpr static bool is_exists_check() noexcept
+        {
+            return std::is_same<std::decay_t<decltype(exists)>,std::decay_t<decltype(std::declval<CheckMemberT>().key())>>::value;
+        }
+
         template <typename MemberT>
         bool filter_member(const MemberT& member) const noexcept
         {
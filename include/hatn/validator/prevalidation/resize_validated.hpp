@@ -24,6 +24,7 @@ Distributed under the Boost Software License, Version 1.0.
 #include <hatn/validator/get_member.hpp>
 #include <hatn/validator/prevalidation/true_if_size.hpp>
 #include <hatn/validator/prevalidation/validate_value.hpp>
+#include <hatn/validator/changed_paths.hpp>
 
 HATN_VALIDATOR_NAMESPACE_BEGIN
 
@@ -135,6 +136,55 @@ void resize_validated(
     }
 }
 
+/**
+ * @brief Resize object's member with pre-validation with validation result put in the last but one argument and tracking of changed member.
+ * @param obj Object whose member to resize.
+ * @param member Member name.
+ * @param size New size.
+ * @param validator Validator to use for validation.
+ * @param err Validation result.
+ * @param changes Tracker of changed members where to add the member if it was resized.
+ */
+template <typename ObjectT, typename MemberT, typename SizeT, typename ValidatorT>
+void resize_validated(
+        ObjectT& obj,
+        MemberT&& member,
+        SizeT&& size,
+        ValidatorT&& validator,
+        error_report& err,
+        changed_paths& changes
+    )
+{
+    resize_validated(obj,member,std::forward<SizeT>(size),std::forward<ValidatorT>(validator),err);
+    if (!err)
+    {
+        changes.add(member);
+    }
+}
+
+/**
+ * @brief Resize object's member with pre-validation with exception if validation fails and tracking of changed member.
+ * @param obj Object whose member to resize.
+ * @param member Member name.
+ * @param size New size.
+ * @param validator Validator to use for validation.
+ * @param changes Tracker of changed members where to add the member if it was resized.
+ *
+ * @throws validation_error if validation fails.
+ */
+template <typename ObjectT, typename MemberT, typename SizeT, typename ValidatorT>
+void resize_validated(
+        ObjectT& obj,
+        MemberT&& member,
+        SizeT&& size,
+        ValidatorT&& validator,
+        changed_paths& changes
+    )
+{
+    resize_validated(obj,member,std::forward<SizeT>(size),std::forward<ValidatorT>(validator));
+    changes.add(member);
+}
+
 HATN_VALIDATOR_NAMESPACE_END
 
 #endif // HATN_VALIDATOR_RESIZE_VALIDATED_HPP
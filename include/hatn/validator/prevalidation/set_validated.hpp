@@ -20,6 +20,7 @@ Distributed under the Boost Software License, Version 1.0.
 #define HATN_VALIDATOR_SET_VALIDATED_HPP
 
 #include <hatn/validator/validate.hpp>
+#include <hatn/validator/changed_paths.hpp>
 #include <hatn/validator/properties/size.hpp>
 #include <hatn/validator/properties/empty.hpp>
 #include <hatn/validator/utils/unwrap_object.hpp>
@@ -126,6 +127,55 @@ void set_validated(
     }
 }
 
+/**
+ * @brief Set object's member with pre-validation with validation result put in the last but one argument and tracking of changed member.
+ * @param obj Object whose member to set.
+ * @param member Member name.
+ * @param val Value to set.
+ * @param validator Validator to use for validation.
+ * @param err Validation result.
+ * @param changes Tracker of changed members where to add the member if it was set.
+ */
+template <typename ObjectT, typename MemberT, typename ValueT, typename ValidatorT>
+void set_validated(
+        ObjectT& obj,
+        MemberT&& member,
+        ValueT&& val,
+        ValidatorT&& validator,
+        error_report& err,
+        changed_paths& changes
+    )
+{
+    set_validated(obj,member,std::forward<ValueT>(val),std::forward<ValidatorT>(validator),err);
+    if (!err)
+    {
+        changes.add(member);
+    }
+}
+
+/**
+ * @brief Set object's member with pre-validation with exception if validation fails and tracking of changed member.
+ * @param obj Object whose member to set.
+ * @param member Member name.
+ * @param val Value to set.
+ * @param validator Validator to use for validation.
+ * @param changes Tracker of changed members where to add the member if it was set.
+ *
+ * @throws validation_error if validation fails.
+ */
+template <typename ObjectT, typename MemberT, typename ValueT, typename ValidatorT>
+void set_validated(
+        ObjectT& obj,
+        MemberT&& member,
+        ValueT&& val,
+        ValidatorT&& validator,
+        changed_paths& changes
+    )
+{
+    set_validated(obj,member,std::forward<ValueT>(val),std::forward<ValidatorT>(validator));
+    changes.add(member);
+}
+
 HATN_VALIDATOR_NAMESPACE_END
 
 #endif // HATN_VALIDATOR_SET_VALIDATED_HPP
@@ -0,0 +1,212 @@
+/**
+@copyright Evgeny Sidorov 2020
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+*/
+
+/****************************************************************************/
+
+/** @file validator/prevalidation/set_validated_batch.hpp
+*
+*  Defines "set_validated_batch" helpers for validated update of multiple members.
+*
+*/
+
+/****************************************************************************/
+
+#ifndef HATN_VALIDATOR_SET_VALIDATED_BATCH_HPP
+#define HATN_VALIDATOR_SET_VALIDATED_BATCH_HPP
+
+#include <string>
+
+#include <hatn/validator/prevalidation/set_validated.hpp>
+
+HATN_VALIDATOR_NAMESPACE_BEGIN
+
+namespace detail
+{
+
+/**
+ * @brief Pre-validate all members' values using the same reporter.
+ * @param values Foldable of hana::pair(member,value).
+ * @param validator Validator to use for validation.
+ * @param dst Destination object where to put validation report.
+ * @return Validation status of the first failed member or success status.
+ */
+template <typename ValuesT, typename ValidatorT>
+status prevalidate_batch(
+        const ValuesT& values,
+        const ValidatorT& validator,
+        std::string& dst
+    )
+{
+    auto reporter=make_reporter(dst);
+    status ret;
+    hana::for_each(values,
+        [&](const auto& member_value)
+        {
+            if (!ret)
+            {
+                return;
+            }
+            ret=extract_strict_any(validator).apply(
+                        make_prevalidation_adapter(
+                            hana::first(member_value),
+                            wrap_strict_any(hana::second(member_value),validator),
+                            reporter
+                        )
+                    );
+        }
+    );
+    return ret;
+}
+
+/**
+ * @brief Write values to members of object.
+ * @param obj Object whose members to set.
+ * @param values Foldable of hana::pair(member,value), if it is rvalue then values are moved to the object.
+ */
+template <typename ObjectT, typename ValuesT>
+void set_members_batch(
+        ObjectT& obj,
+        ValuesT&& values
+    )
+{
+    hana::for_each(std::forward<ValuesT>(values),
+        [&](auto&& member_value)
+        {
+            set_member(obj,
+                       hana::first(member_value),
+                       hana::second(std::forward<decltype(member_value)>(member_value))
+                    );
+        }
+    );
+}
+
+}
+
+/**
+ * @brief Set multiple members of object with pre-validation with validation result put in the last argument.
+ * @param obj Object whose members to set.
+ * @param values Foldable, e.g. hana::tuple, of hana::pair(member,value). If it is rvalue then values are moved to the object.
+ * @param validator Validator to use for validation.
+ * @param err Validation result.
+ *
+ * All values are pre-validated first with a single reporter, the pre-validation stops at the first failed member.
+ * Object is updated only if all values passed pre-validation, otherwise the object is left unchanged.
+ *
+ * @note Only basic exception safety is provided. Members are set one by one, so if setting of a member throws
+ * then the members that precede it in the batch are already updated. Use set_validated_batch_staged() if
+ * the object must be left unchanged in that case.
+ */
+template <typename ObjectT, typename ValuesT, typename ValidatorT>
+void set_validated_batch(
+        ObjectT& obj,
+        ValuesT&& values,
+        ValidatorT&& validator,
+        error_report& err
+    )
+{
+    std::string message;
+    auto st=detail::prevalidate_batch(values,validator,message);
+    err=error_report(st,std::move(message));
+    if (!err)
+    {
+        detail::set_members_batch(obj,std::forward<ValuesT>(values));
+    }
+}
+
+/**
+ * @brief Set multiple members of object with pre-validation with exception if validation fails.
+ * @param obj Object whose members to set.
+ * @param values Foldable, e.g. hana::tuple, of hana::pair(member,value). If it is rvalue then values are moved to the object.
+ * @param validator Validator to use for validation.
+ *
+ * @throws validation_error if validation fails.
+ *
+ * @note See note to overloaded function.
+ */
+template <typename ObjectT, typename ValuesT, typename ValidatorT>
+void set_validated_batch(
+        ObjectT& obj,
+        ValuesT&& values,
+        ValidatorT&& validator
+    )
+{
+    error_report err;
+    set_validated_batch(obj,std::forward<ValuesT>(values),std::forward<ValidatorT>(validator),err);
+    if (err)
+    {
+        throw validation_error(err);
+    }
+}
+
+/**
+ * @brief Set multiple members of object with pre-validation and validation of staged object with validation result put in the last argument.
+ * @param obj Object whose members to set.
+ * @param values Foldable, e.g. hana::tuple, of hana::pair(member,value). If it is rvalue then values are moved to the object.
+ * @param validator Validator to use for validation.
+ * @param err Validation result.
+ *
+ * All values are pre-validated first. Then the values are written to a staged copy of the object
+ * and the whole staged copy is validated, that is how the conditions involving other members are checked.
+ * If validation of the staged copy succeeds then it is moved to the object, otherwise the object is left unchanged.
+ *
+ * @note The whole object is copied, not only the members that are set. If setting of a member throws
+ * then only the copy is affected, so the object is left unchanged unless move assignment of the object throws.
+ */
+template <typename ObjectT, typename ValuesT, typename ValidatorT>
+void set_validated_batch_staged(
+        ObjectT& obj,
+        ValuesT&& values,
+        ValidatorT&& validator,
+        error_report& err
+    )
+{
+    std::string message;
+    auto st=detail::prevalidate_batch(values,validator,message);
+    if (!st)
+    {
+        err=error_report(st,std::move(message));
+        return;
+    }
+
+    auto staged=obj;
+    detail::set_members_batch(staged,std::forward<ValuesT>(values));
+    validate(staged,extract_strict_any(validator),err);
+    if (!err)
+    {
+        obj=std::move(staged);
+    }
+}
+
+/**
+ * @brief Set multiple members of object with pre-validation and validation of staged object with exception if validation fails.
+ * @param obj Object whose members to set.
+ * @param values Foldable, e.g. hana::tuple, of hana::pair(member,value). If it is rvalue then values are moved to the object.
+ * @param validator Validator to use for validation.
+ *
+ * @throws validation_error if validation fails.
+ *
+ * @note See note to overloaded function.
+ */
+template <typename ObjectT, typename ValuesT, typename ValidatorT>
+void set_validated_batch_staged(
+        ObjectT& obj,
+        ValuesT&& values,
+        ValidatorT&& validator
+    )
+{
+    error_report err;
+    set_validated_batch_staged(obj,std::forward<ValuesT>(values),std::forward<ValidatorT>(validator),err);
+    if (err)
+    {
+        throw validation_error(err);
+    }
+}
+
+HATN_VALIDATOR_NAMESPACE_END
+
+#endif // HATN_VALIDATOR_SET_VALIDATED_BATCH_HPP
@@ -20,6 +20,7 @@ Distributed under the Boost Software License, Version 1.0.
 #define HATN_VALIDATOR_UNSET_VALIDATED_HPP
 
 #include <hatn/validator/validate.hpp>
+#include <hatn/validator/changed_paths.hpp>
 
 HATN_VALIDATOR_NAMESPACE_BEGIN
 
@@ -87,7 +88,7 @@ void unset_validated(
     {
         // check "contains" operator
         hana::eval_if(
-            hana::bool_<MemberT::is_nested>{},
+            hana::bool_<std::decay_t<MemberT>::is_nested>{},
             [&](auto&& _)
             {
                 validate(
@@ -134,6 +135,51 @@ void unset_validated(
     }
 }
 
+/**
+ * @brief Unset object's member with pre-validation with validation result put in the last but one argument and tracking of changed member.
+ * @param obj Object whose member to unset.
+ * @param member Member.
+ * @param validator Validator to use for validation. If wrapped into strict_any then strict ANY validation will be invoked.
+ * @param err Validation result.
+ * @param changes Tracker of changed members where to add the member if it was unset.
+ */
+template <typename ObjectT, typename MemberT, typename ValidatorT>
+void unset_validated(
+        ObjectT& obj,
+        MemberT&& member,
+        ValidatorT&& validator,
+        error_report& err,
+        changed_paths& changes
+    )
+{
+    unset_validated(obj,member,std::forward<ValidatorT>(validator),err);
+    if (!err)
+    {
+        changes.add(member);
+    }
+}
+
+/**
+ * @brief Unset object's member with pre-validation with exception if validation fails and tracking of changed member.
+ * @param obj Object whose member to unset.
+ * @param member Member.
+ * @param validator Validator to use for validation. If wrapped into strict_any then strict ANY validation will be invoked.
+ * @param changes Tracker of changed members where to add the member if it was unset.
+ *
+ * @throws validation_error if validation fails.
+ */
+template <typename ObjectT, typename MemberT, typename ValidatorT>
+void unset_validated(
+        ObjectT& obj,
+        MemberT&& member,
+        ValidatorT&& validator,
+        changed_paths& changes
+    )
+{
+    unset_validated(obj,member,std::forward<ValidatorT>(validator));
+    changes.add(member);
+}
+
 HATN_VALIDATOR_NAMESPACE_END
 
 #endif // HATN_VALIDATOR_UNSET_VALIDATED_HPP
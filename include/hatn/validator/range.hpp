@@ -19,6 +19,7 @@ Distributed under the Boost Software License, Version 1.0.
 #ifndef HATN_VALIDATOR_RANGE_HPP
 #define HATN_VALIDATOR_RANGE_HPP
 
+#include <string>
 #include <vector>
 
 #include <hatn/validator/config.hpp>
@@ -51,17 +52,21 @@ struct range_t
      * @brief Constructor.
      * @param container Container to be wrapped into range.
      * @param max_report_elements Max number of range elements to be listed in report.
+     * @param threads Max number of threads used to prevalidate elements of the range.
      */
     template <typename T1>
     range_t(
             T1&& container,
-            size_t max_report_elements=(std::numeric_limits<size_t>::max)()
+            size_t max_report_elements=(std::numeric_limits<size_t>::max)(),
+            size_t threads=1
         ) : container(std::forward<T1>(container)),
-            max_report_elements(max_report_elements)
+            max_report_elements(max_report_elements),
+            threads(threads)
     {}
 
     T container;
     size_t max_report_elements;
+    size_t threads;
 };
 
 /**
@@ -203,6 +208,30 @@ struct range_helper
 };
 constexpr range_helper range{};
 
+/**
+ * @brief Helper for building ranges whose elements are prevalidated in parallel threads.
+ */
+struct parallel_range_helper
+{
+    /**
+     * @brief Make range from container.
+     * @param container Container to wrap in range object.
+     * @param threads Max number of threads used to prevalidate elements of the range.
+     * @param max_report_elements Max number of range elements to be listed in report.
+     * @return Range.
+     *
+     * Parallel prevalidation is worth only for expensive operators or huge ranges, because a thread is started for each chunk of the range.
+     * Operators and properties used with the range must be safe to use in concurrent threads.
+     * Containers without random access iterators are prevalidated in the calling thread.
+     */
+    template <typename T>
+    auto operator() (T&& container, size_t threads, size_t max_report_elements=(std::numeric_limits<size_t>::max)()) const
+    {
+        return range_t<T>(std::forward<T>(container),max_report_elements,threads);
+    }
+};
+constexpr parallel_range_helper parallel_range{};
+
 /**
  * @brief String representation of range to be used in reporting.
  */
@@ -244,70 +273,84 @@ struct format_operand_t<T,hana::when<hana::is_a<range_tag,T>>>
     template <typename TraitsT, typename T1>
     auto operator () (const TraitsT& traits, T1&& val, grammar_categories cats) const
     {
-        // format each element up to max_report_elements
-        auto count=(std::min)(val.max_report_elements,val.container.size());
-        bool append_ellipsis=count<val.container.size();
-        using value_type=typename std::decay_t<decltype(val.container)>::value_type;
-        using element_type=decltype(format_operand<value_type>(std::declval<TraitsT>(),std::declval<value_type>(),std::declval<bool>()));
-        std::vector<element_type> elements;
-        elements.reserve(count);
-        for (auto&& it:val.container)
-        {
-            if (count>0)
+        return hana::eval_if(
+            detail::is_identity_postprocessing<TraitsT>{},
+            [&](auto&& _)
             {
-                elements.push_back(
-                    format_operand<element_type>(traits,it,false)
-                );
-            }
-            else
+                // neither translate nor decorate, format the whole operand in place
+                const char* descr=range_str_t::description;
+                std::string dst;
+                backend_formatter.append(dst,descr," [");
+                append_elements(dst,_(traits),_(val));
+                dst.push_back(']');
+                return dst;
+            },
+            [&](auto&& _)
             {
-                break;
+                // wrap elements into braces
+                std::string dst{"["};
+                append_elements(dst,_(traits),_(val));
+                dst.push_back(']');
+
+                // decorate operand
+                auto formatted_operand=decorate(_(traits),std::move(dst));
+
+                // prepend description
+                auto descr=translate(_(traits),std::string(range_str),cats);
+                std::string dst1;
+                backend_formatter.append(
+                   dst1,
+                   descr,
+                   " ",
+                   formatted_operand
+                );
+                return dst1;
             }
-            --count;
-        }
-
-        // join elements
-        std::string dst;
-        backend_formatter.append_join(
-           dst,
-           ", ",
-            elements
         );
+    }
 
-        // append ellipsis if contaner size exceeds max_report_elements
-        if (append_ellipsis)
+    private:
+
+        /**
+         * @brief Append elements of the range to destination string.
+         * @param dst Destination string.
+         * @param traits Formatter traits.
+         * @param val Range.
+         *
+         * Elements are appended one by one up to max_report_elements.
+         * The list of elements is trimmed the same way as if it was joined with backend formatter.
+         */
+        template <typename TraitsT, typename T1>
+        static void append_elements(std::string& dst, const TraitsT& traits, const T1& val)
         {
-            backend_formatter.append(
-               dst,
-               ", ... "
-            );
-        }
-
-        // wrap into braces
-        std::string dst1;
-        backend_formatter.append(
-           dst1,
-           "[",
-           dst,
-           "]"
-        );
-
-        // decorate operand
-        auto formatted_operand=decorate(traits,std::move(dst1));
-
-        // prepend description
-        auto descr=translate(traits,std::string(range_str),cats);
-        std::string dst2;
-        backend_formatter.append(
-           dst2,
-           descr,
-           " ",
-           formatted_operand
-        );
+            auto count=(std::min)(val.max_report_elements,val.container.size());
+            bool append_ellipsis=count<val.container.size();
+            using value_type=typename std::decay_t<decltype(val.container)>::value_type;
+            using element_type=decltype(format_operand<value_type>(std::declval<TraitsT>(),std::declval<value_type>(),std::declval<bool>()));
+
+            auto offset=dst.size();
+            size_t i=0;
+            for (auto&& it:val.container)
+            {
+                if (i==count)
+                {
+                    break;
+                }
+                if (i!=0)
+                {
+                    dst.append(", ",2);
+                }
+                detail::append_operand_element<element_type>(dst,traits,it);
+                ++i;
+            }
+            detail::trim_sequence(dst,offset);
 
-        // done
-        return dst2;
-    }
+            // append ellipsis if contaner size exceeds max_report_elements
+            if (append_ellipsis)
+            {
+                dst.append(", ... ",6);
+            }
+        }
 };
 
 //-------------------------------------------------------------
@@ -90,6 +90,47 @@ constexpr string_conjunction_of_t string_conjunction_of{};
 
 //-------------------------------------------------------------
 
+/**
+ * @brief String descriptions helper for list of elements in summary of aggregation failures.
+ */
+struct string_summary_elements_t : public enable_to_string<string_summary_elements_t>
+{
+    constexpr static const char* description="elements";
+};
+
+/**
+ * @brief Instance of string descriptions helper for list of elements in summary of aggregation failures.
+ */
+constexpr string_summary_elements_t string_summary_elements{};
+
+/**
+ * @brief String descriptions helper for single omitted failure in summary of aggregation failures.
+ */
+struct string_summary_omitted_single_t : public enable_to_string<string_summary_omitted_single_t>
+{
+    constexpr static const char* description="more failed element";
+};
+
+/**
+ * @brief Instance of string descriptions helper for single omitted failure in summary of aggregation failures.
+ */
+constexpr string_summary_omitted_single_t string_summary_omitted_single{};
+
+/**
+ * @brief String descriptions helper for number of omitted failures in summary of aggregation failures.
+ */
+struct string_summary_omitted_t : public enable_to_string<string_summary_omitted_t>
+{
+    constexpr static const char* description="more failed elements";
+};
+
+/**
+ * @brief Instance of string descriptions helper for number of omitted failures in summary of aggregation failures.
+ */
+constexpr string_summary_omitted_t string_summary_omitted{};
+
+//-------------------------------------------------------------
+
 HATN_VALIDATOR_NAMESPACE_END
 
 #endif // HATN_VALIDATOR_AGGREGATION_STRINGS_HPP
@@ -19,7 +19,8 @@ Distributed under the Boost Software License, Version 1.0.
 #ifndef HATN_VALIDATOR_BACKEND_FORMATTER_HPP
 #define HATN_VALIDATOR_BACKEND_FORMATTER_HPP
 
-#include <boost/algorithm/string/trim.hpp>
+#include <cstddef>
+#include <locale>
 
 #include <hatn/validator/config.hpp>
 #include <hatn/validator/utils/reference_wrapper.hpp>
@@ -27,6 +28,76 @@ Distributed under the Boost Software License, Version 1.0.
 
 HATN_VALIDATOR_NAMESPACE_BEGIN
 
+namespace detail
+{
+
+HATN_VALIDATOR_INLINE_LAMBDA auto has_trim = hana::is_valid([](auto&& v) -> decltype((void)v.trim()){});
+
+/**
+ * @brief Trim whitespaces at both ends of a sequence of chars.
+ * @param dst Sequence of chars.
+ * @param offset Offset in the sequence where leading whitespaces are looked for, chars before the offset are kept as is.
+ *
+ * Only whitespaces at the ends are scanned and the ctype facet of global locale is looked up only once,
+ * the result is the same as of boost::trim().
+ */
+template <typename DstT>
+void trim_sequence(DstT& dst, size_t offset=0)
+{
+    const auto& ctype=std::use_facet<std::ctype<char>>(std::locale());
+    auto is_space=[&ctype](char ch)
+    {
+        return ctype.is(std::ctype_base::space,ch);
+    };
+
+    auto shift=static_cast<std::ptrdiff_t>(offset);
+    auto end=dst.end();
+    auto it=end;
+    while (it!=dst.begin()+shift && is_space(*(it-1)))
+    {
+        --it;
+    }
+    if (it!=end)
+    {
+        dst.erase(it,end);
+    }
+
+    auto first=dst.begin()+shift;
+    it=first;
+    while (it!=dst.end() && is_space(*it))
+    {
+        ++it;
+    }
+    if (it!=first)
+    {
+        dst.erase(first,it);
+    }
+}
+
+/**
+ * @brief Trim whitespaces at both ends of destination object.
+ * @param dst Destination object.
+ *
+ * If destination object has method trim() then that method is used, otherwise the object is trimmed as a sequence of chars.
+ */
+template <typename DstT>
+void trim_dst(DstT& dst)
+{
+    hana::eval_if(
+        has_trim(dst),
+        [&](auto&& _)
+        {
+            _(dst).trim();
+        },
+        [&](auto&& _)
+        {
+            trim_sequence(_(dst));
+        }
+    );
+}
+
+}
+
 /**
  * @brief Backend formatter.
  *
@@ -55,7 +126,7 @@ struct backend_formatter_t
     static void append_join_args(DstT& dst, SepT&& sep, Args&&... args)
     {
         detail::backend_formatter_helper<DstT>::append_join_args(dst,std::forward<SepT>(sep),std::forward<Args>(args)...);
-        boost::trim(detail::to_dst(dst));
+        detail::trim_dst(detail::to_dst(dst));
     }
 
     /**
@@ -68,7 +139,7 @@ struct backend_formatter_t
     static void append_join(DstT& dst, SepT&& sep, PartsT&& parts)
     {
         detail::backend_formatter_helper<DstT>::append_join(dst,std::forward<SepT>(sep),std::forward<PartsT>(parts));
-        boost::trim(detail::to_dst(dst));
+        detail::trim_dst(detail::to_dst(dst));
     }
 };
 
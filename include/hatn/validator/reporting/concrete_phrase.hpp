@@ -20,8 +20,10 @@ Distributed under the Boost Software License, Version 1.0.
 #define HATN_VALIDATOR_CONCRETE_PHRASE_HPP
 
 #include <string>
+#include <ostream>
 
 #include <hatn/validator/config.hpp>
+#include <hatn/validator/utils/string_view.hpp>
 #include <hatn/validator/reporting/grammar_categories.hpp>
 
 HATN_VALIDATOR_NAMESPACE_BEGIN
@@ -34,6 +36,10 @@ struct concrete_phrase_tag;
  * @brief Final result of text processing that must not be altered any more.
  *
  * Concrete phrase contains text of the phrase and bitmask of grammatical categories of the phrase actual for current locale.
+ *
+ * Phrase can either own its text or refer to text stored elsewhere, see concrete_phrase::ref().
+ * The latter is used by translators that keep their translations in persistent storage
+ * so that translated phrases are not copied on each lookup.
  */
 class concrete_phrase
 {
@@ -46,7 +52,8 @@ class concrete_phrase
          */
         concrete_phrase(
             ) : _grammar_cats(0),
-                _empty(true)
+                _empty(true),
+                _is_ref(false)
         {}
 
         /**
@@ -57,7 +64,8 @@ class concrete_phrase
                 std::string text
             ) : _text(std::move(text)),
                 _grammar_cats(0),
-                _empty(false)
+                _empty(false),
+                _is_ref(false)
         {}
 
         /**
@@ -70,7 +78,8 @@ class concrete_phrase
                 grammar_categories grammar_cats
             ) : _text(std::move(text)),
                 _grammar_cats(grammar_cats),
-                _empty(false)
+                _empty(false),
+                _is_ref(false)
         {}
 
         /**
@@ -82,8 +91,10 @@ class concrete_phrase
                 concrete_phrase&& phrase,
                 grammar_categories grammar_cats
             ) : _text(std::move(phrase._text)),
+                _ref(phrase._ref),
                 _grammar_cats(grammar_cats),
-                _empty(false)
+                _empty(false),
+                _is_ref(phrase._is_ref)
         {}
 
         /**
@@ -97,7 +108,8 @@ class concrete_phrase
                 T grammar_cat
             ) : _text(std::move(text)),
                 _grammar_cats(grammar_category<T>.bit(grammar_cat)),
-                _empty(false)
+                _empty(false),
+                _is_ref(false)
         {}
 
         /**
@@ -111,7 +123,8 @@ class concrete_phrase
                 const std::initializer_list<T>& grammar_cats
             ) : _text(std::move(text)),
                 _grammar_cats(grammar_category<T>.bits(grammar_cats)),
-                _empty(false)
+                _empty(false),
+                _is_ref(false)
         {}
 
         /**
@@ -127,9 +140,26 @@ class concrete_phrase
                 _grammar_cats(grammar_category<
                                 std::decay_t<typename std::tuple_element<0,std::tuple<GrammarCats...>>::type>
                               >.bits(std::forward<GrammarCats>(grammar_cats)...)),
-                _empty(false)
+                _empty(false),
+                _is_ref(false)
         {}
 
+        /**
+         * @brief Create phrase that refers to text stored elsewhere.
+         * @param text Text of the phrase, it must outlive the phrase and all its copies.
+         * @param grammar_cats Bitmask of grammatical categories of the phrase.
+         * @return Phrase that does not own its text.
+         */
+        static concrete_phrase ref(string_view text, grammar_categories grammar_cats=0) noexcept
+        {
+            concrete_phrase phrase;
+            phrase._ref=text;
+            phrase._grammar_cats=grammar_cats;
+            phrase._empty=false;
+            phrase._is_ref=true;
+            return phrase;
+        }
+
         /**
          * @brief Get grammatical categories of the phrase.
          * @return Bitmask of grammatical categories.
@@ -145,16 +175,42 @@ class concrete_phrase
          */
         std::string text() const
         {
+            if (_is_ref)
+            {
+                return std::string(_ref.data(),_ref.size());
+            }
             return _text;
         }
 
+        /**
+         * @brief Get view of the text of the phrase without copying.
+         * @return View of the text that is valid as long as the phrase or the referred text is valid.
+         */
+        string_view view() const noexcept
+        {
+            if (_is_ref)
+            {
+                return _ref;
+            }
+            return string_view(_text.data(),_text.size());
+        }
+
+        /**
+         * @brief Check if the phrase refers to text stored elsewhere.
+         * @return Boolean flag.
+         */
+        bool is_ref() const noexcept
+        {
+            return _is_ref;
+        }
+
         /**
          * @brief Convert the phrase to string.
          * @return Text.
          */
         operator std::string() const
         {
-            return _text;
+            return text();
         }
 
         /**
@@ -165,6 +221,7 @@ class concrete_phrase
         {
             _text=std::move(text);
             _empty=false;
+            _is_ref=false;
         }
 
         /**
@@ -185,7 +242,8 @@ class concrete_phrase
          */
         friend std::ostream& operator<<(std::ostream& os, const concrete_phrase& ph)
         {
-            return os << ph.text();
+            auto v=ph.view();
+            return os.write(v.data(),static_cast<std::streamsize>(v.size()));
         }
 
         /**
@@ -205,13 +263,16 @@ class concrete_phrase
             _text.clear();
             _grammar_cats=0;
             _empty=true;
+            _is_ref=false;
         }
 
     private:
 
         std::string _text;
+        string_view _ref;
         grammar_categories _grammar_cats;
         bool _empty;
+        bool _is_ref;
 };
 
 //-------------------------------------------------------------
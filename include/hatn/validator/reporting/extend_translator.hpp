@@ -62,6 +62,22 @@ struct extend_translator_t : public translator
         return base.translate(id,cats);
     }
 
+    /**
+     * @brief Translate a string given as string view.
+     * @param id String id.
+     * @param cats Grammar categories to look for.
+     * @return Translated string or id if such string not found.
+     */
+    virtual translation_result find(string_view id, grammar_categories cats=0) const override
+    {
+        auto result=extension.find(id,cats);
+        if (result)
+        {
+            return result;
+        }
+        return base.find(id,cats);
+    }
+
     BaseTranslatorT base;
     ExtentionTranslatorT extension;
 };
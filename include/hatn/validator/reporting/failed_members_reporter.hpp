@@ -126,6 +126,21 @@ class failed_members_reporter
             }
         }
 
+        /**
+         * @brief Notify that validation of next element of element aggregation begins.
+         */
+        void aggregate_element(size_t)
+        {}
+
+        /**
+         * @brief Notify that validation of current element of element aggregation failed.
+         * @return Always false because failures are never summarized by this reporter.
+         */
+        bool aggregate_element_failed() const noexcept
+        {
+            return false;
+        }
+
         /**
          *  @brief Report validation of object at one level without member nesting.
          *  @param op Operator for validation.
@@ -302,6 +317,10 @@ class failed_members_reporter
         template <typename MemberT>
         void drop_failed_member(const MemberT& member)
         {
+            if (_members.empty())
+            {
+                return;
+            }
             std::string m=dotted_member_names(member);
             auto it=std::find(std::begin(_members),std::end(_members),m);
             if (it!=std::end(_members))
@@ -382,7 +401,7 @@ class failed_members_reporter
             }
         }
 
-        std::vector<empty_report_aggregation> _stack;
+        report_aggregation_stack<empty_report_aggregation> _stack;
         size_t _not_count;
         size_t _explicit_reporting_count;
 
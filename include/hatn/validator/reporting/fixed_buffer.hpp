@@ -0,0 +1,241 @@
+/**
+@copyright Evgeny Sidorov 2020
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+*/
+
+/****************************************************************************/
+
+/** @file validator/reporting/fixed_buffer.hpp
+*
+*  Defines report destination that wraps a caller-provided buffer of fixed size.
+*
+*/
+
+/****************************************************************************/
+
+#ifndef HATN_VALIDATOR_FIXED_BUFFER_HPP
+#define HATN_VALIDATOR_FIXED_BUFFER_HPP
+
+#include <string>
+#include <cstring>
+
+#include <hatn/validator/config.hpp>
+#include <hatn/validator/utils/string_view.hpp>
+
+HATN_VALIDATOR_NAMESPACE_BEGIN
+
+//-------------------------------------------------------------
+
+/**
+ * @brief Report destination that writes to a caller-provided buffer of fixed size.
+ *
+ * The buffer is never reallocated. If a report does not fit into the buffer then the report is truncated
+ * and truncated() returns true. Content of the buffer is always terminated with zero,
+ * so at most capacity-1 chars of a report can be written to the buffer.
+ *
+ * Reports are written to the buffer directly. Only reports of nested aggregations are prepared in intermediate
+ * strings before they are written to the buffer, see part_type.
+ *
+ * @code
+ * char buf[256];
+ * fixed_buffer dst{buf};
+ * auto ra=make_reporting_adapter(obj,dst);
+ * @endcode
+ */
+class fixed_buffer
+{
+    public:
+
+        using value_type=char;
+        using size_type=size_t;
+        using iterator=char*;
+        using const_iterator=const char*;
+        using reference=char&;
+        using const_reference=const char&;
+
+        /**
+         * @brief Type of intermediate parts of reports.
+         */
+        using part_type=std::string;
+
+        /**
+         * @brief Constructor.
+         * @param data Buffer.
+         * @param capacity Size of the buffer including terminating zero.
+         */
+        fixed_buffer(char* data, size_t capacity) noexcept
+            : _data(data),
+              _capacity(capacity),
+              _size(0),
+              _truncated(false)
+        {
+            terminate();
+        }
+
+        /**
+         * @brief Constructor from array.
+         * @param data Array of chars.
+         */
+        template <size_t N>
+        fixed_buffer(char (&data)[N]) noexcept
+            : fixed_buffer(data,N)
+        {}
+
+        /**
+         * @brief Append char.
+         * @param ch Char to append.
+         */
+        void push_back(char ch) noexcept
+        {
+            if (_size<max_size())
+            {
+                _data[_size++]=ch;
+                terminate();
+            }
+            else
+            {
+                _truncated=true;
+            }
+        }
+
+        /**
+         * @brief Append chars.
+         * @param str Chars to append.
+         * @param size Number of chars.
+         */
+        void append(const char* str, size_t size) noexcept
+        {
+            auto available=max_size()-_size;
+            if (size>available)
+            {
+                size=available;
+                _truncated=true;
+            }
+            if (size!=0)
+            {
+                std::memcpy(_data+_size,str,size);
+                _size+=size;
+                terminate();
+            }
+        }
+
+        /**
+         * @brief Erase chars.
+         * @param first Begin of range to erase.
+         * @param last End of range to erase.
+         * @return Iterator following the last erased char.
+         */
+        iterator erase(const_iterator first, const_iterator last) noexcept
+        {
+            auto pos=const_cast<iterator>(first);
+            auto count=static_cast<size_t>(last-first);
+            if (count!=0)
+            {
+                std::memmove(pos,last,static_cast<size_t>(end()-last));
+                _size-=count;
+                terminate();
+            }
+            return pos;
+        }
+
+        /**
+         * @brief Clear content and reset truncation flag.
+         */
+        void clear() noexcept
+        {
+            _size=0;
+            _truncated=false;
+            terminate();
+        }
+
+        iterator begin() noexcept
+        {
+            return _data;
+        }
+        iterator end() noexcept
+        {
+            return _data+_size;
+        }
+        const_iterator begin() const noexcept
+        {
+            return _data;
+        }
+        const_iterator end() const noexcept
+        {
+            return _data+_size;
+        }
+
+        /**
+         * @brief Get pointer to the zero-terminated content.
+         */
+        const char* data() const noexcept
+        {
+            return _data;
+        }
+
+        /**
+         * @brief Get pointer to the zero-terminated content.
+         */
+        const char* c_str() const noexcept
+        {
+            return _data;
+        }
+
+        /**
+         * @brief Get content as string view.
+         */
+        string_view view() const noexcept
+        {
+            return string_view(_data,_size);
+        }
+
+        size_t size() const noexcept
+        {
+            return _size;
+        }
+
+        bool empty() const noexcept
+        {
+            return _size==0;
+        }
+
+        /**
+         * @brief Get max number of chars that can be written to the buffer.
+         */
+        size_t max_size() const noexcept
+        {
+            return _capacity==0 ? 0 : _capacity-1;
+        }
+
+        /**
+         * @brief Check if a report was truncated because it did not fit into the buffer.
+         */
+        bool truncated() const noexcept
+        {
+            return _truncated;
+        }
+
+    private:
+
+        void terminate() noexcept
+        {
+            if (_capacity!=0)
+            {
+                _data[_size]=0;
+            }
+        }
+
+        char* _data;
+        size_t _capacity;
+        size_t _size;
+        bool _truncated;
+};
+
+//-------------------------------------------------------------
+
+HATN_VALIDATOR_NAMESPACE_END
+
+#endif // HATN_VALIDATOR_FIXED_BUFFER_HPP
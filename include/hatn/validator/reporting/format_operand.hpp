@@ -19,15 +19,156 @@ Distributed under the Boost Software License, Version 1.0.
 #ifndef HATN_VALIDATOR_FORMAT_OPERAND_HPP
 #define HATN_VALIDATOR_FORMAT_OPERAND_HPP
 
+#include <string>
+
 #include <hatn/validator/config.hpp>
+#include <hatn/validator/utils/string_view.hpp>
 #include <hatn/validator/reporting/concrete_phrase.hpp>
 #include <hatn/validator/reporting/decorator.hpp>
 #include <hatn/validator/reporting/translate.hpp>
+#include <hatn/validator/reporting/no_translator.hpp>
 
 HATN_VALIDATOR_NAMESPACE_BEGIN
 
 //-------------------------------------------------------------
 
+namespace detail
+{
+
+template <typename TraitsT, typename =void>
+struct has_operand_decorator : std::false_type
+{};
+template <typename TraitsT>
+struct has_operand_decorator<TraitsT,
+            decltype((void)std::declval<const TraitsT&>().decorator(std::declval<std::string>()))
+        > : std::true_type
+{};
+
+template <typename TraitsT, typename =void>
+struct has_no_decorator_member : std::false_type
+{};
+template <typename TraitsT>
+struct has_no_decorator_member<TraitsT,
+            std::enable_if_t<std::is_same<std::decay_t<decltype(std::declval<const TraitsT&>().decorator)>,no_decorator_t>::value>
+        > : std::true_type
+{};
+
+template <typename TraitsT, typename =void>
+struct has_operand_translator : std::false_type
+{};
+template <typename TraitsT>
+struct has_operand_translator<TraitsT,
+            decltype((void)std::declval<const TraitsT&>().translator(std::declval<std::string>(),std::declval<grammar_categories>()))
+        > : std::true_type
+{};
+
+template <typename TraitsT, typename =void>
+struct has_no_translator_member : std::false_type
+{};
+template <typename TraitsT>
+struct has_no_translator_member<TraitsT,
+            std::enable_if_t<std::is_same<std::decay_t<decltype(std::declval<const TraitsT&>().translator)>,no_translator_t>::value>
+        > : std::true_type
+{};
+
+/**
+ * @brief Check if decorator of operand formatter traits returns strings as is.
+ */
+template <typename TraitsT>
+using is_identity_decorator=hana::bool_<
+        !has_operand_decorator<TraitsT>::value
+        ||
+        has_no_decorator_member<TraitsT>::value
+    >;
+
+/**
+ * @brief Check if translator of operand formatter traits returns strings as is.
+ */
+template <typename TraitsT>
+using is_identity_translator=hana::bool_<
+        !has_operand_translator<TraitsT>::value
+        ||
+        has_no_translator_member<TraitsT>::value
+    >;
+
+/**
+ * @brief Check if operand formatter traits neither translate nor decorate strings.
+ *
+ * If true then decorate() and translate() calls can be skipped.
+ */
+template <typename TraitsT>
+using is_identity_postprocessing=hana::bool_<
+        is_identity_decorator<TraitsT>::value
+        &&
+        is_identity_translator<TraitsT>::value
+    >;
+
+/**
+ * @brief Check if operand is a text that can be viewed without copying.
+ */
+template <typename T>
+using is_viewable_operand=hana::bool_<
+        std::is_same<std::decay_t<T>,std::string>::value
+        ||
+        std::is_same<std::decay_t<T>,string_view>::value
+        ||
+        std::is_same<std::decay_t<T>,concrete_phrase>::value
+        ||
+        std::is_same<std::decay_t<T>,const char*>::value
+        ||
+        std::is_same<std::decay_t<T>,char*>::value
+    >;
+
+inline string_view operand_view(const std::string& v) noexcept
+{
+    return string_view(v.data(),v.size());
+}
+
+inline string_view operand_view(const string_view& v) noexcept
+{
+    return v;
+}
+
+inline string_view operand_view(const concrete_phrase& v) noexcept
+{
+    return v.view();
+}
+
+inline string_view operand_view(const char* v) noexcept
+{
+    return string_view(v);
+}
+
+/**
+ * @brief Make phrase of string operand that is neither translated nor decorated.
+ *
+ * Phrase refers to lvalue operands that can be viewed without copying, otherwise the operand is copied.
+ */
+template <typename T, typename =hana::when<true>>
+struct identity_operand_phrase_t
+{
+    template <typename T1>
+    concrete_phrase operator () (T1&& val) const
+    {
+        return std::string(std::forward<T1>(val));
+    }
+};
+template <typename T>
+struct identity_operand_phrase_t<T,
+            hana::when<std::is_lvalue_reference<T>::value && is_viewable_operand<T>::value>
+        >
+{
+    template <typename T1>
+    concrete_phrase operator () (T1&& val) const
+    {
+        return concrete_phrase::ref(operand_view(val));
+    }
+};
+template <typename T>
+constexpr identity_operand_phrase_t<T> identity_operand_phrase{};
+
+}
+
 /**
  * @brief Default helper for operands formatting that returns operand as is.
  */
@@ -65,16 +206,11 @@ struct format_operand_t<T,hana::when<
     template <typename TraitsT, typename T1>
     concrete_phrase operator () (const TraitsT& traits, T1&& val, grammar_categories cats, bool postprocess) const
     {
-        auto phrase=std::string(std::forward<T1>(val));
         if (!postprocess)
         {
-            return phrase;
+            return std::string(std::forward<T1>(val));
         }
-        if (TraitsT::translate_string_operands && !std::is_same<concrete_phrase,std::decay_t<T>>::value)
-        {
-            phrase=translate(traits,std::move(phrase),cats);
-        }
-        return decorate(traits,std::move(phrase));
+        return (*this)(traits,std::forward<T1>(val),cats);
     }
 
     /**
@@ -82,16 +218,33 @@ struct format_operand_t<T,hana::when<
      * @param traits Formatter traits.
      * @param val Operand value.
      * @return Formatted string.
+     *
+     * If traits neither translate nor decorate strings then lvalue strings are not copied and the result refers to the operand.
      */
     template <typename TraitsT, typename T1>
     auto operator () (const TraitsT& traits, T1&& val, grammar_categories cats) const -> decltype(auto)
     {
-        auto phrase=std::string(std::forward<T1>(val));
-        if (TraitsT::translate_string_operands && !std::is_same<concrete_phrase,std::decay_t<T>>::value)
-        {
-            phrase=translate(traits,std::move(phrase),cats);
-        }
-        return decorate(traits,std::move(phrase));
+        constexpr const bool translate_operand=TraitsT::translate_string_operands && !std::is_same<concrete_phrase,std::decay_t<T>>::value;
+        return hana::eval_if(
+            hana::bool_<
+                detail::is_identity_decorator<TraitsT>::value
+                &&
+                (!translate_operand || detail::is_identity_translator<TraitsT>::value)
+            >{},
+            [&](auto&& _)
+            {
+                return detail::identity_operand_phrase<T1>(std::forward<T1>(_(val)));
+            },
+            [&](auto&& _)
+            {
+                auto phrase=std::string(std::forward<T1>(_(val)));
+                if (translate_operand)
+                {
+                    phrase=translate(_(traits),std::move(phrase),cats);
+                }
+                return decorate(_(traits),std::move(phrase));
+            }
+        );
     }
 };
 
@@ -101,6 +254,36 @@ struct format_operand_t<T,hana::when<
 template <typename T>
 constexpr format_operand_t<T> format_operand{};
 
+namespace detail
+{
+
+/**
+ * @brief Append element of compound operand, e.g. element of range or endpoint of interval, to destination object.
+ * @param dst Destination object.
+ * @param traits Formatter traits.
+ * @param val Element to append.
+ *
+ * Element is formatted with format_operand. If traits neither translate nor decorate strings then
+ * string elements are appended to destination object as is without intermediate copies.
+ */
+template <typename ElementT, typename DstT, typename TraitsT, typename T>
+void append_operand_element(DstT& dst, const TraitsT& traits, const T& val)
+{
+    hana::eval_if(
+        hana::bool_<is_identity_postprocessing<TraitsT>::value && is_viewable_operand<T>::value>{},
+        [&](auto&& _)
+        {
+            backend_formatter.append(_(dst),operand_view(_(val)));
+        },
+        [&](auto&& _)
+        {
+            backend_formatter.append(_(dst),format_operand<ElementT>(_(traits),_(val),false));
+        }
+    );
+}
+
+}
+
 //-------------------------------------------------------------
 
 HATN_VALIDATOR_NAMESPACE_END
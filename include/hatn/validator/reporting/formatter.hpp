@@ -46,7 +46,7 @@ struct formatter_tag;
  *
  * Actual string formatting is performed by a backend formatter that wraps destination object which
  * is given as the first argument to formatting methods of this formatter (i.e., DstT& dst). By default
- * either std::stringstream or libfmt backend formatter is used depending on the configuration. Libfmt is
+ * either standard library or libfmt backend formatter is used depending on the configuration. Libfmt is
  * a preferred backend formatter but it requires a fmt library available in include paths and HATN_VALIDATOR_FMT
  * macro defined.
  *
@@ -154,6 +154,62 @@ struct formatter
         format(dst,_strings,item);
     }
 
+    /**
+     * @brief Format group of elements that failed with identical report in summarized ALL aggregation.
+     * @param dst Destination object.
+     * @param group Failure group.
+     * @param max_report_elements Max number of index ranges to list.
+     *
+     * Group is formatted as "report (elements [0..2, 5, ... ])".
+     */
+    template <typename DstT, typename GroupT>
+    void aggregation_summary_group(DstT& dst, const GroupT& group, size_t max_report_elements) const
+    {
+        std::string indexes;
+        auto count=(std::min)(max_report_elements,group.ranges.size());
+        for (size_t i=0;i<count;i++)
+        {
+            const auto& range=group.ranges[i];
+            if (i!=0)
+            {
+                backend_formatter.append(indexes,", ");
+            }
+            if (range.first==range.second)
+            {
+                backend_formatter.append(indexes,range.first);
+            }
+            else
+            {
+                backend_formatter.append(indexes,range.first,"..",range.second);
+            }
+        }
+        if (count<group.ranges.size())
+        {
+            backend_formatter.append(indexes,", ... ");
+        }
+        backend_formatter.append(dst,group.part," (",_strings(string_summary_elements)," [",indexes,"])");
+    }
+
+    /**
+     * @brief Format number of failed elements that were not put to any group in summarized ALL aggregation.
+     * @param dst Destination object containing report of the last group.
+     * @param count Number of omitted failed elements.
+     *
+     * Number is appended to the last group as "; 1 more failed element" or "; 5 more failed elements".
+     */
+    template <typename DstT>
+    void aggregation_summary_omitted(DstT& dst, size_t count) const
+    {
+        if (count==1)
+        {
+            backend_formatter.append(dst,"; ",count," ",_strings(string_summary_omitted_single));
+        }
+        else
+        {
+            backend_formatter.append(dst,"; ",count," ",_strings(string_summary_omitted));
+        }
+    }
+
     template <typename MemberT>
     std::string member_to_string(const MemberT& member) const
     {
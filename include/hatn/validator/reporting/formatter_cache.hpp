@@ -0,0 +1,529 @@
+/**
+@copyright Evgeny Sidorov 2020
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+*/
+
+/****************************************************************************/
+
+/** @file validator/reporting/formatter_cache.hpp
+*
+*  Defines cache of formatters for locales.
+*
+*/
+
+/****************************************************************************/
+
+#ifndef HATN_VALIDATOR_FORMATTER_CACHE_HPP
+#define HATN_VALIDATOR_FORMATTER_CACHE_HPP
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+#include <memory>
+#include <atomic>
+#include <mutex>
+#include <limits>
+#include <locale>
+#include <algorithm>
+#include <functional>
+
+#include <hatn/validator/config.hpp>
+#include <hatn/validator/utils/string_view.hpp>
+#include <hatn/validator/reporting/translator_repository.hpp>
+#include <hatn/validator/reporting/formatter.hpp>
+
+HATN_VALIDATOR_NAMESPACE_BEGIN
+
+//-------------------------------------------------------------
+
+/**
+ * @brief Thread-safe cache of formatters for locales of translator repository.
+ *
+ * Formatters are created with make_formatter() using translators found in the repository for names of locales.
+ * Cached formatters are immutable, so the same formatter can be used by different threads simultaneously.
+ * A formatter also keeps its translator alive, thus it remains valid even if the translator is removed from the repository.
+ *
+ * Cached formatters are kept in immutable snapshots. If a formatter for a locale is not found then the formatter is created
+ * and a new snapshot is published under a mutex. Snapshots are invalidated when the repository is modified,
+ * see translator_repository::revision().
+ *
+ * Formatters are looked up via reader handles, each thread must use its own reader.
+ * As in validator_registry a reader pins a snapshot by announcing current epoch in its own slot,
+ * so that lookup of a cached formatter consists only of atomic loads and stores and a search in the map,
+ * there are no read-modify-write operations and no shared counters, and formatters are returned by references
+ * that are valid while the read guard is alive. Replaced snapshots are retired with the epoch of replacement and destroyed
+ * by writers as soon as no reader has announced an epoch that is not newer than the retirement epoch.
+ *
+ * Formatter for the default locale is kept in the snapshot separately, so that it is found without building
+ * name of the global locale on each lookup. Name of the default locale is given in the constructor,
+ * by default it is the name of the global locale at the moment of construction.
+ *
+ * To limit memory used by the cache only max_locales formatters are cached per revision of the repository,
+ * formatters for other locales are created on each request.
+ *
+ * All readers must be destroyed before the cache.
+ * Note that translator_repository itself must not be modified concurrently with lookups in the cache.
+ *
+ * @code
+ * formatter_cache<> cache(repository);
+ *
+ * // in worker thread
+ * auto reader=cache.make_reader();
+ * auto guard=reader.lock("ru_RU.UTF-8");
+ * auto reporter=make_reporter(dst,guard.formatter());
+ * @endcode
+ */
+template <typename TranslateOperandsT=std::false_type>
+class formatter_cache
+{
+    private:
+
+        constexpr static const size_t cache_line_size=64;
+
+        struct entry_t;
+        struct snapshot_t;
+
+        struct retired_snapshot
+        {
+            const snapshot_t* ptr;
+            uint64_t epoch;
+        };
+
+        /**
+         * Epoch slot of a reader. Slots are padded to cache line to avoid false sharing of readers' announcements.
+         */
+        struct slot
+        {
+            std::atomic<uint64_t> epoch;
+            std::atomic<bool> in_use;
+            slot* next;
+            char padding[cache_line_size];
+
+            slot() : epoch(0),in_use(true),next(nullptr)
+            {}
+        };
+
+    public:
+
+        using formatter_type=std::decay_t<decltype(make_formatter(std::declval<const translator&>(),std::declval<const TranslateOperandsT&>()))>;
+
+        constexpr static const size_t default_max_locales=64;
+
+        class reader;
+
+        /**
+         * @brief Formatter pinned by a reader.
+         *
+         * Formatter can not be destroyed while read_guard is alive.
+         */
+        class read_guard
+        {
+            public:
+
+                read_guard(const read_guard&)=delete;
+                read_guard& operator= (const read_guard&)=delete;
+                read_guard& operator= (read_guard&&)=delete;
+
+                /**
+                 * @brief Move constructor.
+                 * @param other Other guard.
+                 */
+                read_guard(read_guard&& other) noexcept
+                    : _reader(other._reader),
+                      _formatter(other._formatter),
+                      _owned(std::move(other._owned))
+                {
+                    other._reader=nullptr;
+                }
+
+                /**
+                 * @brief Destructor unpins the formatter.
+                 */
+                ~read_guard()
+                {
+                    if (_reader!=nullptr)
+                    {
+                        _reader->unpin();
+                    }
+                }
+
+                /**
+                 * @brief Get formatter.
+                 * @return Formatter that is valid while guard is alive.
+                 */
+                const formatter_type& formatter() const noexcept
+                {
+                    return *_formatter;
+                }
+
+            private:
+
+                read_guard(reader* r, const formatter_type* f, std::shared_ptr<const entry_t> owned=std::shared_ptr<const entry_t>()) noexcept
+                    : _reader(r),_formatter(f),_owned(std::move(owned))
+                {}
+
+                reader* _reader;
+                const formatter_type* _formatter;
+
+                // formatter that is not cached is owned by the guard
+                std::shared_ptr<const entry_t> _owned;
+
+                friend class reader;
+        };
+
+        /**
+         * @brief Handle of thread looking up formatters in the cache.
+         *
+         * Reader must not be shared between threads, but it can be moved to other thread when no guards are alive.
+         * Guards of the same reader can be nested.
+         */
+        class reader
+        {
+            public:
+
+                reader(const reader&)=delete;
+                reader& operator= (const reader&)=delete;
+                reader& operator= (reader&&)=delete;
+
+                /**
+                 * @brief Move constructor.
+                 * @param other Other reader.
+                 */
+                reader(reader&& other) noexcept
+                    : _cache(other._cache),
+                      _slot(other._slot),
+                      _depth(other._depth)
+                {
+                    other._slot=nullptr;
+                }
+
+                /**
+                 * @brief Destructor releases the slot of reader so that it can be used by other readers.
+                 */
+                ~reader()
+                {
+                    if (_slot!=nullptr)
+                    {
+                        _slot->epoch.store(0,std::memory_order_release);
+                        _slot->in_use.store(false,std::memory_order_release);
+                    }
+                }
+
+                /**
+                 * @brief Get formatter for locale.
+                 * @param loc Locale name, examples: "en_US.UTF-8", "en_US", "en".
+                 * @return Guard of the formatter.
+                 */
+                read_guard lock(string_view loc)
+                {
+                    auto current=pin();
+                    if (current!=nullptr && current->revision==_cache->_repository.revision())
+                    {
+                        auto it=current->entries.find(loc);
+                        if (it!=current->entries.end())
+                        {
+                            return read_guard(this,&it->second->formatter);
+                        }
+                    }
+                    unpin();
+                    auto entry=_cache->create(loc,false);
+                    const auto* f=&entry->formatter;
+                    return read_guard(nullptr,f,std::move(entry));
+                }
+
+                /**
+                 * @brief Get formatter for default locale.
+                 * @return Guard of the formatter.
+                 */
+                read_guard lock()
+                {
+                    auto current=pin();
+                    if (current!=nullptr && current->revision==_cache->_repository.revision() && current->default_entry)
+                    {
+                        return read_guard(this,&current->default_entry->formatter);
+                    }
+                    unpin();
+                    auto entry=_cache->create(_cache->_default_locale,true);
+                    const auto* f=&entry->formatter;
+                    return read_guard(nullptr,f,std::move(entry));
+                }
+
+            private:
+
+                reader(const formatter_cache* cache, slot* s) noexcept
+                    : _cache(cache),_slot(s),_depth(0)
+                {}
+
+                const snapshot_t* pin() noexcept
+                {
+                    if (_depth++==0)
+                    {
+                        // announcement must be visible to writers before the snapshot is loaded
+                        auto epoch=_cache->_epoch.load(std::memory_order_acquire);
+                        _slot->epoch.store(epoch,std::memory_order_seq_cst);
+                    }
+                    return _cache->_current.load(std::memory_order_seq_cst);
+                }
+
+                void unpin() noexcept
+                {
+                    if (--_depth==0)
+                    {
+                        _slot->epoch.store(0,std::memory_order_release);
+                    }
+                }
+
+                const formatter_cache* _cache;
+                slot* _slot;
+                size_t _depth;
+
+                friend class formatter_cache;
+                friend class read_guard;
+        };
+
+        /**
+         * @brief Constructor.
+         * @param repository Translator repository, it must outlive the cache.
+         * @param max_locales Max number of locales to cache per revision of the repository.
+         * @param default_locale Name of default locale, by default it is the name of the global locale.
+         */
+        explicit formatter_cache(
+                const translator_repository& repository,
+                size_t max_locales=default_max_locales,
+                std::string default_locale=std::locale().name()
+            ) : _repository(repository),
+                _max_locales(max_locales),
+                _default_locale(std::move(default_locale)),
+                _current(nullptr),
+                _epoch(1),
+                _slots(nullptr)
+        {}
+
+        formatter_cache(const formatter_cache&)=delete;
+        formatter_cache(formatter_cache&&)=delete;
+        formatter_cache& operator= (const formatter_cache&)=delete;
+        formatter_cache& operator= (formatter_cache&&)=delete;
+
+        /**
+         * @brief Destructor.
+         */
+        ~formatter_cache()
+        {
+            delete _current.load(std::memory_order_acquire);
+            for (auto&& it:_retired)
+            {
+                delete it.ptr;
+            }
+            auto s=_slots.load(std::memory_order_acquire);
+            while (s!=nullptr)
+            {
+                auto next=s->next;
+                delete s;
+                s=next;
+            }
+        }
+
+        /**
+         * @brief Make reader of the cache.
+         * @return Reader to be used in a single thread.
+         */
+        reader make_reader() const
+        {
+            auto s=_slots.load(std::memory_order_acquire);
+            for (;s!=nullptr;s=s->next)
+            {
+                bool in_use=false;
+                if (!s->in_use.load(std::memory_order_relaxed)
+                    &&
+                    s->in_use.compare_exchange_strong(in_use,true,std::memory_order_acq_rel)
+                   )
+                {
+                    return reader(this,s);
+                }
+            }
+
+            s=new slot();
+            auto head=_slots.load(std::memory_order_relaxed);
+            do
+            {
+                s->next=head;
+            }
+            while (!_slots.compare_exchange_weak(head,s,std::memory_order_release,std::memory_order_relaxed));
+            return reader(this,s);
+        }
+
+        /**
+         * @brief Get name of default locale.
+         * @return Locale name.
+         */
+        const std::string& default_locale() const noexcept
+        {
+            return _default_locale;
+        }
+
+        /**
+         * @brief Get number of locales cached for current revision of the repository.
+         * @return Number of cached locales.
+         */
+        size_t size() const
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            auto current=_current.load(std::memory_order_relaxed);
+            if (current!=nullptr && current->revision==_repository.revision())
+            {
+                return current->entries.size();
+            }
+            return 0;
+        }
+
+        /**
+         * @brief Get number of retired snapshots still waiting for reclamation.
+         * @return Number of retired snapshots.
+         */
+        size_t retired_count() const
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            return _retired.size();
+        }
+
+    private:
+
+        struct entry_t
+        {
+            entry_t(
+                    std::shared_ptr<translator> tr
+                ) : tr(std::move(tr)),
+                    translate_operands(),
+                    formatter(make_formatter(static_cast<const translator&>(*this->tr),static_cast<const TranslateOperandsT&>(translate_operands)))
+            {}
+
+            std::shared_ptr<translator> tr;
+            TranslateOperandsT translate_operands;
+            formatter_type formatter;
+        };
+
+        struct snapshot_t
+        {
+            size_t revision=0;
+            std::map<std::string,std::shared_ptr<const entry_t>,std::less<>> entries;
+            std::shared_ptr<const entry_t> default_entry;
+        };
+
+        std::shared_ptr<const entry_t> create(string_view loc, bool is_default) const
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+
+            auto revision=_repository.revision();
+            auto current=_current.load(std::memory_order_relaxed);
+            auto valid=current!=nullptr && current->revision==revision;
+            if (valid && is_default && current->default_entry)
+            {
+                return current->default_entry;
+            }
+
+            std::shared_ptr<const entry_t> entry;
+            if (valid)
+            {
+                auto it=current->entries.find(loc);
+                if (it!=current->entries.end())
+                {
+                    if (!is_default)
+                    {
+                        return it->second;
+                    }
+                    entry=it->second;
+                }
+            }
+            if (!entry)
+            {
+                entry=std::make_shared<const entry_t>(_repository.find_translator(loc));
+            }
+            auto add=!valid || (current->entries.size()<_max_locales && current->entries.find(loc)==current->entries.end());
+            if (!add && !is_default)
+            {
+                return entry;
+            }
+
+            std::unique_ptr<snapshot_t> next(new snapshot_t());
+            next->revision=revision;
+            if (valid)
+            {
+                next->entries=current->entries;
+                next->default_entry=current->default_entry;
+            }
+            if (add)
+            {
+                next->entries.emplace(std::string(loc.data(),loc.size()),entry);
+            }
+            if (is_default)
+            {
+                next->default_entry=entry;
+            }
+            publish(std::move(next));
+            return entry;
+        }
+
+        void publish(std::unique_ptr<const snapshot_t> next) const
+        {
+            _retired.reserve(_retired.size()+1);
+            auto old=_current.exchange(next.release(),std::memory_order_seq_cst);
+            auto epoch=_epoch.fetch_add(1,std::memory_order_seq_cst);
+            if (old!=nullptr)
+            {
+                _retired.push_back(retired_snapshot{old,epoch});
+            }
+            reclaim();
+        }
+
+        void reclaim() const
+        {
+            if (_retired.empty())
+            {
+                return;
+            }
+
+            auto min_epoch=(std::numeric_limits<uint64_t>::max)();
+            for (auto s=_slots.load(std::memory_order_acquire);s!=nullptr;s=s->next)
+            {
+                auto epoch=s->epoch.load(std::memory_order_seq_cst);
+                if (epoch!=0)
+                {
+                    min_epoch=(std::min)(min_epoch,epoch);
+                }
+            }
+
+            auto it=std::remove_if(_retired.begin(),_retired.end(),
+                [min_epoch](const retired_snapshot& retired)
+                {
+                    if (retired.epoch<min_epoch)
+                    {
+                        delete retired.ptr;
+                        return true;
+                    }
+                    return false;
+                }
+            );
+            _retired.erase(it,_retired.end());
+        }
+
+        const translator_repository& _repository;
+        size_t _max_locales;
+        std::string _default_locale;
+
+        mutable std::atomic<const snapshot_t*> _current;
+        mutable std::atomic<uint64_t> _epoch;
+        mutable std::atomic<slot*> _slots;
+
+        mutable std::mutex _mutex;
+        mutable std::vector<retired_snapshot> _retired;
+};
+
+//-------------------------------------------------------------
+
+HATN_VALIDATOR_NAMESPACE_END
+
+#endif // HATN_VALIDATOR_FORMATTER_CACHE_HPP
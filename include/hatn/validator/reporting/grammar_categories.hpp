@@ -94,6 +94,27 @@ grammar_categories grammar_categories_bitmask(Args&&... args)
     return feature_bitmask_t<grammar>::bits(std::forward<Args>(args)...);
 }
 
+/**
+ * @brief Construct empty bitmask of grammar categories at compile time.
+ * @return Empty bitmask.
+ */
+constexpr inline grammar_categories grammar_categories_bits() noexcept
+{
+    return 0;
+}
+
+/**
+ * @brief Construct bitmask of grammar categories from a pack of arguments at compile time.
+ * @param cat First grammar category.
+ * @param args The rest grammar categories.
+ * @return Bitmask of grammar categories.
+ */
+template <typename T, typename ...Args>
+constexpr grammar_categories grammar_categories_bits(T cat, Args... args) noexcept
+{
+    return feature_bitmask_t<grammar>::bit(cat) | grammar_categories_bits(args...);
+}
+
 /**
  * @brief Check if grammar category is set in bitmask.
  * @param cats Bitmask of grammer categories.
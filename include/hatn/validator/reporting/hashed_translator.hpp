@@ -0,0 +1,236 @@
+/**
+@copyright Evgeny Sidorov 2020
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+*/
+
+/****************************************************************************/
+
+/** @file validator/reporting/hashed_translator.hpp
+*
+*   Defines translator backed by flat hash table.
+*
+*/
+
+/****************************************************************************/
+
+#ifndef HATN_VALIDATOR_HASHED_TRANSLATOR_HPP
+#define HATN_VALIDATOR_HASHED_TRANSLATOR_HPP
+
+#include <cstdint>
+#include <map>
+#include <vector>
+#include <string>
+
+#include <hatn/validator/config.hpp>
+#include <hatn/validator/utils/string_view.hpp>
+#include <hatn/validator/utils/string_hash.hpp>
+#include <hatn/validator/reporting/translator.hpp>
+
+HATN_VALIDATOR_NAMESPACE_BEGIN
+
+//-------------------------------------------------------------
+
+/**
+ * @brief Translator that keeps translated strings in open-addressing hash table.
+ *
+ * Lookups do not construct std::string from the ID and do not copy the translation:
+ * resulting phrase refers to the text stored in the translator, see concrete_phrase::ref().
+ * Thus, phrases returned by the translator are valid until the translator is modified or destroyed.
+ *
+ * Translator can be constructed with prepared map as
+ * @code
+ * hashed_translator{map};
+ * @endcode
+ * or filled with hashed_translator::add().
+ */
+class hashed_translator : public translator
+{
+    public:
+
+        hashed_translator()=default;
+
+        /**
+         * @brief Constructor.
+         * @param strings Translated strings.
+         */
+        hashed_translator(const std::map<std::string,std::string>& strings)
+        {
+            reserve(strings.size());
+            for (auto&& it:strings)
+            {
+                add(it.first,it.second);
+            }
+        }
+
+        /**
+         * @brief Add translation of a string.
+         * @param id String ID.
+         * @param text Translated string.
+         * @param grammar_cats Grammatical categories of translated phrase.
+         *
+         * If translation of the ID already exists then it is replaced.
+         */
+        void add(string_view id, std::string text, grammar_categories grammar_cats=0)
+        {
+            if ((_size+1)*2>_slots.size())
+            {
+                rehash(_slots.empty()?min_capacity:_slots.size()*2);
+            }
+
+            auto hash=string_hash(id);
+            auto& slot=find_slot(id,hash);
+            if (!slot.used)
+            {
+                slot.used=true;
+                slot.hash=hash;
+                slot.id.assign(id.data(),id.size());
+                ++_size;
+            }
+            slot.text=std::move(text);
+            slot.grammar_cats=grammar_cats;
+        }
+
+        /**
+         * @brief Add translation of a string.
+         * @param id String ID.
+         * @param phrase Translated phrase.
+         */
+        void add(string_view id, const concrete_phrase& phrase)
+        {
+            add(id,phrase.text(),phrase.grammar_cats());
+        }
+
+        /**
+         * @brief Reserve space for translations.
+         * @param count Expected number of translations.
+         */
+        void reserve(size_t count)
+        {
+            size_t capacity=min_capacity;
+            while (capacity<count*2)
+            {
+                capacity*=2;
+            }
+            if (capacity>_slots.size())
+            {
+                rehash(capacity);
+            }
+        }
+
+        /**
+         * @brief Reset translator.
+         */
+        virtual void reset() override
+        {
+            _slots.clear();
+            _size=0;
+        }
+
+        /**
+         * @brief Translate a string.
+         * @param id String id.
+         * @return Translated string or id if such string not found.
+         */
+        virtual translation_result translate(const std::string& id, grammar_categories cats=0) const override
+        {
+            return find(string_view(id.data(),id.size()),cats);
+        }
+
+        /**
+         * @brief Translate a string given as string view.
+         * @param id String id.
+         * @return Phrase referring to translated string or copy of id if such string not found.
+         */
+        virtual translation_result find(string_view id, grammar_categories =0) const override
+        {
+            if (_size!=0)
+            {
+                const auto& slot=find_slot(id,string_hash(id));
+                if (slot.used)
+                {
+                    return translation_result{concrete_phrase::ref(slot.text,slot.grammar_cats),true};
+                }
+            }
+            return translation_result{std::string(id.data(),id.size()),false};
+        }
+
+        /**
+         * @brief Get number of translated strings.
+         * @return Number of strings.
+         */
+        size_t size() const noexcept
+        {
+            return _size;
+        }
+
+        /**
+         * @brief Check if translator is empty.
+         * @return Boolean flag.
+         */
+        bool empty() const noexcept
+        {
+            return _size==0;
+        }
+
+    private:
+
+        constexpr static const size_t min_capacity=16;
+
+        struct slot_t
+        {
+            std::string id;
+            std::string text;
+            grammar_categories grammar_cats=0;
+            uint64_t hash=0;
+            bool used=false;
+        };
+
+        const slot_t& find_slot(string_view id, uint64_t hash) const
+        {
+            auto mask=_slots.size()-1;
+            auto i=static_cast<size_t>(hash)&mask;
+            for (;;)
+            {
+                const auto& slot=_slots[i];
+                if (!slot.used
+                    ||
+                    (slot.hash==hash && string_view(slot.id.data(),slot.id.size())==id)
+                   )
+                {
+                    return slot;
+                }
+                i=(i+1)&mask;
+            }
+        }
+
+        slot_t& find_slot(string_view id, uint64_t hash)
+        {
+            return const_cast<slot_t&>(static_cast<const hashed_translator*>(this)->find_slot(id,hash));
+        }
+
+        void rehash(size_t capacity)
+        {
+            std::vector<slot_t> slots(capacity);
+            std::swap(slots,_slots);
+            for (auto&& it:slots)
+            {
+                if (it.used)
+                {
+                    auto& slot=find_slot(it.id,it.hash);
+                    slot=std::move(it);
+                }
+            }
+        }
+
+        std::vector<slot_t> _slots;
+        size_t _size=0;
+};
+
+//-------------------------------------------------------------
+
+HATN_VALIDATOR_NAMESPACE_END
+
+#endif // HATN_VALIDATOR_HASHED_TRANSLATOR_HPP
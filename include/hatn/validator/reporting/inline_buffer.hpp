@@ -0,0 +1,282 @@
+/**
+@copyright Evgeny Sidorov 2020
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+*/
+
+/****************************************************************************/
+
+/** @file validator/reporting/inline_buffer.hpp
+*
+*  Defines report destination with inline storage.
+*
+*/
+
+/****************************************************************************/
+
+#ifndef HATN_VALIDATOR_INLINE_BUFFER_HPP
+#define HATN_VALIDATOR_INLINE_BUFFER_HPP
+
+#include <string>
+#include <cstring>
+#include <memory>
+#include <algorithm>
+
+#include <hatn/validator/config.hpp>
+#include <hatn/validator/utils/string_view.hpp>
+
+HATN_VALIDATOR_NAMESPACE_BEGIN
+
+//-------------------------------------------------------------
+
+/**
+ * @brief Report destination that keeps chars in inline storage and falls back to heap only when the storage is exhausted.
+ *
+ * The buffer is similar to fmt::basic_memory_buffer: reports that fit into InlineSize chars do not allocate memory.
+ * Only reports of nested aggregations are prepared in intermediate strings, see part_type.
+ *
+ * @code
+ * inline_buffer<> dst;
+ * auto ra=make_reporting_adapter(obj,dst);
+ * @endcode
+ */
+template <size_t InlineSize=256>
+class inline_buffer
+{
+    public:
+
+        using value_type=char;
+        using size_type=size_t;
+        using iterator=char*;
+        using const_iterator=const char*;
+        using reference=char&;
+        using const_reference=const char&;
+
+        /**
+         * @brief Type of intermediate parts of reports.
+         */
+        using part_type=std::string;
+
+        /**
+         * @brief Default constructor.
+         */
+        inline_buffer() noexcept
+            : _data(_inline),
+              _capacity(InlineSize),
+              _size(0)
+        {}
+
+        ~inline_buffer()=default;
+
+        /**
+         * @brief Copy constructor.
+         * @param other Other buffer.
+         */
+        inline_buffer(const inline_buffer& other) : inline_buffer()
+        {
+            append(other.data(),other.size());
+        }
+
+        /**
+         * @brief Move constructor.
+         * @param other Other buffer.
+         */
+        inline_buffer(inline_buffer&& other) noexcept : inline_buffer()
+        {
+            move_from(other);
+        }
+
+        /**
+         * @brief Copy assignment operator.
+         * @param other Other buffer.
+         * @return Reference to this buffer.
+         */
+        inline_buffer& operator= (const inline_buffer& other)
+        {
+            if (this!=&other)
+            {
+                clear();
+                append(other.data(),other.size());
+            }
+            return *this;
+        }
+
+        /**
+         * @brief Move assignment operator.
+         * @param other Other buffer.
+         * @return Reference to this buffer.
+         */
+        inline_buffer& operator= (inline_buffer&& other) noexcept
+        {
+            if (this!=&other)
+            {
+                _heap.reset();
+                _data=_inline;
+                _capacity=InlineSize;
+                _size=0;
+                move_from(other);
+            }
+            return *this;
+        }
+
+        /**
+         * @brief Append char.
+         * @param ch Char to append.
+         */
+        void push_back(char ch)
+        {
+            reserve(_size+1);
+            _data[_size++]=ch;
+        }
+
+        /**
+         * @brief Append chars.
+         * @param str Chars to append.
+         * @param size Number of chars.
+         */
+        void append(const char* str, size_t size)
+        {
+            if (size!=0)
+            {
+                reserve(_size+size);
+                std::memcpy(_data+_size,str,size);
+                _size+=size;
+            }
+        }
+
+        /**
+         * @brief Erase chars.
+         * @param first Begin of range to erase.
+         * @param last End of range to erase.
+         * @return Iterator following the last erased char.
+         */
+        iterator erase(const_iterator first, const_iterator last) noexcept
+        {
+            auto pos=const_cast<iterator>(first);
+            auto count=static_cast<size_t>(last-first);
+            if (count!=0)
+            {
+                std::memmove(pos,last,static_cast<size_t>(end()-last));
+                _size-=count;
+            }
+            return pos;
+        }
+
+        /**
+         * @brief Reserve space for chars.
+         * @param capacity Required capacity.
+         *
+         * Capacity grows at least twice, so appending to the buffer has amortized constant complexity.
+         */
+        void reserve(size_t capacity)
+        {
+            if (capacity<=_capacity)
+            {
+                return;
+            }
+            auto new_capacity=(std::max)(capacity,_capacity*2);
+            std::unique_ptr<char[]> heap(new char[new_capacity]);
+            if (_size!=0)
+            {
+                std::memcpy(heap.get(),_data,_size);
+            }
+            _heap=std::move(heap);
+            _data=_heap.get();
+            _capacity=new_capacity;
+        }
+
+        /**
+         * @brief Clear content, allocated memory is kept.
+         */
+        void clear() noexcept
+        {
+            _size=0;
+        }
+
+        iterator begin() noexcept
+        {
+            return _data;
+        }
+        iterator end() noexcept
+        {
+            return _data+_size;
+        }
+        const_iterator begin() const noexcept
+        {
+            return _data;
+        }
+        const_iterator end() const noexcept
+        {
+            return _data+_size;
+        }
+
+        const char* data() const noexcept
+        {
+            return _data;
+        }
+
+        /**
+         * @brief Get content as string view.
+         */
+        string_view view() const noexcept
+        {
+            return string_view(_data,_size);
+        }
+
+        size_t size() const noexcept
+        {
+            return _size;
+        }
+
+        bool empty() const noexcept
+        {
+            return _size==0;
+        }
+
+        size_t capacity() const noexcept
+        {
+            return _capacity;
+        }
+
+        /**
+         * @brief Check if content is kept in inline storage.
+         */
+        bool is_inline() const noexcept
+        {
+            return _data==_inline;
+        }
+
+    private:
+
+        void move_from(inline_buffer& other) noexcept
+        {
+            if (other.is_inline())
+            {
+                std::memcpy(_inline,other._inline,other._size);
+            }
+            else
+            {
+                _heap=std::move(other._heap);
+                _data=_heap.get();
+                _capacity=other._capacity;
+                other._data=other._inline;
+                other._capacity=InlineSize;
+            }
+            _size=other._size;
+            other._size=0;
+        }
+
+        char _inline[InlineSize];
+        std::unique_ptr<char[]> _heap;
+        char* _data;
+        size_t _capacity;
+        size_t _size;
+};
+
+//-------------------------------------------------------------
+
+HATN_VALIDATOR_NAMESPACE_END
+
+#endif // HATN_VALIDATOR_INLINE_BUFFER_HPP
@@ -19,8 +19,6 @@ Distributed under the Boost Software License, Version 1.0.
 #ifndef HATN_VALIDATOR_RU_LOCALE_HPP
 #define HATN_VALIDATOR_RU_LOCALE_HPP
 
-#include <mutex>
-
 #include <hatn/validator/config.hpp>
 #include <hatn/validator/master_sample.hpp>
 #include <hatn/validator/properties.hpp>
@@ -37,6 +35,7 @@ Distributed under the Boost Software License, Version 1.0.
 #include <hatn/validator/reporting/aggregation_strings.hpp>
 #include <hatn/validator/reporting/flag_presets.hpp>
 #include <hatn/validator/reporting/phrase_translator.hpp>
+#include <hatn/validator/reporting/static_translator.hpp>
 
 HATN_VALIDATOR_NAMESPACE_BEGIN
 
@@ -64,387 +63,276 @@ enum grammar_ru : uint8_t
 };
 
 /**
- * @brief Construct translator of validator strings for Russian locale.
+ * @brief Get translator of validator strings for Russian locale.
  * @return Translator of system phrases for Russian locale.
  *
+ * Phrases are kept in compile-time table, see validator_static_translator_sample() for the format of the table.
  */
-inline const phrase_translator& validator_translator_ru()
+inline const static_translator& validator_static_translator_ru()
 {
-    static std::mutex mutex;
-    std::lock_guard<std::mutex> lock(mutex);
-
-    static phrase_translator m;
-    if (m.empty())
-    {
+    constexpr static static_phrase phrases[]={
         // logical
-        m[string_and.conjunction_str()]=" И "; // " AND "
-        m[string_or.conjunction_str()]=" ИЛИ "; // " OR "
-        m[string_not.open_str()]="НЕТ "; // "NOT "
-        m[string_invert_op]="НЕТ"; // "NOT"
+        {string_and.conjunction_str()," И "}, // " AND "
+        {string_or.conjunction_str()," ИЛИ "}, // " OR "
+        {string_not.open_str(),"НЕТ "}, // "NOT "
+        {string_invert_op,"НЕТ"}, // "NOT"
 
         // specials
 
-        m[string_conjunction_of]={{{"",grammar_ru::roditelny_padezh}}}; // "of"
-        m[string_member_name_conjunction]={{{" ",grammar_ru::roditelny_padezh}}}; // " of "
-
-        m[string_true]="истина"; // "true"
-        m[string_false]="ложь"; // "false"
-
-        m[string_master_sample]={
-                                    {"образец"},
-                                    {"образца",grammar_ru::roditelny_padezh}
-                                }; // "sample"
-        m[string_empty]={
-                            {"должен быть пустым"},
-                            {"должна быть пустой",grammar_ru::zhensky_rod},
-                            {"должно быть пустым",grammar_ru::sredny_rod},
-                            {"должны быть пустыми",grammar_ru::mn_chislo}
-                        }; // "must be empty"
-        m[string_not_empty]={
-                                {"должен быть не пустым"},
-                                {"должна быть не пустой",grammar_ru::zhensky_rod},
-                                {"должно быть не пустым",grammar_ru::sredny_rod},
-                                {"должны быть не пустыми",grammar_ru::mn_chislo}
-                            }; // "must be not empty"
-
-        m[string_element]={
-                            {"элемент #"},
-                            {"элемента #",grammar_ru::roditelny_padezh}
-                          }; // "element #"
-        m[string_any]={
-                            {"хотя бы один элемент"},
-                            {"хотя бы одного элемента",grammar_ru::roditelny_padezh}
-                      }; // "at least one element"
-        m[string_all]={
-                            {"каждый элемент"},
-                            {"каждого элемента",grammar_ru::roditelny_padezh}
-                      }; // "each element"
-
-        m[string_all.base_phrase_str()]={
-                            {"каждый"},
-                            {"каждого",grammar_ru::roditelny_padezh},
-                            {"каждая",grammar_ru::zhensky_rod},
-                            {"каждой",grammar_ru::zhensky_rod,grammar_ru::roditelny_padezh},
-                            {"каждое",grammar_ru::sredny_rod},
-                            {"каждого",grammar_ru::sredny_rod,grammar_ru::roditelny_padezh},
-                            {"каждые",grammar_ru::mn_chislo},
-                            {"каждых",grammar_ru::mn_chislo,grammar_ru::roditelny_padezh}
-                      }; // "each"
-        m[string_all.iterator_description_str()]={
-                            {"каждый итератор"},
-                            {"каждого итератора",grammar_ru::roditelny_padezh}
-                      }; // "each iterator"
-        m[string_all.key_description_str()]={
-                            {"каждый ключ"},
-                            {"каждого ключа",grammar_ru::roditelny_padezh}
-                      }; // "each iterator"
-        m[string_all.tree_description_str()]={
-                            {"каждый узел дерева"},
-                            {"каждого узла дерева",grammar_ru::roditelny_padezh}
-                      }; // "each tree node"
-        m[string_all.name_str()]={
-                            {"ВСЕ"}
-                      }; // "ALL"
-
-        m[string_any.base_phrase_str()]={
-                            {"хотя бы один"},
-                            {"хотя бы одного",grammar_ru::roditelny_padezh},
-                            {"хотя бы одна",grammar_ru::zhensky_rod},
-                            {"хотя бы одной",grammar_ru::zhensky_rod,grammar_ru::roditelny_padezh},
-                            {"хотя бы одно",grammar_ru::sredny_rod},
-                            {"хотя бы одного",grammar_ru::sredny_rod,grammar_ru::roditelny_padezh},
-                            {"хотя бы одни",grammar_ru::mn_chislo},
-                            {"хотя бы одних",grammar_ru::mn_chislo,grammar_ru::roditelny_padezh}
-                      }; // "at least one"
-        m[string_any.iterator_description_str()]={
-                            {"хотя бы один итератор"},
-                            {"хотя бы одного итератора",grammar_ru::roditelny_padezh}
-                      }; // "at least one iterator"
-        m[string_any.key_description_str()]={
-                            {"хотя бы один ключ"},
-                            {"хотя бы одного ключа",grammar_ru::roditelny_padezh}
-                      }; // "at least one key"
-        m[string_any.tree_description_str()]={
-                            {"хотя бы один узел дерева"},
-                            {"хотя бы одного узла дерева",grammar_ru::roditelny_padezh}
-                      }; // "at least one tree node"
-        m[string_any.name_str()]={
-                            {"ЛЮБОЙ"}
-                      }; // "ANY"
+        {string_conjunction_of,"",grammar_categories_bits(grammar_ru::roditelny_padezh)}, // "of"
+        {string_member_name_conjunction," ",grammar_categories_bits(grammar_ru::roditelny_padezh)}, // " of "
+
+        {string_true,"истина"}, // "true"
+        {string_false,"ложь"}, // "false"
+
+        {string_master_sample,"образец"}, // "sample"
+        {string_master_sample,"образца",0,grammar_categories_bits(grammar_ru::roditelny_padezh)},
+        {string_empty,"должен быть пустым"}, // "must be empty"
+        {string_empty,"должна быть пустой",0,grammar_categories_bits(grammar_ru::zhensky_rod)},
+        {string_empty,"должно быть пустым",0,grammar_categories_bits(grammar_ru::sredny_rod)},
+        {string_empty,"должны быть пустыми",0,grammar_categories_bits(grammar_ru::mn_chislo)},
+        {string_not_empty,"должен быть не пустым"}, // "must be not empty"
+        {string_not_empty,"должна быть не пустой",0,grammar_categories_bits(grammar_ru::zhensky_rod)},
+        {string_not_empty,"должно быть не пустым",0,grammar_categories_bits(grammar_ru::sredny_rod)},
+        {string_not_empty,"должны быть не пустыми",0,grammar_categories_bits(grammar_ru::mn_chislo)},
+
+        {string_element,"элемент #"}, // "element #"
+        {string_element,"элемента #",0,grammar_categories_bits(grammar_ru::roditelny_padezh)},
+        {string_any,"хотя бы один элемент"}, // "at least one element"
+        {string_any,"хотя бы одного элемента",0,grammar_categories_bits(grammar_ru::roditelny_padezh)},
+        {string_all,"каждый элемент"}, // "each element"
+        {string_all,"каждого элемента",0,grammar_categories_bits(grammar_ru::roditelny_padezh)},
+
+        {string_all.base_phrase_str(),"каждый"}, // "each"
+        {string_all.base_phrase_str(),"каждого",0,grammar_categories_bits(grammar_ru::roditelny_padezh)},
+        {string_all.base_phrase_str(),"каждая",0,grammar_categories_bits(grammar_ru::zhensky_rod)},
+        {string_all.base_phrase_str(),"каждой",0,grammar_categories_bits(grammar_ru::zhensky_rod,grammar_ru::roditelny_padezh)},
+        {string_all.base_phrase_str(),"каждое",0,grammar_categories_bits(grammar_ru::sredny_rod)},
+        {string_all.base_phrase_str(),"каждого",0,grammar_categories_bits(grammar_ru::sredny_rod,grammar_ru::roditelny_padezh)},
+        {string_all.base_phrase_str(),"каждые",0,grammar_categories_bits(grammar_ru::mn_chislo)},
+        {string_all.base_phrase_str(),"каждых",0,grammar_categories_bits(grammar_ru::mn_chislo,grammar_ru::roditelny_padezh)},
+        {string_all.iterator_description_str(),"каждый итератор"}, // "each iterator"
+        {string_all.iterator_description_str(),"каждого итератора",0,grammar_categories_bits(grammar_ru::roditelny_padezh)},
+        {string_all.key_description_str(),"каждый ключ"}, // "each iterator"
+        {string_all.key_description_str(),"каждого ключа",0,grammar_categories_bits(grammar_ru::roditelny_padezh)},
+        {string_all.tree_description_str(),"каждый узел дерева"}, // "each tree node"
+        {string_all.tree_description_str(),"каждого узла дерева",0,grammar_categories_bits(grammar_ru::roditelny_padezh)},
+        {string_all.name_str(),"ВСЕ"}, // "ALL"
+
+        {string_any.base_phrase_str(),"хотя бы один"}, // "at least one"
+        {string_any.base_phrase_str(),"хотя бы одного",0,grammar_categories_bits(grammar_ru::roditelny_padezh)},
+        {string_any.base_phrase_str(),"хотя бы одна",0,grammar_categories_bits(grammar_ru::zhensky_rod)},
+        {string_any.base_phrase_str(),"хотя бы одной",0,grammar_categories_bits(grammar_ru::zhensky_rod,grammar_ru::roditelny_padezh)},
+        {string_any.base_phrase_str(),"хотя бы одно",0,grammar_categories_bits(grammar_ru::sredny_rod)},
+        {string_any.base_phrase_str(),"хотя бы одного",0,grammar_categories_bits(grammar_ru::sredny_rod,grammar_ru::roditelny_padezh)},
+        {string_any.base_phrase_str(),"хотя бы одни",0,grammar_categories_bits(grammar_ru::mn_chislo)},
+        {string_any.base_phrase_str(),"хотя бы одних",0,grammar_categories_bits(grammar_ru::mn_chislo,grammar_ru::roditelny_padezh)},
+        {string_any.iterator_description_str(),"хотя бы один итератор"}, // "at least one iterator"
+        {string_any.iterator_description_str(),"хотя бы одного итератора",0,grammar_categories_bits(grammar_ru::roditelny_padezh)},
+        {string_any.key_description_str(),"хотя бы один ключ"}, // "at least one key"
+        {string_any.key_description_str(),"хотя бы одного ключа",0,grammar_categories_bits(grammar_ru::roditelny_padezh)},
+        {string_any.tree_description_str(),"хотя бы один узел дерева"}, // "at least one tree node"
+        {string_any.tree_description_str(),"хотя бы одного узла дерева",0,grammar_categories_bits(grammar_ru::roditelny_padezh)},
+        {string_any.name_str(),"ЛЮБОЙ"}, // "ANY"
 
         // flag descriptions
-        m[flag_true_false.str()]={
-                                    {"должен быть истинным"},
-                                    {"должна быть истинна",grammar_ru::zhensky_rod},
-                                    {"должно быть истинно",grammar_ru::sredny_rod},
-                                    {"должны быть истинны",grammar_ru::mn_chislo}
-                                }; // "must be true"
-        m[flag_true_false.n_str()]={
-                                    {"должен быть ложным"},
-                                    {"должна быть ложна",grammar_ru::zhensky_rod},
-                                    {"должно быть ложно",grammar_ru::sredny_rod},
-                                    {"должны быть ложны",grammar_ru::mn_chislo}
-                                }; // "must be false"
-        m[flag_on_off.str()]={
-                                    {"должен быть включен"},
-                                    {"должна быть включена",grammar_ru::zhensky_rod},
-                                    {"должно быть включено",grammar_ru::sredny_rod},
-                                    {"должны быть включены",grammar_ru::mn_chislo}
-                             }; // "must be on"
-        m[flag_on_off.n_str()]={
-                                    {"должен быть выключен"},
-                                    {"должна быть выключена",grammar_ru::zhensky_rod},
-                                    {"должно быть выключено",grammar_ru::sredny_rod},
-                                    {"должны быть выключены",grammar_ru::mn_chislo}
-                               }; // "must be off"
-        m[flag_checked_unchecked.str()]={
-                                    {"должен быть отмечен"},
-                                    {"должна быть отмечена",grammar_ru::zhensky_rod},
-                                    {"должно быть отмечено",grammar_ru::sredny_rod},
-                                    {"должны быть отмечены",grammar_ru::mn_chislo}
-                               }; // "must be checked"
-        m[flag_checked_unchecked.n_str()]={
-                                    {"должен быть снят"},
-                                    {"должна быть снята",grammar_ru::zhensky_rod},
-                                    {"должно быть снято",grammar_ru::sredny_rod},
-                                    {"должны быть сняты",grammar_ru::mn_chislo}
-                               }; // "must be unchecked"
-        m[flag_set_unset.str()]={
-                                    {"должен быть установлен"},
-                                    {"должна быть установлена",grammar_ru::zhensky_rod},
-                                    {"должно быть установлено",grammar_ru::sredny_rod},
-                                    {"должны быть установлены",grammar_ru::mn_chislo}
-                               }; // "must be set"
-        m[flag_set_unset.n_str()]={
-                                    {"должен быть не установлен"},
-                                    {"должна быть не установлена",grammar_ru::zhensky_rod},
-                                    {"должно быть не установлено",grammar_ru::sredny_rod},
-                                    {"должны быть не установлены",grammar_ru::mn_chislo}
-                               }; // "must be unset"
-        m[flag_enable_disable.str()]={
-                                        {"должен быть активен"},
-                                        {"должна быть активна",grammar_ru::zhensky_rod},
-                                        {"должно быть активно",grammar_ru::sredny_rod},
-                                        {"должны быть активны",grammar_ru::mn_chislo}
-                                    }; // "must be enabled"
-        m[flag_enable_disable.n_str()]={
-                                        {"должен быть неактивен"},
-                                        {"должна быть неактивна",grammar_ru::zhensky_rod},
-                                        {"должно быть неактивно",grammar_ru::sredny_rod},
-                                        {"должны быть неактивны",grammar_ru::mn_chislo}
-                                    }; // "must be disabled"
+        {flag_true_false.str(),"должен быть истинным"}, // "must be true"
+        {flag_true_false.str(),"должна быть истинна",0,grammar_categories_bits(grammar_ru::zhensky_rod)},
+        {flag_true_false.str(),"должно быть истинно",0,grammar_categories_bits(grammar_ru::sredny_rod)},
+        {flag_true_false.str(),"должны быть истинны",0,grammar_categories_bits(grammar_ru::mn_chislo)},
+        {flag_true_false.n_str(),"должен быть ложным"}, // "must be false"
+        {flag_true_false.n_str(),"должна быть ложна",0,grammar_categories_bits(grammar_ru::zhensky_rod)},
+        {flag_true_false.n_str(),"должно быть ложно",0,grammar_categories_bits(grammar_ru::sredny_rod)},
+        {flag_true_false.n_str(),"должны быть ложны",0,grammar_categories_bits(grammar_ru::mn_chislo)},
+        {flag_on_off.str(),"должен быть включен"}, // "must be on"
+        {flag_on_off.str(),"должна быть включена",0,grammar_categories_bits(grammar_ru::zhensky_rod)},
+        {flag_on_off.str(),"должно быть включено",0,grammar_categories_bits(grammar_ru::sredny_rod)},
+        {flag_on_off.str(),"должны быть включены",0,grammar_categories_bits(grammar_ru::mn_chislo)},
+        {flag_on_off.n_str(),"должен быть выключен"}, // "must be off"
+        {flag_on_off.n_str(),"должна быть выключена",0,grammar_categories_bits(grammar_ru::zhensky_rod)},
+        {flag_on_off.n_str(),"должно быть выключено",0,grammar_categories_bits(grammar_ru::sredny_rod)},
+        {flag_on_off.n_str(),"должны быть выключены",0,grammar_categories_bits(grammar_ru::mn_chislo)},
+        {flag_checked_unchecked.str(),"должен быть отмечен"}, // "must be checked"
+        {flag_checked_unchecked.str(),"должна быть отмечена",0,grammar_categories_bits(grammar_ru::zhensky_rod)},
+        {flag_checked_unchecked.str(),"должно быть отмечено",0,grammar_categories_bits(grammar_ru::sredny_rod)},
+        {flag_checked_unchecked.str(),"должны быть отмечены",0,grammar_categories_bits(grammar_ru::mn_chislo)},
+        {flag_checked_unchecked.n_str(),"должен быть снят"}, // "must be unchecked"
+        {flag_checked_unchecked.n_str(),"должна быть снята",0,grammar_categories_bits(grammar_ru::zhensky_rod)},
+        {flag_checked_unchecked.n_str(),"должно быть снято",0,grammar_categories_bits(grammar_ru::sredny_rod)},
+        {flag_checked_unchecked.n_str(),"должны быть сняты",0,grammar_categories_bits(grammar_ru::mn_chislo)},
+        {flag_set_unset.str(),"должен быть установлен"}, // "must be set"
+        {flag_set_unset.str(),"должна быть установлена",0,grammar_categories_bits(grammar_ru::zhensky_rod)},
+        {flag_set_unset.str(),"должно быть установлено",0,grammar_categories_bits(grammar_ru::sredny_rod)},
+        {flag_set_unset.str(),"должны быть установлены",0,grammar_categories_bits(grammar_ru::mn_chislo)},
+        {flag_set_unset.n_str(),"должен быть не установлен"}, // "must be unset"
+        {flag_set_unset.n_str(),"должна быть не установлена",0,grammar_categories_bits(grammar_ru::zhensky_rod)},
+        {flag_set_unset.n_str(),"должно быть не установлено",0,grammar_categories_bits(grammar_ru::sredny_rod)},
+        {flag_set_unset.n_str(),"должны быть не установлены",0,grammar_categories_bits(grammar_ru::mn_chislo)},
+        {flag_enable_disable.str(),"должен быть активен"}, // "must be enabled"
+        {flag_enable_disable.str(),"должна быть активна",0,grammar_categories_bits(grammar_ru::zhensky_rod)},
+        {flag_enable_disable.str(),"должно быть активно",0,grammar_categories_bits(grammar_ru::sredny_rod)},
+        {flag_enable_disable.str(),"должны быть активны",0,grammar_categories_bits(grammar_ru::mn_chislo)},
+        {flag_enable_disable.n_str(),"должен быть неактивен"}, // "must be disabled"
+        {flag_enable_disable.n_str(),"должна быть неактивна",0,grammar_categories_bits(grammar_ru::zhensky_rod)},
+        {flag_enable_disable.n_str(),"должно быть неактивно",0,grammar_categories_bits(grammar_ru::sredny_rod)},
+        {flag_enable_disable.n_str(),"должны быть неактивны",0,grammar_categories_bits(grammar_ru::mn_chislo)},
 
         // properties
-        m[value.name()]={{{"значение",grammar_ru::sredny_rod},grammar_ru::sredny_rod}}; // "value"
-        m[empty.name()]={
-                            {"пустой"},
-                            {"пустая",grammar_ru::zhensky_rod},
-                            {"пустое",grammar_ru::sredny_rod},
-                            {"пустые",grammar_ru::mn_chislo}
-                        }; // "empty"
-        m[size.name()]={
-                            {"размер"},
-                            {"размера",grammar_ru::roditelny_padezh}
-                        }; // "size"
-        m[length.name()]={
-                        {{"длина",grammar_ru::zhensky_rod},grammar_ru::sredny_rod},
-                        {{"длины",grammar_ru::zhensky_rod},grammar_ru::sredny_rod,grammar_ru::roditelny_padezh}
-                    }; // "length"
-        m[h_size.name()]={
-                        {"гетерогенный размер"},
-                        {"гетерогенного размера",grammar_ru::roditelny_padezh}
-                    };// "heterogeneous size"
+        {value.name(),"значение",grammar_categories_bits(grammar_ru::sredny_rod),grammar_categories_bits(grammar_ru::sredny_rod)}, // "value"
+        {empty.name(),"пустой"}, // "empty"
+        {empty.name(),"пустая",0,grammar_categories_bits(grammar_ru::zhensky_rod)},
+        {empty.name(),"пустое",0,grammar_categories_bits(grammar_ru::sredny_rod)},
+        {empty.name(),"пустые",0,grammar_categories_bits(grammar_ru::mn_chislo)},
+        {size.name(),"размер"}, // "size"
+        {size.name(),"размера",0,grammar_categories_bits(grammar_ru::roditelny_padezh)},
+        {length.name(),"длина",grammar_categories_bits(grammar_ru::zhensky_rod),grammar_categories_bits(grammar_ru::sredny_rod)}, // "length"
+        {length.name(),"длины",grammar_categories_bits(grammar_ru::zhensky_rod),grammar_categories_bits(grammar_ru::sredny_rod,grammar_ru::roditelny_padezh)},
+        {h_size.name(),"гетерогенный размер"}, // "heterogeneous size"
+        {h_size.name(),"гетерогенного размера",0,grammar_categories_bits(grammar_ru::roditelny_padezh)},
 
         // existance
-        m[string_exists]={
-                            {"должен существовать"},
-                            {"должна существовать",grammar_ru::zhensky_rod},
-                            {"должно существовать",grammar_ru::sredny_rod},
-                            {"должны существовать",grammar_ru::mn_chislo}
-                        }; // "must exist"
-        m[string_not_exists]={
-                            {"не должен существовать"},
-                            {"не должна существовать",grammar_ru::zhensky_rod},
-                            {"не должно существовать",grammar_ru::sredny_rod},
-                            {"не должны существовать",grammar_ru::mn_chislo}
-                        }; // "must not exist"
-        m[contains.str()]={
-                            {{"должен содержать",grammar_ru::datelny_padezh}},
-                            {{"должна содержать",grammar_ru::datelny_padezh},grammar_ru::zhensky_rod},
-                            {{"должно содержать",grammar_ru::datelny_padezh},grammar_ru::sredny_rod},
-                            {{"должны сожержать",grammar_ru::datelny_padezh},grammar_ru::mn_chislo}
-                        }; // "must contain"
-        m[contains.n_str()]={
-                            {{"не должен содержать",grammar_ru::datelny_padezh}},
-                            {{"не должна содержать",grammar_ru::datelny_padezh},grammar_ru::zhensky_rod},
-                            {{"не должно содержать",grammar_ru::datelny_padezh},grammar_ru::sredny_rod},
-                            {{"не должны сожержать",grammar_ru::datelny_padezh},grammar_ru::mn_chislo}
-                        }; // "must not contain"
+        {string_exists,"должен существовать"}, // "must exist"
+        {string_exists,"должна существовать",0,grammar_categories_bits(grammar_ru::zhensky_rod)},
+        {string_exists,"должно существовать",0,grammar_categories_bits(grammar_ru::sredny_rod)},
+        {string_exists,"должны существовать",0,grammar_categories_bits(grammar_ru::mn_chislo)},
+        {string_not_exists,"не должен существовать"}, // "must not exist"
+        {string_not_exists,"не должна существовать",0,grammar_categories_bits(grammar_ru::zhensky_rod)},
+        {string_not_exists,"не должно существовать",0,grammar_categories_bits(grammar_ru::sredny_rod)},
+        {string_not_exists,"не должны существовать",0,grammar_categories_bits(grammar_ru::mn_chislo)},
+        {contains.str(),"должен содержать",grammar_categories_bits(grammar_ru::datelny_padezh)}, // "must contain"
+        {contains.str(),"должна содержать",grammar_categories_bits(grammar_ru::datelny_padezh),grammar_categories_bits(grammar_ru::zhensky_rod)},
+        {contains.str(),"должно содержать",grammar_categories_bits(grammar_ru::datelny_padezh),grammar_categories_bits(grammar_ru::sredny_rod)},
+        {contains.str(),"должны сожержать",grammar_categories_bits(grammar_ru::datelny_padezh),grammar_categories_bits(grammar_ru::mn_chislo)},
+        {contains.n_str(),"не должен содержать",grammar_categories_bits(grammar_ru::datelny_padezh)}, // "must not contain"
+        {contains.n_str(),"не должна содержать",grammar_categories_bits(grammar_ru::datelny_padezh),grammar_categories_bits(grammar_ru::zhensky_rod)},
+        {contains.n_str(),"не должно содержать",grammar_categories_bits(grammar_ru::datelny_padezh),grammar_categories_bits(grammar_ru::sredny_rod)},
+        {contains.n_str(),"не должны сожержать",grammar_categories_bits(grammar_ru::datelny_padezh),grammar_categories_bits(grammar_ru::mn_chislo)},
 
         // comparison
-        m[eq]={
-                {{"должен быть равен",grammar_ru::datelny_padezh}},
-                {{"должна быть равна",grammar_ru::datelny_padezh},grammar_ru::zhensky_rod},
-                {{"должно быть равно",grammar_ru::datelny_padezh},grammar_ru::sredny_rod},
-                {{"должны быть равны",grammar_ru::datelny_padezh},grammar_ru::mn_chislo}
-            }; // "must be equal to"
-        m[ne]={
-                {{"должен быть не равен",grammar_ru::datelny_padezh}},
-                {{"должна быть не равна",grammar_ru::datelny_padezh},grammar_ru::zhensky_rod},
-                {{"должно быть не равно",grammar_ru::datelny_padezh},grammar_ru::sredny_rod},
-                {{"должны быть не равны",grammar_ru::datelny_padezh},grammar_ru::mn_chislo}
-              }; // "must be not equal to"
-        m[lt]={
-                {{"должен быть меньше",grammar_ru::roditelny_padezh}},
-                {{"должна быть меньше",grammar_ru::roditelny_padezh},grammar_ru::zhensky_rod},
-                {{"должно быть меньше",grammar_ru::roditelny_padezh},grammar_ru::sredny_rod},
-                {{"должны быть меньше",grammar_ru::roditelny_padezh},grammar_ru::mn_chislo}
-              }; // "must be less than"
-        m[lte]={
-                {{"должен быть меньше или равен",grammar_ru::datelny_padezh}},
-                {{"должна быть меньше или равна",grammar_ru::datelny_padezh},grammar_ru::zhensky_rod},
-                {{"должно быть меньше или равно",grammar_ru::datelny_padezh},grammar_ru::sredny_rod},
-                {{"должны быть меньше или равны",grammar_ru::datelny_padezh},grammar_ru::mn_chislo}
-              }; // "must be less than or equal to"
-        m[gt]={
-                {{"должен быть больше",grammar_ru::roditelny_padezh}},
-                {{"должна быть больше",grammar_ru::roditelny_padezh},grammar_ru::zhensky_rod},
-                {{"должно быть больше",grammar_ru::roditelny_padezh},grammar_ru::sredny_rod},
-                {{"должны быть больше",grammar_ru::roditelny_padezh},grammar_ru::mn_chislo}
-              }; // "must be greater than"
-        m[gte]={
-                {{"должен быть больше или равен",grammar_ru::datelny_padezh}},
-                {{"должна быть больше или равна",grammar_ru::datelny_padezh},grammar_ru::zhensky_rod},
-                {{"должно быть больше или равно",grammar_ru::datelny_padezh},grammar_ru::sredny_rod},
-                {{"должны быть больше или равны",grammar_ru::datelny_padezh},grammar_ru::mn_chislo}
-              }; // "must be greater than or equal to"
+        {eq,"должен быть равен",grammar_categories_bits(grammar_ru::datelny_padezh)}, // "must be equal to"
+        {eq,"должна быть равна",grammar_categories_bits(grammar_ru::datelny_padezh),grammar_categories_bits(grammar_ru::zhensky_rod)},
+        {eq,"должно быть равно",grammar_categories_bits(grammar_ru::datelny_padezh),grammar_categories_bits(grammar_ru::sredny_rod)},
+        {eq,"должны быть равны",grammar_categories_bits(grammar_ru::datelny_padezh),grammar_categories_bits(grammar_ru::mn_chislo)},
+        {ne,"должен быть не равен",grammar_categories_bits(grammar_ru::datelny_padezh)}, // "must be not equal to"
+        {ne,"должна быть не равна",grammar_categories_bits(grammar_ru::datelny_padezh),grammar_categories_bits(grammar_ru::zhensky_rod)},
+        {ne,"должно быть не равно",grammar_categories_bits(grammar_ru::datelny_padezh),grammar_categories_bits(grammar_ru::sredny_rod)},
+        {ne,"должны быть не равны",grammar_categories_bits(grammar_ru::datelny_padezh),grammar_categories_bits(grammar_ru::mn_chislo)},
+        {lt,"должен быть меньше",grammar_categories_bits(grammar_ru::roditelny_padezh)}, // "must be less than"
+        {lt,"должна быть меньше",grammar_categories_bits(grammar_ru::roditelny_padezh),grammar_categories_bits(grammar_ru::zhensky_rod)},
+        {lt,"должно быть меньше",grammar_categories_bits(grammar_ru::roditelny_padezh),grammar_categories_bits(grammar_ru::sredny_rod)},
+        {lt,"должны быть меньше",grammar_categories_bits(grammar_ru::roditelny_padezh),grammar_categories_bits(grammar_ru::mn_chislo)},
+        {lte,"должен быть меньше или равен",grammar_categories_bits(grammar_ru::datelny_padezh)}, // "must be less than or equal to"
+        {lte,"должна быть меньше или равна",grammar_categories_bits(grammar_ru::datelny_padezh),grammar_categories_bits(grammar_ru::zhensky_rod)},
+        {lte,"должно быть меньше или равно",grammar_categories_bits(grammar_ru::datelny_padezh),grammar_categories_bits(grammar_ru::sredny_rod)},
+        {lte,"должны быть меньше или равны",grammar_categories_bits(grammar_ru::datelny_padezh),grammar_categories_bits(grammar_ru::mn_chislo)},
+        {gt,"должен быть больше",grammar_categories_bits(grammar_ru::roditelny_padezh)}, // "must be greater than"
+        {gt,"должна быть больше",grammar_categories_bits(grammar_ru::roditelny_padezh),grammar_categories_bits(grammar_ru::zhensky_rod)},
+        {gt,"должно быть больше",grammar_categories_bits(grammar_ru::roditelny_padezh),grammar_categories_bits(grammar_ru::sredny_rod)},
+        {gt,"должны быть больше",grammar_categories_bits(grammar_ru::roditelny_padezh),grammar_categories_bits(grammar_ru::mn_chislo)},
+        {gte,"должен быть больше или равен",grammar_categories_bits(grammar_ru::datelny_padezh)}, // "must be greater than or equal to"
+        {gte,"должна быть больше или равна",grammar_categories_bits(grammar_ru::datelny_padezh),grammar_categories_bits(grammar_ru::zhensky_rod)},
+        {gte,"должно быть больше или равно",grammar_categories_bits(grammar_ru::datelny_padezh),grammar_categories_bits(grammar_ru::sredny_rod)},
+        {gte,"должны быть больше или равны",grammar_categories_bits(grammar_ru::datelny_padezh),grammar_categories_bits(grammar_ru::mn_chislo)},
 
         // lexicographical
-        m[lex_starts_with.str()]={
-                {{"должен начинаться с",grammar_ru::roditelny_padezh}},
-                {{"должна начинаться с",grammar_ru::roditelny_padezh},grammar_ru::zhensky_rod},
-                {{"должно начинаться с",grammar_ru::roditelny_padezh},grammar_ru::sredny_rod},
-                {{"должны начинаться с",grammar_ru::roditelny_padezh},grammar_ru::mn_chislo}
-              }; // "must start with"
-        m[lex_starts_with.n_str()]={
-                {{"не должен начинаться с",grammar_ru::roditelny_padezh}},
-                {{"не должна начинаться с",grammar_ru::roditelny_padezh},grammar_ru::zhensky_rod},
-                {{"не должно начинаться с",grammar_ru::roditelny_padezh},grammar_ru::sredny_rod},
-                {{"не должны начинаться с",grammar_ru::roditelny_padezh},grammar_ru::mn_chislo}
-              }; // "must not start with"
-        m[lex_ends_with.str()]={
-                {{"должен оканчиваться на",grammar_ru::roditelny_padezh}},
-                {{"должна оканчиваться на",grammar_ru::roditelny_padezh},grammar_ru::zhensky_rod},
-                {{"должно оканчиваться на",grammar_ru::roditelny_padezh},grammar_ru::sredny_rod},
-                {{"должны оканчиваться на",grammar_ru::roditelny_padezh},grammar_ru::mn_chislo}
-              }; // "must end with"
-        m[lex_ends_with.n_str()]={
-                {{"не должен оканчиваться на",grammar_ru::roditelny_padezh}},
-                {{"не должна оканчиваться на",grammar_ru::roditelny_padezh},grammar_ru::zhensky_rod},
-                {{"не должно оканчиваться на",grammar_ru::roditelny_padezh},grammar_ru::sredny_rod},
-                {{"не должны оканчиваться на",grammar_ru::roditelny_padezh},grammar_ru::mn_chislo}
-              }; // "must not end with"
+        {lex_starts_with.str(),"должен начинаться с",grammar_categories_bits(grammar_ru::roditelny_padezh)}, // "must start with"
+        {lex_starts_with.str(),"должна начинаться с",grammar_categories_bits(grammar_ru::roditelny_padezh),grammar_categories_bits(grammar_ru::zhensky_rod)},
+        {lex_starts_with.str(),"должно начинаться с",grammar_categories_bits(grammar_ru::roditelny_padezh),grammar_categories_bits(grammar_ru::sredny_rod)},
+        {lex_starts_with.str(),"должны начинаться с",grammar_categories_bits(grammar_ru::roditelny_padezh),grammar_categories_bits(grammar_ru::mn_chislo)},
+        {lex_starts_with.n_str(),"не должен начинаться с",grammar_categories_bits(grammar_ru::roditelny_padezh)}, // "must not start with"
+        {lex_starts_with.n_str(),"не должна начинаться с",grammar_categories_bits(grammar_ru::roditelny_padezh),grammar_categories_bits(grammar_ru::zhensky_rod)},
+        {lex_starts_with.n_str(),"не должно начинаться с",grammar_categories_bits(grammar_ru::roditelny_padezh),grammar_categories_bits(grammar_ru::sredny_rod)},
+        {lex_starts_with.n_str(),"не должны начинаться с",grammar_categories_bits(grammar_ru::roditelny_padezh),grammar_categories_bits(grammar_ru::mn_chislo)},
+        {lex_ends_with.str(),"должен оканчиваться на",grammar_categories_bits(grammar_ru::roditelny_padezh)}, // "must end with"
+        {lex_ends_with.str(),"должна оканчиваться на",grammar_categories_bits(grammar_ru::roditelny_padezh),grammar_categories_bits(grammar_ru::zhensky_rod)},
+        {lex_ends_with.str(),"должно оканчиваться на",grammar_categories_bits(grammar_ru::roditelny_padezh),grammar_categories_bits(grammar_ru::sredny_rod)},
+        {lex_ends_with.str(),"должны оканчиваться на",grammar_categories_bits(grammar_ru::roditelny_padezh),grammar_categories_bits(grammar_ru::mn_chislo)},
+        {lex_ends_with.n_str(),"не должен оканчиваться на",grammar_categories_bits(grammar_ru::roditelny_padezh)}, // "must not end with"
+        {lex_ends_with.n_str(),"не должна оканчиваться на",grammar_categories_bits(grammar_ru::roditelny_padezh),grammar_categories_bits(grammar_ru::zhensky_rod)},
+        {lex_ends_with.n_str(),"не должно оканчиваться на",grammar_categories_bits(grammar_ru::roditelny_padezh),grammar_categories_bits(grammar_ru::sredny_rod)},
+        {lex_ends_with.n_str(),"не должны оканчиваться на",grammar_categories_bits(grammar_ru::roditelny_padezh),grammar_categories_bits(grammar_ru::mn_chislo)},
 
         // ranges and intervals
-        m[in]={
-                {{"должен быть в",grammar_ru::predlozhny_padezh}},
-                {{"должна быть в",grammar_ru::predlozhny_padezh},grammar_ru::zhensky_rod},
-                {{"должно быть в",grammar_ru::predlozhny_padezh},grammar_ru::sredny_rod},
-                {{"должны быть в",grammar_ru::predlozhny_padezh},grammar_ru::mn_chislo}
-              }; // "must be in"
-        m[nin]={
-                {{"должен быть вне",grammar_ru::roditelny_padezh}},
-                {{"должна быть вне",grammar_ru::roditelny_padezh},grammar_ru::zhensky_rod},
-                {{"должно быть вне",grammar_ru::roditelny_padezh},grammar_ru::sredny_rod},
-                {{"должны быть вне",grammar_ru::roditelny_padezh},grammar_ru::mn_chislo}
-              }; // "must be not in"
-        m[range_str]={
-                {"список"},
-                {"списке",grammar_ru::predlozhny_padezh},
-                {"списка",grammar_ru::roditelny_padezh}
-              }; // range
-        m[interval_str]={
-                {"интервал"},
-                {"интервале",grammar_ru::predlozhny_padezh},
-                {"интервала",grammar_ru::roditelny_padezh}
-              }; // interval
+        {in,"должен быть в",grammar_categories_bits(grammar_ru::predlozhny_padezh)}, // "must be in"
+        {in,"должна быть в",grammar_categories_bits(grammar_ru::predlozhny_padezh),grammar_categories_bits(grammar_ru::zhensky_rod)},
+        {in,"должно быть в",grammar_categories_bits(grammar_ru::predlozhny_padezh),grammar_categories_bits(grammar_ru::sredny_rod)},
+        {in,"должны быть в",grammar_categories_bits(grammar_ru::predlozhny_padezh),grammar_categories_bits(grammar_ru::mn_chislo)},
+        {nin,"должен быть вне",grammar_categories_bits(grammar_ru::roditelny_padezh)}, // "must be not in"
+        {nin,"должна быть вне",grammar_categories_bits(grammar_ru::roditelny_padezh),grammar_categories_bits(grammar_ru::zhensky_rod)},
+        {nin,"должно быть вне",grammar_categories_bits(grammar_ru::roditelny_padezh),grammar_categories_bits(grammar_ru::sredny_rod)},
+        {nin,"должны быть вне",grammar_categories_bits(grammar_ru::roditelny_padezh),grammar_categories_bits(grammar_ru::mn_chislo)},
+        {range_str,"список"}, // range
+        {range_str,"списке",0,grammar_categories_bits(grammar_ru::predlozhny_padezh)},
+        {range_str,"списка",0,grammar_categories_bits(grammar_ru::roditelny_padezh)},
+        {interval_str,"интервал"}, // interval
+        {interval_str,"интервале",0,grammar_categories_bits(grammar_ru::predlozhny_padezh)},
+        {interval_str,"интервала",0,grammar_categories_bits(grammar_ru::roditelny_padezh)},
 
         // regex and strings
-        m[regex_match.str()]={
-                {"должен соответствовать выражению"},
-                {"должна соответствовать выражению",grammar_ru::zhensky_rod},
-                {"должно соответствовать выражению",grammar_ru::sredny_rod},
-                {"должны соответствовать выражению",grammar_ru::mn_chislo}
-            }; // "must match expression"
-        m[regex_match.n_str()]={
-                {"не должен соответствовать выражению"},
-                {"не должна соответствовать выражению",grammar_ru::zhensky_rod},
-                {"не должно соответствовать выражению",grammar_ru::sredny_rod},
-                {"не должны соответствовать выражению",grammar_ru::mn_chislo}
-            }; // "must not match expression"
-        m[regex_contains.str()]={
-                {"должен содержать выражению"},
-                {"должна содержать выражению",grammar_ru::zhensky_rod},
-                {"должно содержать выражению",grammar_ru::sredny_rod},
-                {"должны содержать выражению",grammar_ru::mn_chislo}
-            }; // "must contain expression"
-        m[regex_contains.n_str()]={
-                {"не должен содержать выражению"},
-                {"не должна содержать выражению",grammar_ru::zhensky_rod},
-                {"не должно содержать выражению",grammar_ru::sredny_rod},
-                {"не должны содержать выражению",grammar_ru::mn_chislo}
-            }; // "must not contain expression"
-        m[str_alpha.str()]={
-                {"должен содержать только буквы и цифры"},
-                {"должна содержать только буквы и цифры",grammar_ru::zhensky_rod},
-                {"должно содержать только буквы и цифры",grammar_ru::sredny_rod},
-                {"должны содержать только буквы и цифры",grammar_ru::mn_chislo}
-            }; // "must contain only letters and digits"
-        m[str_alpha.n_str()]={
-                {"должен содержать не только буквы и цифры"},
-                {"должна содержать не только буквы и цифры",grammar_ru::zhensky_rod},
-                {"должно содержать не только буквы и цифры",grammar_ru::sredny_rod},
-                {"должны содержать не только буквы и цифры",grammar_ru::mn_chislo}
-            }; // "must contain not only letters and digits"
-        m[str_hex.str()]={
-                {"должен быть шестнадцатеричным числом"},
-                {"должна быть шестнадцатеричным числом",grammar_ru::zhensky_rod},
-                {"должно быть шестнадцатеричным числом",grammar_ru::sredny_rod},
-                {"должны быть шестнадцатеричным числом",grammar_ru::mn_chislo}
-            }; // "must be a hexadecimal number"
-        m[str_hex.n_str()]={
-                {"не должен быть шестнадцатеричным числом"},
-                {"не должна быть шестнадцатеричным числом",grammar_ru::zhensky_rod},
-                {"не должно быть шестнадцатеричным числом",grammar_ru::sredny_rod},
-                {"не должны быть шестнадцатеричным числом",grammar_ru::mn_chislo}
-            }; // "must be not a hexadecimal number"
-        m[str_int.str()]={
-                {"должен быть целочисленным"},
-                {"должна быть целочисленной",grammar_ru::zhensky_rod},
-                {"должно быть целочисленным",grammar_ru::sredny_rod},
-                {"должны быть целочисленными",grammar_ru::mn_chislo}
-            }; // "must be integer"
-        m[str_int.n_str()]={
-                {"не должен целочисленным"},
-                {"не должна целочисленной",grammar_ru::zhensky_rod},
-                {"не должно целочисленным",grammar_ru::sredny_rod},
-                {"не должны целочисленными",grammar_ru::mn_chislo}
-            }; // "must not be integer"
-        m[str_float.str()]={
-                {"должен быть вещественным числом"},
-                {"должна быть вещественным числом",grammar_ru::zhensky_rod},
-                {"должно быть вещественным числом",grammar_ru::sredny_rod},
-                {"должны быть вещественным числом",grammar_ru::mn_chislo}
-            }; // "must be a floating point number"
-        m[str_float.n_str()]={
-                {"не должен вещественным числом"},
-                {"не должна вещественным числом",grammar_ru::zhensky_rod},
-                {"не должно вещественным числом",grammar_ru::sredny_rod},
-                {"не должны вещественным числом",grammar_ru::mn_chislo}
-            }; // "must be not a floating point number"
-    }
-
-    return m;
+        {regex_match.str(),"должен соответствовать выражению"}, // "must match expression"
+        {regex_match.str(),"должна соответствовать выражению",0,grammar_categories_bits(grammar_ru::zhensky_rod)},
+        {regex_match.str(),"должно соответствовать выражению",0,grammar_categories_bits(grammar_ru::sredny_rod)},
+        {regex_match.str(),"должны соответствовать выражению",0,grammar_categories_bits(grammar_ru::mn_chislo)},
+        {regex_match.n_str(),"не должен соответствовать выражению"}, // "must not match expression"
+        {regex_match.n_str(),"не должна соответствовать выражению",0,grammar_categories_bits(grammar_ru::zhensky_rod)},
+        {regex_match.n_str(),"не должно соответствовать выражению",0,grammar_categories_bits(grammar_ru::sredny_rod)},
+        {regex_match.n_str(),"не должны соответствовать выражению",0,grammar_categories_bits(grammar_ru::mn_chislo)},
+        {regex_contains.str(),"должен содержать выражению"}, // "must contain expression"
+        {regex_contains.str(),"должна содержать выражению",0,grammar_categories_bits(grammar_ru::zhensky_rod)},
+        {regex_contains.str(),"должно содержать выражению",0,grammar_categories_bits(grammar_ru::sredny_rod)},
+        {regex_contains.str(),"должны содержать выражению",0,grammar_categories_bits(grammar_ru::mn_chislo)},
+        {regex_contains.n_str(),"не должен содержать выражению"}, // "must not contain expression"
+        {regex_contains.n_str(),"не должна содержать выражению",0,grammar_categories_bits(grammar_ru::zhensky_rod)},
+        {regex_contains.n_str(),"не должно содержать выражению",0,grammar_categories_bits(grammar_ru::sredny_rod)},
+        {regex_contains.n_str(),"не должны содержать выражению",0,grammar_categories_bits(grammar_ru::mn_chislo)},
+        {str_alpha.str(),"должен содержать только буквы и цифры"}, // "must contain only letters and digits"
+        {str_alpha.str(),"должна содержать только буквы и цифры",0,grammar_categories_bits(grammar_ru::zhensky_rod)},
+        {str_alpha.str(),"должно содержать только буквы и цифры",0,grammar_categories_bits(grammar_ru::sredny_rod)},
+        {str_alpha.str(),"должны содержать только буквы и цифры",0,grammar_categories_bits(grammar_ru::mn_chislo)},
+        {str_alpha.n_str(),"должен содержать не только буквы и цифры"}, // "must contain not only letters and digits"
+        {str_alpha.n_str(),"должна содержать не только буквы и цифры",0,grammar_categories_bits(grammar_ru::zhensky_rod)},
+        {str_alpha.n_str(),"должно содержать не только буквы и цифры",0,grammar_categories_bits(grammar_ru::sredny_rod)},
+        {str_alpha.n_str(),"должны содержать не только буквы и цифры",0,grammar_categories_bits(grammar_ru::mn_chislo)},
+        {str_hex.str(),"должен быть шестнадцатеричным числом"}, // "must be a hexadecimal number"
+        {str_hex.str(),"должна быть шестнадцатеричным числом",0,grammar_categories_bits(grammar_ru::zhensky_rod)},
+        {str_hex.str(),"должно быть шестнадцатеричным числом",0,grammar_categories_bits(grammar_ru::sredny_rod)},
+        {str_hex.str(),"должны быть шестнадцатеричным числом",0,grammar_categories_bits(grammar_ru::mn_chislo)},
+        {str_hex.n_str(),"не должен быть шестнадцатеричным числом"}, // "must be not a hexadecimal number"
+        {str_hex.n_str(),"не должна быть шестнадцатеричным числом",0,grammar_categories_bits(grammar_ru::zhensky_rod)},
+        {str_hex.n_str(),"не должно быть шестнадцатеричным числом",0,grammar_categories_bits(grammar_ru::sredny_rod)},
+        {str_hex.n_str(),"не должны быть шестнадцатеричным числом",0,grammar_categories_bits(grammar_ru::mn_chislo)},
+        {str_int.str(),"должен быть целочисленным"}, // "must be integer"
+        {str_int.str(),"должна быть целочисленной",0,grammar_categories_bits(grammar_ru::zhensky_rod)},
+        {str_int.str(),"должно быть целочисленным",0,grammar_categories_bits(grammar_ru::sredny_rod)},
+        {str_int.str(),"должны быть целочисленными",0,grammar_categories_bits(grammar_ru::mn_chislo)},
+        {str_int.n_str(),"не должен целочисленным"}, // "must not be integer"
+        {str_int.n_str(),"не должна целочисленной",0,grammar_categories_bits(grammar_ru::zhensky_rod)},
+        {str_int.n_str(),"не должно целочисленным",0,grammar_categories_bits(grammar_ru::sredny_rod)},
+        {str_int.n_str(),"не должны целочисленными",0,grammar_categories_bits(grammar_ru::mn_chislo)},
+        {str_float.str(),"должен быть вещественным числом"}, // "must be a floating point number"
+        {str_float.str(),"должна быть вещественным числом",0,grammar_categories_bits(grammar_ru::zhensky_rod)},
+        {str_float.str(),"должно быть вещественным числом",0,grammar_categories_bits(grammar_ru::sredny_rod)},
+        {str_float.str(),"должны быть вещественным числом",0,grammar_categories_bits(grammar_ru::mn_chislo)},
+        {str_float.n_str(),"не должен вещественным числом"}, // "must be not a floating point number"
+        {str_float.n_str(),"не должна вещественным числом",0,grammar_categories_bits(grammar_ru::zhensky_rod)},
+        {str_float.n_str(),"не должно вещественным числом",0,grammar_categories_bits(grammar_ru::sredny_rod)},
+        {str_float.n_str(),"не должны вещественным числом",0,grammar_categories_bits(grammar_ru::mn_chislo)}
+    };
+    constexpr static auto table=make_static_phrases(phrases);
+    static const static_translator tr{table};
+    return tr;
+}
+
+/**
+ * @brief Get translator of validator strings for Russian locale as phrase_translator.
+ * @return Phrase translator with the same translations as validator_static_translator_ru().
+ *
+ * The translator is built on the first call. Use validator_static_translator_ru() to avoid that.
+ */
+inline const phrase_translator& validator_translator_ru()
+{
+    static const phrase_translator tr=make_phrase_translator(validator_static_translator_ru());
+    return tr;
 }
 
 //-------------------------------------------------------------
@@ -0,0 +1,179 @@
+/**
+@copyright Evgeny Sidorov 2020
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+*/
+
+/****************************************************************************/
+
+/** @file validator/reporting/output_iterator_dst.hpp
+*
+*  Defines report destination that writes to output iterator.
+*
+*/
+
+/****************************************************************************/
+
+#ifndef HATN_VALIDATOR_OUTPUT_ITERATOR_DST_HPP
+#define HATN_VALIDATOR_OUTPUT_ITERATOR_DST_HPP
+
+#include <string>
+#include <locale>
+
+#include <hatn/validator/config.hpp>
+
+HATN_VALIDATOR_NAMESPACE_BEGIN
+
+//-------------------------------------------------------------
+
+/**
+ * @brief Report destination that writes chars to output iterator.
+ *
+ * Chars are written to the iterator as soon as they are formatted, written chars can not be modified.
+ * Thus, whitespaces at both ends of a report are never written to the iterator: leading whitespaces are skipped
+ * and trailing whitespaces are held back until a non-whitespace char follows them.
+ * Only reports of nested aggregations are prepared in intermediate strings before they are written to the iterator, see part_type.
+ *
+ * @code
+ * std::vector<char> frame;
+ * auto dst=make_output_iterator_dst(std::back_inserter(frame));
+ * auto ra=make_reporting_adapter(obj,dst);
+ * @endcode
+ */
+template <typename OutputIt>
+class output_iterator_dst
+{
+    public:
+
+        using value_type=char;
+        using size_type=size_t;
+        using reference=char&;
+        using const_reference=const char&;
+
+        /**
+         * @brief Type of intermediate parts of reports.
+         */
+        using part_type=std::string;
+
+        /**
+         * @brief Constructor.
+         * @param it Output iterator.
+         */
+        explicit output_iterator_dst(OutputIt it)
+            : _it(std::move(it)),
+              _ctype(&std::use_facet<std::ctype<char>>(_locale)),
+              _size(0),
+              _pending_size(0)
+        {}
+
+        /**
+         * @brief Append char.
+         * @param ch Char to append.
+         */
+        void push_back(char ch)
+        {
+            if (_ctype->is(std::ctype_base::space,ch))
+            {
+                if (_size==0)
+                {
+                    return;
+                }
+                if (_pending_size==max_pending)
+                {
+                    flush_pending();
+                }
+                _pending[_pending_size++]=ch;
+                return;
+            }
+            flush_pending();
+            write(ch);
+        }
+
+        /**
+         * @brief Append chars.
+         * @param str Chars to append.
+         * @param size Number of chars.
+         */
+        void append(const char* str, size_t size)
+        {
+            for (size_t i=0;i<size;i++)
+            {
+                push_back(str[i]);
+            }
+        }
+
+        /**
+         * @brief Drop trailing whitespaces that are held back.
+         */
+        void trim() noexcept
+        {
+            _pending_size=0;
+        }
+
+        /**
+         * @brief Get output iterator pointing to the position following the last written char.
+         */
+        const OutputIt& iterator() const noexcept
+        {
+            return _it;
+        }
+
+        /**
+         * @brief Get number of chars written to the iterator.
+         */
+        size_t size() const noexcept
+        {
+            return _size;
+        }
+
+        bool empty() const noexcept
+        {
+            return _size==0;
+        }
+
+    private:
+
+        constexpr static const size_t max_pending=16;
+
+        void write(char ch)
+        {
+            *_it=ch;
+            ++_it;
+            ++_size;
+        }
+
+        void flush_pending()
+        {
+            for (size_t i=0;i<_pending_size;i++)
+            {
+                write(_pending[i]);
+            }
+            _pending_size=0;
+        }
+
+        std::locale _locale;
+        OutputIt _it;
+        const std::ctype<char>* _ctype;
+        size_t _size;
+        size_t _pending_size;
+        char _pending[max_pending];
+};
+
+/**
+ * @brief Make report destination that writes to output iterator.
+ * @param it Output iterator.
+ * @return Report destination.
+ */
+template <typename OutputIt>
+output_iterator_dst<OutputIt> make_output_iterator_dst(OutputIt it)
+{
+    return output_iterator_dst<OutputIt>(std::move(it));
+}
+
+//-------------------------------------------------------------
+
+HATN_VALIDATOR_NAMESPACE_END
+
+#endif // HATN_VALIDATOR_OUTPUT_ITERATOR_DST_HPP
@@ -21,9 +21,12 @@ Distributed under the Boost Software License, Version 1.0.
 
 #include <map>
 #include <vector>
+#include <iterator>
 #include <algorithm>
+#include <functional>
 
 #include <hatn/validator/config.hpp>
+#include <hatn/validator/utils/string_view.hpp>
 #include <hatn/validator/reporting/grammar_categories.hpp>
 #include <hatn/validator/reporting/translator.hpp>
 
@@ -80,6 +83,139 @@ struct phrase_and_grammar_cats
 
 //-------------------------------------------------------------
 
+/**
+ * @brief Variants of translation of a string with index for selection of the most suitable variant.
+ *
+ * The most suitable variant is the first one with the maximum number of grammatical categories matching requested categories.
+ * Only categories used by variants of the string can affect the selection, so the best variant is precomputed for each
+ * combination of those categories when the variants are set. Then selection is a single lookup in the index.
+ * If the string has too many variants or variants use too many categories then variants are scanned on each selection.
+ */
+class phrase_variants
+{
+    public:
+
+        /**
+         * @brief Constructor.
+         * @param phrases Variants of translation.
+         */
+        phrase_variants(
+                std::vector<phrase_and_grammar_cats> phrases=std::vector<phrase_and_grammar_cats>()
+            ) : _phrases(std::move(phrases)),
+                _mask(0)
+        {
+            build_index();
+        }
+
+        /**
+         * @brief Select the most suitable variant of translation.
+         * @param cats Grammar categories to look for.
+         * @return Pointer to selected variant or nullptr if there are no variants.
+         */
+        const phrase_and_grammar_cats* select(grammar_categories cats) const noexcept
+        {
+            if (_phrases.empty())
+            {
+                return nullptr;
+            }
+            if (cats==0 || _phrases.size()==1)
+            {
+                return &_phrases.front();
+            }
+            if (_index.empty())
+            {
+                return &_phrases[find_best(cats)];
+            }
+            return &_phrases[_index[index_of(cats)]];
+        }
+
+        /**
+         * @brief Get variants of translation.
+         * @return Variants.
+         */
+        const std::vector<phrase_and_grammar_cats>& phrases() const noexcept
+        {
+            return _phrases;
+        }
+
+    private:
+
+        constexpr static const size_t max_index_bits=8;
+        constexpr static const size_t max_index_phrases=256;
+
+        size_t find_best(grammar_categories cats) const noexcept
+        {
+            // find element with max number of matching categories
+            auto max_el=std::max_element(_phrases.begin(),_phrases.end(),
+                             [&cats](const phrase_and_grammar_cats& left, const phrase_and_grammar_cats& right)
+                             {
+                                auto l=count_grammar_categories(left.categories,cats);
+                                auto r=count_grammar_categories(right.categories,cats);
+                                return l<r;
+                             }
+                        );
+            return static_cast<size_t>(std::distance(_phrases.begin(),max_el));
+        }
+
+        size_t index_of(grammar_categories cats) const noexcept
+        {
+            size_t idx=0;
+            size_t pos=0;
+            for (auto mask=_mask;mask!=0;mask&=mask-1)
+            {
+                grammar_categories bit=mask&(~mask+1);
+                if (cats&bit)
+                {
+                    idx|=size_t(1)<<pos;
+                }
+                ++pos;
+            }
+            return idx;
+        }
+
+        grammar_categories categories_of(size_t idx) const noexcept
+        {
+            grammar_categories cats=0;
+            size_t pos=0;
+            for (auto mask=_mask;mask!=0;mask&=mask-1)
+            {
+                if (idx&(size_t(1)<<pos))
+                {
+                    cats|=mask&(~mask+1);
+                }
+                ++pos;
+            }
+            return cats;
+        }
+
+        void build_index()
+        {
+            _index.clear();
+            _mask=0;
+            for (auto&& it:_phrases)
+            {
+                _mask|=it.categories;
+            }
+            auto bits=count_grammar_categories(_mask);
+            if (_phrases.size()<2 || _phrases.size()>max_index_phrases || bits>max_index_bits)
+            {
+                return;
+            }
+
+            _index.resize(size_t(1)<<bits);
+            for (size_t i=0;i<_index.size();i++)
+            {
+                _index[i]=static_cast<uint8_t>(find_best(categories_of(i)));
+            }
+        }
+
+        std::vector<phrase_and_grammar_cats> _phrases;
+        grammar_categories _mask;
+        std::vector<uint8_t> _index;
+};
+
+//-------------------------------------------------------------
+
 /**
  * @brief Translator that is aware of grammatical categories.
  *
@@ -91,6 +227,8 @@ struct phrase_and_grammar_cats
  * are used as selectors of the most suitable phrase translation of given string in the phrase_translator.
  * Translator will select the phrase with the maximum number of matching grammatical categories of the former type.
  *
+ * Translated phrases refer to the text stored in the translator, thus, they are valid until the translator is modified or destroyed.
+ *
  * @see {validator_translator_sample()} for examples.
  */
 class phrase_translator : public translator
@@ -98,6 +236,7 @@ class phrase_translator : public translator
     public:
 
         using container_type=std::map<std::string,std::vector<phrase_and_grammar_cats>>;
+        using storage_type=std::map<std::string,phrase_variants,std::less<>>;
 
         phrase_translator()=default;
 
@@ -105,8 +244,13 @@ class phrase_translator : public translator
          * @brief Constructor.
          * @param phrases Translated strings.
          */
-        phrase_translator(container_type phrases):_phrases(std::move(phrases))
-        {}
+        phrase_translator(container_type phrases)
+        {
+            for (auto&& it:phrases)
+            {
+                _phrases.emplace(it.first,phrase_variants(std::move(it.second)));
+            }
+        }
 
         /**
          * @brief Reset map.
@@ -127,26 +271,28 @@ class phrase_translator : public translator
          *
          */
         virtual translation_result translate(const std::string& id, grammar_categories cats=0) const override
+        {
+            return find(string_view(id.data(),id.size()),cats);
+        }
+
+        /**
+         * @brief Translate a string given as string view.
+         * @param id String id.
+         * @param cats Grammar categories to look for.
+         * @return Translated string or id if such string not found.
+         */
+        virtual translation_result find(string_view id, grammar_categories cats=0) const override
         {
             auto it=_phrases.find(id);
             if (it!=_phrases.end())
             {
-                if (cats==0)
+                auto variant=it->second.select(cats);
+                if (variant!=nullptr)
                 {
-                    return translation_result{it->second.front().phrase,true};
+                    return translation_result{concrete_phrase::ref(variant->phrase.view(),variant->phrase.grammar_cats()),true};
                 }
-                // find element with max number of matching categories
-                auto max_el=std::max_element(it->second.begin(),it->second.end(),
-                                 [&cats](const phrase_and_grammar_cats& left, const phrase_and_grammar_cats& right)
-                                 {
-                                    auto l=count_grammar_categories(left.categories,cats);
-                                    auto r=count_grammar_categories(right.categories,cats);
-                                    return l<r;
-                                 }
-                            );
-                return translation_result{max_el->phrase,true};
             }
-            return translation_result{id,false};
+            return translation_result{std::string(id.data(),id.size()),false};
         }
 
         /**
@@ -168,7 +314,7 @@ class phrase_translator : public translator
 
     private:
 
-        container_type _phrases;
+        storage_type _phrases;
 };
 
 //-------------------------------------------------------------
@@ -224,7 +370,7 @@ constexpr phrase_translator_setter_helper_t<T> phrase_translator_setter_helper{}
  */
 struct phrase_translator_setter
 {
-    std::map<std::string,std::vector<phrase_and_grammar_cats>>::iterator it;
+    phrase_translator::storage_type::iterator it;
 
     /**
      * @brief Default assignment operator
@@ -232,7 +378,7 @@ struct phrase_translator_setter
     template <typename T>
     phrase_translator_setter& operator = (T&& arg)
     {
-        it->second=detail::phrase_translator_setter_helper<T>(std::forward<T>(arg));
+        it->second=phrase_variants(detail::phrase_translator_setter_helper<T>(std::forward<T>(arg)));
         return *this;
     }
 
@@ -241,7 +387,7 @@ struct phrase_translator_setter
      */
     phrase_translator_setter& operator = (std::initializer_list<phrase_and_grammar_cats>&& arg)
     {
-        it->second=detail::phrase_translator_setter_helper<std::initializer_list<phrase_and_grammar_cats>>(std::move(arg));
+        it->second=phrase_variants(detail::phrase_translator_setter_helper<std::initializer_list<phrase_and_grammar_cats>>(std::move(arg)));
         return *this;
     }
 };
@@ -249,7 +395,7 @@ struct phrase_translator_setter
 template <typename T>
 auto phrase_translator::operator [] (T&& key)
 {
-    auto item=_phrases.emplace(std::forward<T>(key),std::vector<phrase_and_grammar_cats>());
+    auto item=_phrases.emplace(std::forward<T>(key),phrase_variants());
     return phrase_translator_setter{std::move(item.first)};
 }
 
@@ -21,6 +21,11 @@ Distributed under the Boost Software License, Version 1.0.
 
 #include <vector>
 #include <string>
+#include <limits>
+#include <utility>
+#include <algorithm>
+
+#include <boost/container/small_vector.hpp>
 
 #include <hatn/validator/config.hpp>
 #include <hatn/validator/aggregation/aggregation.hpp>
@@ -31,6 +36,98 @@ HATN_VALIDATOR_NAMESPACE_BEGIN
 
 struct report_aggregation_tag;
 
+/**
+ * @brief Settings of summarizing failures of elements in ALL aggregations.
+ *
+ * When summarizing is enabled then ALL aggregation does not stop on the first failed element.
+ * Instead, failures of all elements are collected and elements with identical reports are grouped, e.g.
+ * "each element of items must be greater than 0 (elements [3..999])".
+ *
+ * Summarizing is disabled by default.
+ */
+struct aggregation_summary
+{
+    /**
+     * @brief Constructor.
+     * @param max_groups Max number of distinct failure groups per aggregation, 0 disables summarizing.
+     * @param max_failures Max number of failed elements to collect per report, when reached the aggregation stops.
+     * @param max_report_elements Max number of index ranges to be listed in report for each group.
+     */
+    aggregation_summary(
+            size_t max_groups=0,
+            size_t max_failures=(std::numeric_limits<size_t>::max)(),
+            size_t max_report_elements=(std::numeric_limits<size_t>::max)()
+        ) : max_groups(max_groups),
+            max_failures(max_failures),
+            max_report_elements(max_report_elements)
+    {}
+
+    /**
+     * @brief Check if summarizing is enabled.
+     * @return True if summarizing is enabled.
+     */
+    bool enabled() const noexcept
+    {
+        return max_groups!=0 && max_failures!=0;
+    }
+
+    size_t max_groups;
+    size_t max_failures;
+    size_t max_report_elements;
+};
+
+/**
+ * @brief Group of elements of ALL aggregation that failed with identical report.
+ */
+template <typename DstT>
+struct report_failure_group
+{
+    /**
+     * @brief Constructor.
+     * @param part Report of the failure.
+     * @param index Index of the first failed element.
+     */
+    report_failure_group(
+            DstT part,
+            size_t index
+        ) : part(std::move(part)),
+            count(1)
+    {
+        ranges.emplace_back(index,index);
+    }
+
+    /**
+     * @brief Add index of failed element to the group.
+     * @param index Index of element, must be greater than indexes that were already added.
+     */
+    void add(size_t index)
+    {
+        if (ranges.back().second+1==index)
+        {
+            ranges.back().second=index;
+        }
+        else
+        {
+            ranges.emplace_back(index,index);
+        }
+        ++count;
+    }
+
+    /**
+     * @brief Check if report of this group is equal to other report.
+     * @param other Report to compare with.
+     * @return True if reports are equal.
+     */
+    bool matches(const DstT& other) const
+    {
+        return std::equal(std::begin(part),std::end(part),std::begin(other),std::end(other));
+    }
+
+    DstT part;
+    std::vector<std::pair<size_t,size_t>> ranges;
+    size_t count;
+};
+
 /**
  * @brief Descriptor of base aggregation operator used in validation report.
  */
@@ -74,9 +171,58 @@ struct report_aggregation : public empty_report_aggregation
 {
     using empty_report_aggregation::empty_report_aggregation;
 
+    /**
+     * @brief Add report of the current element to failure groups.
+     * @param max_groups Max number of distinct groups.
+     *
+     * Report of the current element is taken from the first part, then parts are cleared.
+     */
+    void add_failure(size_t max_groups)
+    {
+        if (parts.empty())
+        {
+            return;
+        }
+
+        auto& part=parts.front();
+        auto it=std::find_if(std::begin(groups),std::end(groups),
+                    [&part](const report_failure_group<DstT>& group)
+                    {
+                        return group.matches(part);
+                    }
+                 );
+        if (it!=std::end(groups))
+        {
+            it->add(element_index);
+        }
+        else if (groups.size()<max_groups)
+        {
+            groups.emplace_back(std::move(part),element_index);
+        }
+        else
+        {
+            ++omitted_count;
+        }
+        parts.clear();
+    }
+
     std::vector<DstT> parts;
+
+    bool summarized=false;
+    size_t element_index=0;
+    std::vector<report_failure_group<DstT>> groups;
+    size_t omitted_count=0;
 };
 
+/**
+ * @brief Stack of aggregations opened during validation.
+ *
+ * A few levels of nested aggregations are kept inline so that reporter does not allocate memory
+ * when validation succeeds.
+ */
+template <typename T>
+using report_aggregation_stack=boost::container::small_vector<T,4>;
+
 //-------------------------------------------------------------
 
 HATN_VALIDATOR_NAMESPACE_END
@@ -39,6 +39,8 @@ struct reporter_tag;
  * A report will be put to the destination object which is usually a sring but
  * formatter backends can also support other container types. Destination object
  * is wrapped into backend formatter that knows how to format data to that object.
+ * Reports of nested aggregations are prepared in intermediate parts of type
+ * DstT::type::part_type if that type is defined, otherwise parts have the same type as destination object.
  *
  * Actual formatting is performed by the formatter object.
  */
@@ -48,29 +50,53 @@ class reporter
     public:
 
         using hana_tag=reporter_tag;
+        using part_type=detail::report_part_t<typename DstT::type>;
 
         /**
          * @brief Constructor.
          * @param dst Destination object wrapped into backend formatter.
          * @param formatter Formatter to use for reports formatting.
+         * @param summary Settings of summarizing failures of elements in ALL aggregations.
          */
         reporter(
                     DstT dst,
-                    FormatterT&& formatter
+                    FormatterT&& formatter,
+                    aggregation_summary summary=aggregation_summary()
                 ) : _dst(std::move(dst)),
                     _formatter(std::forward<FormatterT>(formatter)),
                     _not_count(0),
-                    _explicit_reporting_count(0)
+                    _explicit_reporting_count(0),
+                    _summary(summary),
+                    _summary_failures(0)
         {}
 
         void reset()
         {
             _not_count=0;
             _explicit_reporting_count=0;
+            _summary_failures=0;
             _members.clear();
             _stack.clear();
         }
 
+        /**
+         * @brief Set settings of summarizing failures of elements in ALL aggregations.
+         * @param summary Summarizing settings.
+         */
+        void set_aggregation_summary(aggregation_summary summary) noexcept
+        {
+            _summary=summary;
+        }
+
+        /**
+         * @brief Get settings of summarizing failures of elements in ALL aggregations.
+         * @return Summarizing settings.
+         */
+        const aggregation_summary& get_aggregation_summary() const noexcept
+        {
+            return _summary;
+        }
+
         /**
          * @brief Open validation step for aggregation operator.
          * @param aggregation Descriptor of aggregation operator.
@@ -132,11 +158,17 @@ class reporter
                     }
                 }
 
+                if (back.summarized)
+                {
+                    summarize(back);
+                }
                 if (!ok || current_not())
                 {
                     update_brackets();
-                    auto wrapper=wrap_backend_formatter(report_dst(),_dst);
-                    _formatter.aggregate(wrapper,back);
+                    to_report_dst([&](auto& wrapper)
+                    {
+                        _formatter.aggregate(wrapper,back);
+                    });
                 }
                 if (back.aggregation.id==aggregation_id::NOT)
                 {
@@ -146,6 +178,38 @@ class reporter
             }
         }
 
+        /**
+         * @brief Notify that validation of next element of element aggregation begins.
+         * @param index Index of the element in the container.
+         */
+        void aggregate_element(size_t index)
+        {
+            auto frame=summary_frame();
+            if (frame!=nullptr)
+            {
+                frame->summarized=true;
+                frame->element_index=index;
+                frame->parts.clear();
+            }
+        }
+
+        /**
+         * @brief Notify that validation of current element of element aggregation failed.
+         * @return True if element aggregation must go on with the rest elements, false if it must stop.
+         *
+         * Element aggregation can go on only if summarizing is enabled and limit of failed elements is not reached yet.
+         */
+        bool aggregate_element_failed()
+        {
+            auto frame=summary_frame();
+            if (frame==nullptr || !frame->summarized)
+            {
+                return false;
+            }
+            frame->add_failure(_summary.max_groups);
+            return ++_summary_failures<_summary.max_failures;
+        }
+
         /**
          *  @brief Report validation of object at one level without member nesting.
          *  @param op Operator for validation.
@@ -158,8 +222,10 @@ class reporter
             {
                 return;
             }
-            auto wrapper=wrap_backend_formatter(current(),_dst);
-            _formatter.validate_operator(wrapper,op,b);
+            to_current([&](auto& wrapper)
+            {
+                _formatter.validate_operator(wrapper,op,b);
+            });
         }
 
         /**
@@ -175,8 +241,10 @@ class reporter
             {
                 return;
             }
-            auto wrapper=wrap_backend_formatter(current(),_dst);
-            _formatter.validate_property(wrapper,prop,op,b);
+            to_current([&](auto& wrapper)
+            {
+                _formatter.validate_property(wrapper,prop,op,b);
+            });
         }
 
         /**
@@ -199,8 +267,10 @@ class reporter
                 return;
             }
 
-            auto wrapper=wrap_backend_formatter(current(),_dst);
-            _formatter.validate_exists(wrapper,member,op,b);
+            to_current([&](auto& wrapper)
+            {
+                _formatter.validate_exists(wrapper,member,op,b);
+            });
         }
 
         /**
@@ -225,8 +295,10 @@ class reporter
                 return;
             }
 
-            auto wrapper=wrap_backend_formatter(current(),_dst);
-            _formatter.validate(wrapper,member,prop,op,b);
+            to_current([&](auto& wrapper)
+            {
+                _formatter.validate(wrapper,member,prop,op,b);
+            });
         }
 
         template <typename MemberT>
@@ -257,8 +329,10 @@ class reporter
                 return;
             }
 
-            auto wrapper=wrap_backend_formatter(current(),_dst);
-            _formatter.validate_with_other_member(wrapper,member,prop,op,b);
+            to_current([&](auto& wrapper)
+            {
+                _formatter.validate_with_other_member(wrapper,member,prop,op,b);
+            });
         }
 
         /**
@@ -284,8 +358,10 @@ class reporter
                 return;
             }
 
-            auto wrapper=wrap_backend_formatter(current(),_dst);
-            _formatter.validate_with_master_sample(wrapper,member,prop,op,member_sample,b);
+            to_current([&](auto& wrapper)
+            {
+                _formatter.validate_with_master_sample(wrapper,member,prop,op,member_sample,b);
+            });
         }
 
         /**
@@ -328,8 +404,10 @@ class reporter
             }
             if (_explicit_reporting_count==0)
             {
-                auto wrapper=wrap_backend_formatter(current(),_dst);
-                wrapper.append(description);
+                to_current([&](auto& wrapper)
+                {
+                    wrapper.append(description);
+                });
             }
         }
 
@@ -346,6 +424,10 @@ class reporter
         template <typename MemberT>
         void drop_failed_member(const MemberT& member)
         {
+            if (_members.empty())
+            {
+                return;
+            }
             std::string m=dotted_member_names(member);
             auto it=std::find(std::begin(_members),std::end(_members),m);
             if (it!=std::end(_members))
@@ -392,24 +474,64 @@ class reporter
             return false;
         }
 
-        typename DstT::type& current()
+        template <typename HandlerT>
+        void to_current(HandlerT&& handler)
         {
             if (!_stack.empty())
             {
                 _stack.back().parts.emplace_back();
-                return _stack.back().parts.back();
+                auto wrapper=wrap_backend_formatter(_stack.back().parts.back(),_dst);
+                handler(wrapper);
+                return;
             }
-            return _dst;
+            auto wrapper=wrap_backend_formatter(_dst.get(),_dst);
+            handler(wrapper);
         }
 
-        typename DstT::type& report_dst()
+        template <typename HandlerT>
+        void to_report_dst(HandlerT&& handler)
         {
             if (_stack.size()>1)
             {
                 _stack.at(_stack.size()-2).parts.emplace_back();
-                return _stack.at(_stack.size()-2).parts.back();
+                auto wrapper=wrap_backend_formatter(_stack.at(_stack.size()-2).parts.back(),_dst);
+                handler(wrapper);
+                return;
             }
-            return _dst;
+            auto wrapper=wrap_backend_formatter(_dst.get(),_dst);
+            handler(wrapper);
+        }
+
+        report_aggregation<part_type>* summary_frame()
+        {
+            if (!_summary.enabled() || skip_explicit_report() || current_not() || _stack.empty())
+            {
+                return nullptr;
+            }
+            auto& back=_stack.back();
+            if (back.aggregation.id!=aggregation_id::ALL || back.any_all_count!=1)
+            {
+                return nullptr;
+            }
+            return &back;
+        }
+
+        void summarize(report_aggregation<part_type>& aggregation)
+        {
+            aggregation.parts.clear();
+            for (auto&& group:aggregation.groups)
+            {
+                aggregation.parts.emplace_back();
+                auto wrapper=wrap_backend_formatter(aggregation.parts.back(),_dst);
+                _formatter.aggregation_summary_group(wrapper,group,_summary.max_report_elements);
+            }
+            if (aggregation.omitted_count!=0)
+            {
+                // summary is enabled only with non-zero max_groups, so omitted failures always follow some group
+                auto wrapper=wrap_backend_formatter(aggregation.parts.back(),_dst);
+                _formatter.aggregation_summary_omitted(wrapper,aggregation.omitted_count);
+            }
+            aggregation.groups.clear();
         }
 
         void update_brackets()
@@ -432,10 +554,13 @@ class reporter
 
         DstT _dst;
         FormatterT _formatter;
-        std::vector<report_aggregation<typename DstT::type>> _stack;
+        report_aggregation_stack<report_aggregation<part_type>> _stack;
         size_t _not_count;
         size_t _explicit_reporting_count;
 
+        aggregation_summary _summary;
+        size_t _summary_failures;
+
         std::vector<std::string> _members;
 };
 
@@ -452,6 +577,20 @@ auto make_reporter(DstT& dst, FormatterT&& formatter)
     return reporter<decltype(wrapper),FormatterT>(std::move(wrapper),std::forward<FormatterT>(formatter));
 }
 
+/**
+ * @brief Make a reporter with formatter that summarizes failures of elements in ALL aggregations.
+ * @param dst Destination object where to put reports.
+ * @param formatter Formatter to use for reports formatting.
+ * @param summary Settings of summarizing.
+ * @return Reporter wrapping the destination object.
+ */
+template <typename DstT, typename FormatterT>
+auto make_reporter(DstT& dst, FormatterT&& formatter, aggregation_summary summary)
+{
+    auto wrapper=wrap_backend_formatter(dst);
+    return reporter<decltype(wrapper),FormatterT>(std::move(wrapper),std::forward<FormatterT>(formatter),summary);
+}
+
 /**
  * @brief Make a reporter with default formatter.
  * @param dst Destination object where to put reports.
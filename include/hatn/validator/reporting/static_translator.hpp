@@ -0,0 +1,346 @@
+/**
+@copyright Evgeny Sidorov 2020
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+*/
+
+/****************************************************************************/
+
+/** @file validator/reporting/static_translator.hpp
+*
+*   Defines translator that uses compile-time table of phrases.
+*
+*/
+
+/****************************************************************************/
+
+#ifndef HATN_VALIDATOR_STATIC_TRANSLATOR_HPP
+#define HATN_VALIDATOR_STATIC_TRANSLATOR_HPP
+
+#include <string>
+#include <utility>
+#include <algorithm>
+
+#include <hatn/validator/config.hpp>
+#include <hatn/validator/utils/string_view.hpp>
+#include <hatn/validator/reporting/grammar_categories.hpp>
+#include <hatn/validator/reporting/translator.hpp>
+#include <hatn/validator/reporting/phrase_translator.hpp>
+
+HATN_VALIDATOR_NAMESPACE_BEGIN
+
+//-------------------------------------------------------------
+
+namespace detail
+{
+
+/**
+ * @brief Get ID of static phrase from a string.
+ */
+constexpr inline const char* static_phrase_id(const char* id) noexcept
+{
+    return id;
+}
+
+/**
+ * @brief Get ID of static phrase from an object with static description, e.g. operator.
+ */
+template <typename T>
+constexpr auto static_phrase_id(const T&) noexcept -> decltype(static_cast<const char*>(T::description))
+{
+    return T::description;
+}
+
+/**
+ * @brief Get length of a string at compile time.
+ */
+constexpr inline size_t static_phrase_length(const char* str) noexcept
+{
+    size_t length=0;
+    while (str[length]!=0)
+    {
+        ++length;
+    }
+    return length;
+}
+
+}
+
+/**
+ * @brief Phrase in compile-time table of translations.
+ *
+ * Each phrase contains ID of translated string, text of translation, grammatical categories of the translation
+ * and grammatical categories of preceding phrase this translation is suitable for.
+ * Meaning of grammatical categories is the same as in phrase_translator.
+ * If there are several translations of the same ID then they must be placed in the table in the same order
+ * as the variants in phrase_translator.
+ */
+struct static_phrase
+{
+    /**
+     * @brief Default constructor.
+     */
+    constexpr static_phrase() noexcept
+        : id(""),
+          id_size(0),
+          text(""),
+          text_size(0),
+          text_cats(0),
+          selector_cats(0)
+    {}
+
+    /**
+     * @brief Constructor.
+     * @param id ID of translated string, either a string or an object with static description.
+     * @param text Text of translation.
+     * @param text_cats Grammatical categories of translation.
+     * @param selector_cats Grammatical categories of preceding phrase this translation is suitable for.
+     */
+    template <typename IdT>
+    constexpr static_phrase(
+            const IdT& id,
+            const char* text,
+            grammar_categories text_cats=0,
+            grammar_categories selector_cats=0
+        ) noexcept
+        : id(detail::static_phrase_id(id)),
+          id_size(detail::static_phrase_length(detail::static_phrase_id(id))),
+          text(text),
+          text_size(detail::static_phrase_length(text)),
+          text_cats(text_cats),
+          selector_cats(selector_cats)
+    {}
+
+    /**
+     * @brief Get ID.
+     * @return View of ID.
+     */
+    string_view id_view() const noexcept
+    {
+        return string_view(id,id_size);
+    }
+
+    /**
+     * @brief Get text.
+     * @return View of text.
+     */
+    string_view text_view() const noexcept
+    {
+        return string_view(text,text_size);
+    }
+
+    const char* id;
+    size_t id_size;
+    const char* text;
+    size_t text_size;
+    grammar_categories text_cats;
+    grammar_categories selector_cats;
+};
+
+/**
+ * @brief Compile-time table of phrases sorted by ID.
+ *
+ * Use make_static_phrases() to construct the table.
+ */
+template <size_t N>
+struct static_phrases
+{
+    constexpr static size_t size() noexcept
+    {
+        return N;
+    }
+
+    static_phrase items[N];
+};
+
+namespace detail
+{
+
+/**
+ * @brief Compare IDs of static phrases at compile time.
+ */
+constexpr inline int compare_static_phrase_ids(const static_phrase& left, const static_phrase& right) noexcept
+{
+    auto size=(std::min)(left.id_size,right.id_size);
+    for (size_t i=0;i<size;i++)
+    {
+        auto l=static_cast<unsigned char>(left.id[i]);
+        auto r=static_cast<unsigned char>(right.id[i]);
+        if (l!=r)
+        {
+            return l<r ? -1 : 1;
+        }
+    }
+    if (left.id_size==right.id_size)
+    {
+        return 0;
+    }
+    return left.id_size<right.id_size ? -1 : 1;
+}
+
+}
+
+/**
+ * @brief Make compile-time table of phrases.
+ * @param phrases Phrases in arbitrary order of IDs.
+ * @return Table of phrases sorted by IDs.
+ *
+ * Sorting is stable, so the order of translations of the same ID is kept.
+ */
+template <size_t N>
+constexpr static_phrases<N> make_static_phrases(const static_phrase (&phrases)[N]) noexcept
+{
+    static_phrases<N> result{};
+    for (size_t i=0;i<N;i++)
+    {
+        size_t j=i;
+        for (;j>0 && detail::compare_static_phrase_ids(phrases[i],result.items[j-1])<0;--j)
+        {
+            result.items[j]=result.items[j-1];
+        }
+        result.items[j]=phrases[i];
+    }
+    return result;
+}
+
+/**
+ * @brief Translator that uses compile-time table of phrases.
+ *
+ * The translator does not allocate memory and can be constant-initialized, so it is suitable for built-in locales.
+ * Translations are looked up with binary search in the table. Selection of translation for grammatical categories
+ * is the same as in phrase_translator. Translated phrases refer to the text in the table and are never copied.
+ *
+ * @code
+ * constexpr static static_phrase phrases[]={
+ *      {"value","значение",grammar_categories_bits(grammar_ru::sredny_rod),grammar_categories_bits(grammar_ru::sredny_rod)},
+ *      {gte,"должен быть больше или равен",grammar_categories_bits(grammar_ru::datelny_padezh)}
+ * };
+ * constexpr static auto table=make_static_phrases(phrases);
+ * static const static_translator tr{table};
+ * @endcode
+ */
+class static_translator : public translator
+{
+    public:
+
+        /**
+         * @brief Constructor.
+         * @param phrases Table of phrases, it must outlive the translator.
+         */
+        template <size_t N>
+        constexpr static_translator(const static_phrases<N>& phrases) noexcept
+            : _phrases(phrases.items),
+              _size(N)
+        {}
+
+        /**
+         * @brief Translate a string.
+         * @param id String id.
+         * @param cats Grammar categories to look for.
+         * @return Translated string or id if such string not found.
+         */
+        virtual translation_result translate(const std::string& id, grammar_categories cats=0) const override
+        {
+            return find(string_view(id.data(),id.size()),cats);
+        }
+
+        /**
+         * @brief Translate a string given as string view.
+         * @param id String id.
+         * @param cats Grammar categories to look for.
+         * @return Phrase referring to translated string in the table or copy of id if such string not found.
+         */
+        virtual translation_result find(string_view id, grammar_categories cats=0) const override
+        {
+            auto end=_phrases+_size;
+            auto it=std::lower_bound(_phrases,end,id,
+                                     [](const static_phrase& phrase, const string_view& id)
+                                     {
+                                        return phrase.id_view()<id;
+                                     }
+                                );
+            if (it==end || it->id_view()!=id)
+            {
+                return translation_result{std::string(id.data(),id.size()),false};
+            }
+
+            // find element with max number of matching categories
+            auto max_el=it;
+            if (cats!=0)
+            {
+                auto max_count=count_grammar_categories(it->selector_cats,cats);
+                for (auto next=it+1;next!=end && next->id_view()==id;++next)
+                {
+                    auto count=count_grammar_categories(next->selector_cats,cats);
+                    if (count>max_count)
+                    {
+                        max_count=count;
+                        max_el=next;
+                    }
+                }
+            }
+            return translation_result{concrete_phrase::ref(max_el->text_view(),max_el->text_cats),true};
+        }
+
+        /**
+         * @brief Get number of phrases in the table.
+         * @return Number of phrases.
+         */
+        size_t size() const noexcept
+        {
+            return _size;
+        }
+
+        /**
+         * @brief Get the first phrase of the table.
+         * @return Pointer to the first phrase.
+         */
+        const static_phrase* begin() const noexcept
+        {
+            return _phrases;
+        }
+
+        /**
+         * @brief Get the end of the table.
+         * @return Pointer past the last phrase.
+         */
+        const static_phrase* end() const noexcept
+        {
+            return _phrases+_size;
+        }
+
+    private:
+
+        const static_phrase* _phrases;
+        size_t _size;
+};
+
+//-------------------------------------------------------------
+
+/**
+ * @brief Make phrase_translator with the same translations as static translator.
+ * @param tr Static translator.
+ * @return Phrase translator.
+ *
+ * Phrases of the phrase translator refer to the text of the table of the static translator.
+ */
+inline phrase_translator make_phrase_translator(const static_translator& tr)
+{
+    phrase_translator::container_type phrases;
+    for (auto&& it:tr)
+    {
+        phrases[std::string(it.id,it.id_size)].emplace_back(
+                    concrete_phrase::ref(it.text_view(),it.text_cats),
+                    it.selector_cats
+                );
+    }
+    return phrase_translator(std::move(phrases));
+}
+
+//-------------------------------------------------------------
+
+HATN_VALIDATOR_NAMESPACE_END
+
+#endif // HATN_VALIDATOR_STATIC_TRANSLATOR_HPP
@@ -32,6 +32,8 @@ Distributed under the Boost Software License, Version 1.0.
 #include <hatn/validator/reporting/translator_repository.hpp>
 #include <hatn/validator/reporting/aggregation_strings.hpp>
 #include <hatn/validator/utils/to_string.hpp>
+#include <hatn/validator/utils/enable_to_string.hpp>
+#include <hatn/validator/utils/string_view.hpp>
 
 HATN_VALIDATOR_NAMESPACE_BEGIN
 
@@ -65,6 +67,92 @@ struct strings_helper_t<
 template <typename T>
 constexpr strings_helper_t<T> strings_helper_inst{};
 
+/**
+ * @brief Check if ID has text that is a compile-time constant: operator's description or property's name.
+ */
+template <typename T, typename =void>
+struct static_phrase_text
+{
+    constexpr static const bool value=false;
+};
+
+/**
+ * @brief Text of ID that is string convertible using static description, e.g. text of operator.
+ */
+template <typename T>
+struct static_phrase_text<T,
+            std::enable_if_t<std::is_base_of<enable_to_string<T>,T>::value>
+        >
+{
+    constexpr static const bool value=true;
+
+    static string_view text() noexcept
+    {
+        return string_view(T::description);
+    }
+};
+
+/**
+ * @brief Text of property that has static name.
+ */
+template <typename T>
+struct static_phrase_text<T,
+            std::enable_if_t<
+                hana::is_a<property_tag,T>
+                &&
+                std::is_same<decltype(T::name()),const char*>::value
+            >
+        >
+{
+    constexpr static const bool value=true;
+
+    static string_view text() noexcept
+    {
+        return string_view(T::name());
+    }
+};
+
+/**
+ * @brief Convert ID to string and translate it.
+ */
+template <typename TranslatorT, typename T, typename =hana::when<true>>
+struct translate_id_t
+{
+    template <typename T1>
+    concrete_phrase operator() (const TranslatorT& translator, const T1& id, grammar_categories grammar_cats) const
+    {
+        return translator(to_string(id),grammar_cats);
+    }
+};
+
+/**
+ * @brief Use static text of ID as is when no translation is needed.
+ *
+ * The phrase refers to compile-time constant text of the ID, so the text is neither converted to string nor copied.
+ */
+template <typename TranslatorT, typename T>
+struct translate_id_t<TranslatorT,T,
+            hana::when<
+                std::is_same<std::decay_t<TranslatorT>,no_translator_t>::value
+                &&
+                static_phrase_text<T>::value
+            >
+        >
+{
+    template <typename T1>
+    concrete_phrase operator() (const TranslatorT&, const T1&, grammar_categories) const
+    {
+        return concrete_phrase::ref(static_phrase_text<T>::text());
+    }
+};
+
+template <typename TranslatorT, typename T>
+concrete_phrase translate_id(const TranslatorT& translator, const T& id, grammar_categories grammar_cats)
+{
+    using type=std::decay_t<decltype(unwrap_object(id))>;
+    return translate_id_t<std::decay_t<TranslatorT>,type>{}(translator,id,grammar_cats);
+}
+
 template <typename TranslatorT, typename T>
 auto strings_helper(TranslatorT&& translator, T&& val, grammar_categories grammar_cats) -> decltype(auto)
 {
@@ -116,6 +204,9 @@ struct strings
      * @brief Convert ID to string and then translate it.
      * @param id ID that must be converted to string.
      * @return ID converted to string and then translated.
+     *
+     * If no translation is needed and ID is an operator or a property then the returned phrase refers to
+     * compile-time constant text of the ID.
      */
     template <typename T>
     concrete_phrase operator() (const T& id, grammar_categories grammar_cats=0
@@ -127,7 +218,7 @@ struct strings
                                     ,void*> =nullptr
                                 ) const
     {
-        return _translator(to_string(id),grammar_cats);
+        return detail::translate_id(_translator,id,grammar_cats);
     }
 
     /**
@@ -22,6 +22,7 @@ Distributed under the Boost Software License, Version 1.0.
 #include <string>
 
 #include <hatn/validator/config.hpp>
+#include <hatn/validator/utils/string_view.hpp>
 #include <hatn/validator/reporting/concrete_phrase.hpp>
 
 HATN_VALIDATOR_NAMESPACE_BEGIN
@@ -91,6 +92,20 @@ class translator
             return translation_result{id,false};
         }
 
+        /**
+         * @brief Translate a string given as string view.
+         * @param id String.
+         * @param cats Grammar categories to look for.
+         * @return Translation result.
+         *
+         * Can be overriden in derived class to look for translations without constructing std::string from id.
+         * Default implementation forwards id to translate().
+         */
+        virtual translation_result find(string_view id, grammar_categories cats=0) const
+        {
+            return translate(std::string(id.data(),id.size()),cats);
+        }
+
         /**
          * @brief Bypass concrete phrase as is.
          * @param id Concrete phrase.
@@ -112,6 +127,28 @@ class translator
             return translate(id,cats);
         }
 
+        /**
+         * @brief Translate a string given as string view.
+         * @param id String ID.
+         * @param cats Grammar categories to look for.
+         * @return Translation result.
+         */
+        concrete_phrase operator() (string_view id, grammar_categories cats=0) const
+        {
+            return find(id,cats);
+        }
+
+        /**
+         * @brief Translate a null-terminated string.
+         * @param id String ID.
+         * @param cats Grammar categories to look for.
+         * @return Translation result.
+         */
+        concrete_phrase operator() (const char* id, grammar_categories cats=0) const
+        {
+            return find(string_view(id),cats);
+        }
+
         /**
          * @brief Bypass concrete phrase as is.
          * @param id Concrete phrase.
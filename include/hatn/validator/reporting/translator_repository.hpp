@@ -24,8 +24,11 @@ Distributed under the Boost Software License, Version 1.0.
 #include <set>
 #include <map>
 #include <memory>
+#include <atomic>
+#include <functional>
 
 #include <hatn/validator/config.hpp>
+#include <hatn/validator/utils/string_view.hpp>
 #include <hatn/validator/reporting/translator.hpp>
 
 HATN_VALIDATOR_NAMESPACE_BEGIN
@@ -52,6 +55,8 @@ HATN_VALIDATOR_NAMESPACE_BEGIN
 
 @endcode
 
+ * Each modification of the repository increments its revision, see translator_repository::revision().
+ * Caches of objects that depend on translators of the repository can use the revision for invalidation.
  */
 class translator_repository
 {
@@ -66,7 +71,8 @@ class translator_repository
                 std::shared_ptr<translator> default_translator,
                 std::map<std::string,std::shared_ptr<translator>> translators
             ) : _default_translator(std::move(default_translator)),
-                _translators(std::move(translators))
+                _translators(translators.begin(),translators.end()),
+                _revision(0)
         {}
 
         /**
@@ -75,7 +81,8 @@ class translator_repository
          */
         translator_repository(
                 std::shared_ptr<translator> default_translator
-            ) : _default_translator(std::move(default_translator))
+            ) : _default_translator(std::move(default_translator)),
+                _revision(0)
         {}
 
         /**
@@ -85,16 +92,45 @@ class translator_repository
         translator_repository(
                 std::map<std::string,std::shared_ptr<translator>> translators
             ) : _default_translator(std::make_shared<translator>()),
-                _translators(std::move(translators))
+                _translators(translators.begin(),translators.end()),
+                _revision(0)
         {}
 
         /**
          * @brief Default consturctor.
          */
         translator_repository(
-            ) : _default_translator(std::make_shared<translator>())
+            ) : _default_translator(std::make_shared<translator>()),
+                _revision(0)
+        {}
+
+        /**
+         * @brief Copy constructor.
+         * @param other Other repository.
+         */
+        translator_repository(
+                const translator_repository& other
+            ) : _default_translator(other._default_translator),
+                _translators(other._translators),
+                _revision(other.revision())
         {}
 
+        /**
+         * @brief Copy assignment operator.
+         * @param other Other repository.
+         * @return Reference to this repository.
+         */
+        translator_repository& operator= (const translator_repository& other)
+        {
+            if (this!=&other)
+            {
+                _default_translator=other._default_translator;
+                _translators=other._translators;
+                touch();
+            }
+            return *this;
+        }
+
         /**
          * @brief Add translator to repository.
          * @param tr Translator.
@@ -109,18 +145,19 @@ class translator_repository
             {
                 _translators[it]=tr;
             }
+            touch();
         }
 
         /**
          * @brief Find translator for locale
-         * @param loc Locale name, examples: "en_US.UTF-8", "en_US", "en". Default is name of global locale.
+         * @param loc Locale name, examples: "en_US.UTF-8", "en_US", "en".
          * @param Translator suitable of this locale.
          *
          * First, it tries to find the most specific name of the locale.
-         * The the name is repeatedly truncated down to the name of language only.
+         * The the name is repeatedly truncated down to the name of language only, the name is not copied while truncating.
          * If still no translator is found then the default translator is returned.
          */
-        std::shared_ptr<translator> find_translator(std::string loc=std::locale().name()) const
+        std::shared_ptr<translator> find_translator(string_view loc) const
         {
             size_t i=0;
             while(!loc.empty() && i<3)
@@ -130,12 +167,21 @@ class translator_repository
                 {
                     return it->second;
                 }
-                std::string delimiter=(i++==0)?".":"_";
+                auto delimiter=(i++==0)?'.':'_';
                 loc=loc.substr(0,loc.find(delimiter));
             }
             return _default_translator;
         }
 
+        /**
+         * @brief Find translator for name of global locale.
+         * @param Translator suitable of global locale.
+         */
+        std::shared_ptr<translator> find_translator() const
+        {
+            return find_translator(std::locale().name());
+        }
+
         /**
          * @brief Set default translator.
          * @param default_translator Default translator.
@@ -143,6 +189,7 @@ class translator_repository
         void set_default_translator(std::shared_ptr<translator> default_translator) noexcept
         {
             _default_translator=std::move(default_translator);
+            touch();
         }
 
         /**
@@ -160,12 +207,28 @@ class translator_repository
         void clear() noexcept
         {
             _translators.clear();
+            touch();
+        }
+
+        /**
+         * @brief Get revision of the repository.
+         * @return Revision that is incremented each time the repository is modified.
+         */
+        size_t revision() const noexcept
+        {
+            return _revision.load(std::memory_order_acquire);
         }
 
     private:
 
+        void touch() noexcept
+        {
+            _revision.fetch_add(1,std::memory_order_acq_rel);
+        }
+
         std::shared_ptr<translator> _default_translator;
-        std::map<std::string,std::shared_ptr<translator>> _translators;
+        std::map<std::string,std::shared_ptr<translator>,std::less<>> _translators;
+        std::atomic<size_t> _revision;
 };
 
 //-------------------------------------------------------------
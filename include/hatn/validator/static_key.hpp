@@ -0,0 +1,250 @@
+/**
+@copyright Evgeny Sidorov 2020
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+*/
+
+/****************************************************************************/
+
+/** @file validator/static_key.hpp
+*
+*  Defines compile-time string keys of members.
+*
+*/
+
+/****************************************************************************/
+
+#ifndef HATN_VALIDATOR_STATIC_KEY_HPP
+#define HATN_VALIDATOR_STATIC_KEY_HPP
+
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
+#include <boost/hana/string.hpp>
+
+#include <hatn/validator/config.hpp>
+#include <hatn/validator/utils/string_view.hpp>
+#include <hatn/validator/utils/string_hash.hpp>
+#include <hatn/validator/utils/adjust_storable_ignore.hpp>
+
+HATN_VALIDATOR_NAMESPACE_BEGIN
+
+//-------------------------------------------------------------
+
+template <char ... Chars>
+class static_key;
+
+namespace detail
+{
+
+template <typename T>
+struct is_static_key : public std::false_type
+{
+};
+template <char ... Chars>
+struct is_static_key<static_key<Chars...>> : public std::true_type
+{
+};
+
+template <typename T>
+using enable_if_static_key_comparable_t=std::enable_if_t<
+        std::is_convertible<const T&,string_view>::value
+        &&
+        !is_static_key<std::decay_t<T>>::value
+    >;
+
+}
+
+/**
+ * @brief Key of member whose string is carried in the type.
+ *
+ * Key is an empty object, so members with static keys are constructed without allocations
+ * and can be constexpr. Paths of members with different static keys have different types,
+ * so comparison of such members is resolved at compile time.
+ * Static key is converted to reference to std::string that is created only once for each key,
+ * and hash of the key is precomputed at compile time, see key_hash.
+ */
+template <char ... Chars>
+class static_key : public adjust_storable_ignore
+{
+    public:
+
+        constexpr static const size_t length=sizeof...(Chars);
+        constexpr static const char value[sizeof...(Chars)+1]={Chars...,'\0'};
+        constexpr static const size_t hash_value=static_cast<size_t>(string_hash(value,length));
+
+        /**
+         * @brief Get size of the key.
+         * @return Number of characters in the key.
+         */
+        constexpr static size_t size() noexcept
+        {
+            return length;
+        }
+
+        /**
+         * @brief Get key as null-terminated string.
+         * @return Pointer to characters of the key.
+         */
+        constexpr static const char* c_str() noexcept
+        {
+            return value;
+        }
+
+        /**
+         * @brief Get key as string view.
+         * @return View of the key.
+         */
+        constexpr static string_view view() noexcept
+        {
+            return string_view(value,length);
+        }
+
+        /**
+         * @brief Get key as std::string.
+         * @return Reference to string that is constructed at the first call.
+         */
+        static const std::string& str()
+        {
+            static const std::string s(value,length);
+            return s;
+        }
+
+        /**
+         * @brief Get precomputed hash of the key.
+         * @return Hash of the key.
+         */
+        constexpr static size_t hash() noexcept
+        {
+            return hash_value;
+        }
+
+        constexpr operator string_view() const noexcept
+        {
+            return view();
+        }
+
+        operator const std::string&() const
+        {
+            return str();
+        }
+
+        constexpr bool operator == (const static_key&) const noexcept
+        {
+            return true;
+        }
+        constexpr bool operator != (const static_key&) const noexcept
+        {
+            return false;
+        }
+        constexpr bool operator < (const static_key&) const noexcept
+        {
+            return false;
+        }
+
+        template <typename T, typename =detail::enable_if_static_key_comparable_t<T>>
+        friend bool operator == (const static_key& left, const T& right) noexcept
+        {
+            return left.view()==string_view(right);
+        }
+        template <typename T, typename =detail::enable_if_static_key_comparable_t<T>>
+        friend bool operator == (const T& left, const static_key& right) noexcept
+        {
+            return string_view(left)==right.view();
+        }
+        template <typename T, typename =detail::enable_if_static_key_comparable_t<T>>
+        friend bool operator != (const static_key& left, const T& right) noexcept
+        {
+            return left.view()!=string_view(right);
+        }
+        template <typename T, typename =detail::enable_if_static_key_comparable_t<T>>
+        friend bool operator != (const T& left, const static_key& right) noexcept
+        {
+            return string_view(left)!=right.view();
+        }
+        template <typename T, typename =detail::enable_if_static_key_comparable_t<T>>
+        friend bool operator < (const static_key& left, const T& right) noexcept
+        {
+            return left.view()<string_view(right);
+        }
+        template <typename T, typename =detail::enable_if_static_key_comparable_t<T>>
+        friend bool operator < (const T& left, const static_key& right) noexcept
+        {
+            return string_view(left)<right.view();
+        }
+};
+
+#if __cplusplus < 201703L
+template <char ... Chars>
+constexpr const size_t static_key<Chars...>::length;
+template <char ... Chars>
+constexpr const char static_key<Chars...>::value[sizeof...(Chars)+1];
+template <char ... Chars>
+constexpr const size_t static_key<Chars...>::hash_value;
+#endif
+
+/**
+ * @brief Make static key from compile-time string.
+ * @param str Compile-time string, e.g. BOOST_HANA_STRING("field").
+ * @return Static key.
+ */
+template <char ... Chars>
+constexpr static_key<Chars...> make_static_key(hana::string<Chars...>) noexcept
+{
+    return static_key<Chars...>{};
+}
+
+/**
+ * @brief Transparent hasher of keys.
+ *
+ * Hash of static keys is precomputed at compile time, hash of other strings is calculated with the same algorithm,
+ * so the hasher can be used in unordered containers with heterogeneous lookup.
+ */
+struct key_hash
+{
+    using is_transparent=void;
+
+    template <char ... Chars>
+    constexpr size_t operator () (const static_key<Chars...>&) const noexcept
+    {
+        return static_key<Chars...>::hash_value;
+    }
+
+    size_t operator () (string_view str) const noexcept
+    {
+        return static_cast<size_t>(string_hash(str));
+    }
+};
+
+#ifdef BOOST_HANA_CONFIG_ENABLE_STRING_UDL
+namespace literals
+{
+
+/**
+ * @brief Literal operator for static keys, e.g. _["field"_key].
+ *
+ * Uses GNU extension of string literal operator templates, see BOOST_HANA_CONFIG_ENABLE_STRING_UDL.
+ */
+template <typename CharT, CharT ... Chars>
+constexpr static_key<Chars...> operator "" _key() noexcept
+{
+    static_assert(std::is_same<CharT,char>::value,"Static keys can be made only of char literals");
+    return static_key<Chars...>{};
+}
+
+}
+#endif
+
+//-------------------------------------------------------------
+
+HATN_VALIDATOR_NAMESPACE_END
+
+/**
+ * @brief Make static key from string literal, e.g. _[HATN_KEY("field")].
+ */
+#define HATN_KEY(str) HATN_VALIDATOR_NAMESPACE::make_static_key(BOOST_HANA_STRING(str))
+
+#endif // HATN_VALIDATOR_STATIC_KEY_HPP
@@ -36,7 +36,8 @@ class status
         {
             success,
             fail,
-            ignore
+            ignore,
+            exhausted
         };
 
         /**
@@ -64,7 +65,7 @@ class status
          */
         operator bool () const noexcept
         {
-            return _code!=code::fail;
+            return _code!=code::fail && _code!=code::exhausted;
         }
 
         /**
@@ -97,7 +98,7 @@ class status
 
         bool fail() const noexcept
         {
-            return _code==code::fail;
+            return _code==code::fail || _code==code::exhausted;
         }
 
         bool ignore() const noexcept
@@ -105,6 +106,15 @@ class status
             return _code==code::ignore;
         }
 
+        /**
+         * @brief Check if validation was stopped because validation budget was exhausted.
+         * @return Boolean result.
+         */
+        bool exhausted() const noexcept
+        {
+            return _code==code::exhausted;
+        }
+
     private:
 
         code _code;
@@ -0,0 +1,65 @@
+/**
+@copyright Evgeny Sidorov 2020
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+*/
+
+/****************************************************************************/
+
+/** @file validator/utils/string_hash.hpp
+*
+*  Defines FNV-1a hash of strings.
+*
+*/
+
+/****************************************************************************/
+
+#ifndef HATN_VALIDATOR_STRING_HASH_HPP
+#define HATN_VALIDATOR_STRING_HASH_HPP
+
+#include <cstdint>
+#include <cstddef>
+
+#include <hatn/validator/config.hpp>
+#include <hatn/validator/utils/string_view.hpp>
+
+HATN_VALIDATOR_NAMESPACE_BEGIN
+
+//-------------------------------------------------------------
+
+/**
+ * @brief Calculate 64-bit FNV-1a hash of a string.
+ * @param data Pointer to string.
+ * @param size Size of string.
+ * @return Hash of the string.
+ *
+ * Hash can be calculated at compile time.
+ */
+constexpr uint64_t string_hash(const char* data, size_t size) noexcept
+{
+    uint64_t hash=14695981039346656037ull;
+    for (size_t i=0;i<size;i++)
+    {
+        hash^=static_cast<unsigned char>(data[i]);
+        hash*=1099511628211ull;
+    }
+    return hash;
+}
+
+/**
+ * @brief Calculate 64-bit FNV-1a hash of a string.
+ * @param str String.
+ * @return Hash of the string.
+ */
+inline uint64_t string_hash(string_view str) noexcept
+{
+    return string_hash(str.data(),str.size());
+}
+
+//-------------------------------------------------------------
+
+HATN_VALIDATOR_NAMESPACE_END
+
+#endif // HATN_VALIDATOR_STRING_HASH_HPP
@@ -0,0 +1,160 @@
+/**
+@copyright Evgeny Sidorov 2020
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+*/
+
+/****************************************************************************/
+
+/** @file validator/utils/value_ordering.hpp
+*
+*  Defines helpers for comparison operators of views of dynamically typed values.
+*
+*/
+
+/****************************************************************************/
+
+#ifndef HATN_VALIDATOR_VALUE_ORDERING_HPP
+#define HATN_VALIDATOR_VALUE_ORDERING_HPP
+
+#include <cmath>
+#include <utility>
+#include <type_traits>
+
+#include <hatn/validator/config.hpp>
+#include <hatn/validator/utils/string_view.hpp>
+#include <hatn/validator/utils/safe_compare.hpp>
+
+HATN_VALIDATOR_NAMESPACE_BEGIN
+
+//-------------------------------------------------------------
+
+/**
+ * @brief Result of comparison of dynamically typed value with other value.
+ */
+enum class value_ordering : int
+{
+    less,
+    equal,
+    greater,
+    unordered //!< Values of incompatible types
+};
+
+namespace detail
+{
+
+template <typename T>
+std::enable_if_t<std::is_floating_point<T>::value,bool> is_nan_value(const T& val) noexcept
+{
+    return std::isnan(val);
+}
+
+template <typename T>
+std::enable_if_t<!std::is_floating_point<T>::value,bool> is_nan_value(const T&) noexcept
+{
+    return false;
+}
+
+}
+
+/**
+ * @brief Compare two values using safe comparison of numbers.
+ * @param left Left value.
+ * @param right Right value.
+ * @return Ordering of left value relative to right value, NaN is unordered with any value.
+ */
+template <typename LeftT, typename RightT>
+value_ordering compare_value_ordering(const LeftT& left, const RightT& right) noexcept
+{
+    if (detail::is_nan_value(left) || detail::is_nan_value(right))
+    {
+        return value_ordering::unordered;
+    }
+    if (safe_compare_less(left,right))
+    {
+        return value_ordering::less;
+    }
+    if (safe_compare_equal(left,right))
+    {
+        return value_ordering::equal;
+    }
+    return value_ordering::greater;
+}
+
+/**
+ * @brief Compare two strings.
+ * @param left Left string.
+ * @param right Right string.
+ * @return Ordering of left string relative to right string.
+ */
+inline value_ordering compare_string_ordering(string_view left, string_view right) noexcept
+{
+    auto ret=left.compare(right);
+    return ret<0 ? value_ordering::less : (ret==0 ? value_ordering::equal : value_ordering::greater);
+}
+
+/**
+ * @brief Base template for views of dynamically typed values that implements comparison operators.
+ *
+ * DerivedT must implement method compare(other) returning value_ordering for each type it can be compared with.
+ * Operators are defined only for those types. Values of incompatible types are unordered, so all comparisons of them fail except for "!=".
+ * If compare() is private then enable_value_ordering<DerivedT> must be a friend of DerivedT.
+ */
+template <typename DerivedT>
+class enable_value_ordering
+{
+    public:
+
+        template <typename T, typename D=DerivedT>
+        auto operator == (const T& other) const noexcept -> decltype(std::declval<const D&>().compare(other),bool())
+        {
+            return derived().compare(other)==value_ordering::equal;
+        }
+
+        template <typename T, typename D=DerivedT>
+        auto operator != (const T& other) const noexcept -> decltype(std::declval<const D&>().compare(other),bool())
+        {
+            return derived().compare(other)!=value_ordering::equal;
+        }
+
+        template <typename T, typename D=DerivedT>
+        auto operator < (const T& other) const noexcept -> decltype(std::declval<const D&>().compare(other),bool())
+        {
+            return derived().compare(other)==value_ordering::less;
+        }
+
+        template <typename T, typename D=DerivedT>
+        auto operator <= (const T& other) const noexcept -> decltype(std::declval<const D&>().compare(other),bool())
+        {
+            auto ord=derived().compare(other);
+            return ord==value_ordering::less || ord==value_ordering::equal;
+        }
+
+        template <typename T, typename D=DerivedT>
+        auto operator > (const T& other) const noexcept -> decltype(std::declval<const D&>().compare(other),bool())
+        {
+            return derived().compare(other)==value_ordering::greater;
+        }
+
+        template <typename T, typename D=DerivedT>
+        auto operator >= (const T& other) const noexcept -> decltype(std::declval<const D&>().compare(other),bool())
+        {
+            auto ord=derived().compare(other);
+            return ord==value_ordering::greater || ord==value_ordering::equal;
+        }
+
+    private:
+
+        const DerivedT& derived() const noexcept
+        {
+            return static_cast<const DerivedT&>(*this);
+        }
+};
+
+//-------------------------------------------------------------
+
+HATN_VALIDATOR_NAMESPACE_END
+
+#endif // HATN_VALIDATOR_VALUE_ORDERING_HPP
@@ -0,0 +1,294 @@
+/**
+@copyright Evgeny Sidorov 2020
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+*/
+
+/****************************************************************************/
+
+/** @file validator/validation_budget.hpp
+*
+*  Defines "validation_budget" that limits amount of work done by a single validation.
+*
+*/
+
+/****************************************************************************/
+
+#ifndef HATN_VALIDATOR_VALIDATION_BUDGET_HPP
+#define HATN_VALIDATOR_VALIDATION_BUDGET_HPP
+
+#include <limits>
+#include <chrono>
+
+#include <hatn/validator/config.hpp>
+#include <hatn/validator/status.hpp>
+#include <hatn/validator/adapters/adapter_traits_wrapper.hpp>
+
+HATN_VALIDATOR_NAMESPACE_BEGIN
+
+//-------------------------------------------------------------
+
+/**
+ * @brief Budget of validation.
+ *
+ * Budget limits the number of operator invocations, the number of visited elements of containers and trees
+ * and the time of validation. When any of the limits is reached the budget is exhausted and validation stops
+ * with status::code::exhausted. By default the budget is unlimited.
+ *
+ * The clock is checked only on every deadline_check_interval-th step, thus validation can slightly exceed the deadline.
+ *
+ * Budget is not thread-safe, use a separate budget for each validation.
+ */
+class validation_budget
+{
+    public:
+
+        using clock=std::chrono::steady_clock;
+
+        /**
+         * @brief Reason of budget exhaustion.
+         */
+        enum class reason : int
+        {
+            none,
+            operations,
+            elements,
+            deadline
+        };
+
+        constexpr static const size_t unlimited=(std::numeric_limits<size_t>::max)();
+        constexpr static const size_t deadline_check_interval=64;
+
+        /**
+         * @brief Set max number of operator invocations.
+         * @param max_operations Limit.
+         * @return Reference to this budget.
+         */
+        validation_budget& set_max_operations(size_t max_operations) noexcept
+        {
+            _max_operations=max_operations;
+            return *this;
+        }
+
+        /**
+         * @brief Set max number of visited elements of containers and nodes of trees.
+         * @param max_elements Limit.
+         * @return Reference to this budget.
+         */
+        validation_budget& set_max_elements(size_t max_elements) noexcept
+        {
+            _max_elements=max_elements;
+            return *this;
+        }
+
+        /**
+         * @brief Set deadline of validation.
+         * @param deadline Time point when validation must be stopped.
+         * @return Reference to this budget.
+         */
+        validation_budget& set_deadline(clock::time_point deadline) noexcept
+        {
+            _deadline=deadline;
+            _has_deadline=true;
+            _deadline_countdown=0;
+            return *this;
+        }
+
+        /**
+         * @brief Set deadline of validation relative to current time.
+         * @param timeout Max duration of validation.
+         * @return Reference to this budget.
+         */
+        template <typename RepT, typename PeriodT>
+        validation_budget& set_timeout(const std::chrono::duration<RepT,PeriodT>& timeout)
+        {
+            return set_deadline(clock::now()+std::chrono::duration_cast<clock::duration>(timeout));
+        }
+
+        /**
+         * @brief Consume one operator invocation.
+         * @return false if the budget is exhausted.
+         */
+        bool consume_operation() noexcept
+        {
+            if (exhausted())
+            {
+                return false;
+            }
+            if (++_operations>_max_operations)
+            {
+                _reason=reason::operations;
+                return false;
+            }
+            return check_deadline();
+        }
+
+        /**
+         * @brief Consume one visited element.
+         * @return false if the budget is exhausted.
+         */
+        bool consume_element() noexcept
+        {
+            if (exhausted())
+            {
+                return false;
+            }
+            if (++_elements>_max_elements)
+            {
+                _reason=reason::elements;
+                return false;
+            }
+            return check_deadline();
+        }
+
+        /**
+         * @brief Check if the budget is exhausted.
+         * @return Boolean result.
+         */
+        bool exhausted() const noexcept
+        {
+            return _reason!=reason::none;
+        }
+
+        /**
+         * @brief Get reason of budget exhaustion.
+         * @return Reason or reason::none if the budget is not exhausted.
+         */
+        reason exhausted_reason() const noexcept
+        {
+            return _reason;
+        }
+
+        /**
+         * @brief Get description of budget exhaustion to use in validation reports.
+         * @return Description.
+         */
+        const char* description() const noexcept
+        {
+            switch (_reason)
+            {
+                case reason::operations:
+                    return "validation budget exhausted: too many operations";
+                case reason::elements:
+                    return "validation budget exhausted: too many elements";
+                case reason::deadline:
+                    return "validation budget exhausted: deadline expired";
+                case reason::none:
+                    break;
+            }
+            return "";
+        }
+
+        /**
+         * @brief Get number of consumed operator invocations.
+         * @return Number of operations.
+         */
+        size_t operations() const noexcept
+        {
+            return _operations;
+        }
+
+        /**
+         * @brief Get number of consumed elements.
+         * @return Number of elements.
+         */
+        size_t elements() const noexcept
+        {
+            return _elements;
+        }
+
+        /**
+         * @brief Reset consumed counters keeping the limits.
+         *
+         * Note that deadline is absolute, so it must be set again before next validation if timeout is used.
+         */
+        void reset() noexcept
+        {
+            _operations=0;
+            _elements=0;
+            _deadline_countdown=0;
+            _reason=reason::none;
+        }
+
+    private:
+
+        bool check_deadline() noexcept
+        {
+            if (!_has_deadline)
+            {
+                return true;
+            }
+            if (_deadline_countdown!=0)
+            {
+                --_deadline_countdown;
+                return true;
+            }
+            _deadline_countdown=deadline_check_interval-1;
+            if (clock::now()>=_deadline)
+            {
+                _reason=reason::deadline;
+                return false;
+            }
+            return true;
+        }
+
+        size_t _max_operations=unlimited;
+        size_t _max_elements=unlimited;
+        clock::time_point _deadline;
+        bool _has_deadline=false;
+
+        size_t _operations=0;
+        size_t _elements=0;
+        size_t _deadline_countdown=0;
+        reason _reason=reason::none;
+};
+
+//-------------------------------------------------------------
+
+/**
+ * @brief Base tag for adapter traits that have validation budget.
+ *
+ * Such traits must have method "validation_budget& budget()".
+ */
+struct budget_adapter_tag
+{
+};
+
+/**
+ * @brief Consumer of validation budget used in element aggregations.
+ *
+ * Default implementation does nothing.
+ */
+template <typename AdapterT, typename=hana::when<true>>
+struct consume_budget
+{
+    template <typename AdapterT1>
+    constexpr static bool element(AdapterT1&&) noexcept
+    {
+        return true;
+    }
+};
+
+/**
+ * @brief Consumer of validation budget for adapters with budget.
+ */
+template <typename AdapterT>
+struct consume_budget<AdapterT,
+        hana::when<
+            std::is_base_of<budget_adapter_tag,std::decay_t<decltype(traits_of(std::declval<AdapterT&>()))>>::value
+        >>
+{
+    template <typename AdapterT1>
+    static bool element(AdapterT1&& adapter) noexcept
+    {
+        return traits_of(adapter).budget().consume_element();
+    }
+};
+
+//-------------------------------------------------------------
+
+HATN_VALIDATOR_NAMESPACE_END
+
+#endif // HATN_VALIDATOR_VALIDATION_BUDGET_HPP
@@ -0,0 +1,534 @@
+/**
+@copyright Evgeny Sidorov 2020
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+*/
+
+/****************************************************************************/
+
+/** @file validator/validator_registry.hpp
+*
+*  Defines "validator_registry" of named validators that can be replaced at runtime while other threads use them.
+*
+*/
+
+/****************************************************************************/
+
+#ifndef HATN_VALIDATOR_VALIDATOR_REGISTRY_HPP
+#define HATN_VALIDATOR_VALIDATOR_REGISTRY_HPP
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <atomic>
+#include <limits>
+#include <utility>
+#include <algorithm>
+#include <functional>
+#include <unordered_map>
+
+#include <hatn/validator/config.hpp>
+#include <hatn/validator/status.hpp>
+#include <hatn/validator/static_key.hpp>
+#include <hatn/validator/utils/string_view.hpp>
+#include <hatn/validator/any_validator.hpp>
+
+HATN_VALIDATOR_NAMESPACE_BEGIN
+
+//-------------------------------------------------------------
+
+/**
+ * @brief Registry of named validators with epoch-based publication of updates.
+ *
+ * Validators are kept in immutable snapshots. Writers copy current snapshot, modify the copy
+ * and publish it with a single atomic exchange, writers are serialized with a mutex.
+ * Snapshots hold shared pointers to validators, so only the map is copied on update and unchanged validators
+ * are shared between snapshots. Validators are looked up by string_view names without constructing strings.
+ * Readers access validators via reader handles, each thread must use its own reader.
+ * A reader pins a snapshot by announcing current epoch in its own slot, so that hot path of reading consists only of
+ * atomic loads and stores and there are no read-modify-write operations and no shared counters.
+ * Replaced snapshots are retired with the epoch of replacement and destroyed by writers
+ * as soon as no reader has announced an epoch that is not newer than the retirement epoch.
+ *
+ * All readers must be destroyed before the registry.
+ *
+ * @code
+ * validator_registry<std::map<std::string,int>> registry;
+ * registry.set("tenant1",validator(_["field1"](gte,1)));
+ *
+ * // in worker thread
+ * auto reader=registry.make_reader();
+ * auto ok=reader.apply("tenant1",obj);
+ * @endcode
+ */
+template <typename ObjectT, size_t BufferSize=any_validator_default_buffer_size>
+class validator_registry
+{
+    private:
+
+        constexpr static const size_t cache_line_size=64;
+
+        struct snapshot;
+
+        struct retired_snapshot
+        {
+            snapshot* ptr;
+            uint64_t epoch;
+        };
+
+        /**
+         * Epoch slot of a reader. Slots are padded to cache line to avoid false sharing of readers' announcements.
+         */
+        struct slot
+        {
+            std::atomic<uint64_t> epoch;
+            std::atomic<bool> in_use;
+            slot* next;
+            char padding[cache_line_size];
+
+            slot() : epoch(0),in_use(true),next(nullptr)
+            {}
+        };
+
+    public:
+
+        using validator_type=any_validator<ObjectT,BufferSize>;
+        using validator_ptr=std::shared_ptr<const validator_type>;
+        using map_type=std::unordered_map<std::string,validator_ptr,key_hash,std::equal_to<>>;
+
+        class reader;
+
+        /**
+         * @brief Snapshot of validators pinned by a reader.
+         *
+         * Snapshot can not be destroyed while read_guard is alive.
+         */
+        class read_guard
+        {
+            public:
+
+                read_guard(const read_guard&)=delete;
+                read_guard& operator= (const read_guard&)=delete;
+                read_guard& operator= (read_guard&&)=delete;
+
+                /**
+                 * @brief Move constructor.
+                 * @param other Other guard.
+                 */
+                read_guard(read_guard&& other) noexcept
+                    : _reader(other._reader),
+                      _snapshot(other._snapshot)
+                {
+                    other._reader=nullptr;
+                }
+
+                /**
+                 * @brief Destructor unpins the snapshot.
+                 */
+                ~read_guard()
+                {
+                    if (_reader!=nullptr)
+                    {
+                        _reader->unpin();
+                    }
+                }
+
+                /**
+                 * @brief Find validator by name.
+                 * @param name Name of validator.
+                 * @return Pointer to validator or nullptr if not found. Pointer is valid while guard is alive.
+                 */
+                const validator_type* find(string_view name) const
+                {
+                    return _snapshot->find(name);
+                }
+
+                /**
+                 * @brief Get all validators of the snapshot.
+                 * @return Map of validators.
+                 */
+                const map_type& validators() const noexcept
+                {
+                    return _snapshot->validators;
+                }
+
+                /**
+                 * @brief Get version of the snapshot.
+                 * @return Version that is incremented on each update of the registry.
+                 */
+                uint64_t version() const noexcept
+                {
+                    return _snapshot->version;
+                }
+
+            private:
+
+                read_guard(reader* r, const snapshot* s) noexcept : _reader(r),_snapshot(s)
+                {}
+
+                reader* _reader;
+                const snapshot* _snapshot;
+
+                friend class reader;
+        };
+
+        /**
+         * @brief Handle of thread reading the registry.
+         *
+         * Reader must not be shared between threads, but it can be moved to other thread when no guards are alive.
+         * Guards of the same reader can be nested.
+         */
+        class reader
+        {
+            public:
+
+                reader(const reader&)=delete;
+                reader& operator= (const reader&)=delete;
+                reader& operator= (reader&&)=delete;
+
+                /**
+                 * @brief Move constructor.
+                 * @param other Other reader.
+                 */
+                reader(reader&& other) noexcept
+                    : _registry(other._registry),
+                      _slot(other._slot),
+                      _depth(other._depth)
+                {
+                    other._slot=nullptr;
+                }
+
+                /**
+                 * @brief Destructor releases the slot of reader so that it can be used by other readers.
+                 */
+                ~reader()
+                {
+                    if (_slot!=nullptr)
+                    {
+                        _slot->epoch.store(0,std::memory_order_release);
+                        _slot->in_use.store(false,std::memory_order_release);
+                    }
+                }
+
+                /**
+                 * @brief Pin current snapshot of validators.
+                 * @return Guard of pinned snapshot.
+                 */
+                read_guard lock()
+                {
+                    return read_guard(this,pin());
+                }
+
+                /**
+                 * @brief Validate object with named validator.
+                 * @param name Name of validator.
+                 * @param obj Object to validate.
+                 * @return Validation status, unknown validator fails validation.
+                 */
+                status apply(string_view name, const ObjectT& obj)
+                {
+                    auto guard=lock();
+                    auto v=guard.find(name);
+                    if (v==nullptr)
+                    {
+                        return status(status::code::fail);
+                    }
+                    return v->apply(obj);
+                }
+
+                /**
+                 * @brief Validate object with named validator and put text report to the destination string if validation fails.
+                 * @param name Name of validator.
+                 * @param obj Object to validate.
+                 * @param report Destination string.
+                 * @return Validation status, unknown validator fails validation.
+                 */
+                status apply(string_view name, const ObjectT& obj, std::string& report)
+                {
+                    auto guard=lock();
+                    auto v=guard.find(name);
+                    if (v==nullptr)
+                    {
+                        return status(status::code::fail);
+                    }
+                    return v->apply(obj,report);
+                }
+
+            private:
+
+                reader(const validator_registry* registry, slot* s) noexcept
+                    : _registry(registry),_slot(s),_depth(0)
+                {}
+
+                const snapshot* pin() noexcept
+                {
+                    if (_depth++==0)
+                    {
+                        // announcement must be visible to writers before the snapshot is loaded
+                        auto epoch=_registry->_epoch.load(std::memory_order_acquire);
+                        _slot->epoch.store(epoch,std::memory_order_seq_cst);
+                    }
+                    return _registry->_current.load(std::memory_order_seq_cst);
+                }
+
+                void unpin() noexcept
+                {
+                    if (--_depth==0)
+                    {
+                        _slot->epoch.store(0,std::memory_order_release);
+                    }
+                }
+
+                const validator_registry* _registry;
+                slot* _slot;
+                size_t _depth;
+
+                friend class validator_registry;
+                friend class read_guard;
+        };
+
+        /**
+         * @brief Constructor.
+         */
+        validator_registry()
+            : _current(new snapshot()),
+              _epoch(1),
+              _slots(nullptr)
+        {}
+
+        validator_registry(const validator_registry&)=delete;
+        validator_registry(validator_registry&&)=delete;
+        validator_registry& operator= (const validator_registry&)=delete;
+        validator_registry& operator= (validator_registry&&)=delete;
+
+        /**
+         * @brief Destructor.
+         */
+        ~validator_registry()
+        {
+            delete _current.load(std::memory_order_acquire);
+            for (auto&& it:_retired)
+            {
+                delete it.ptr;
+            }
+            auto s=_slots.load(std::memory_order_acquire);
+            while (s!=nullptr)
+            {
+                auto next=s->next;
+                delete s;
+                s=next;
+            }
+        }
+
+        /**
+         * @brief Make reader of the registry.
+         * @return Reader to be used in a single thread.
+         */
+        reader make_reader()
+        {
+            auto s=_slots.load(std::memory_order_acquire);
+            for (;s!=nullptr;s=s->next)
+            {
+                bool in_use=false;
+                if (!s->in_use.load(std::memory_order_relaxed)
+                    &&
+                    s->in_use.compare_exchange_strong(in_use,true,std::memory_order_acq_rel)
+                   )
+                {
+                    return reader(this,s);
+                }
+            }
+
+            s=new slot();
+            auto head=_slots.load(std::memory_order_relaxed);
+            do
+            {
+                s->next=head;
+            }
+            while (!_slots.compare_exchange_weak(head,s,std::memory_order_release,std::memory_order_relaxed));
+            return reader(this,s);
+        }
+
+        /**
+         * @brief Add or replace named validator.
+         * @param name Name of validator.
+         * @param v Validator.
+         */
+        template <typename ValidatorT>
+        void set(std::string name, ValidatorT&& v)
+        {
+            validator_ptr tmp=std::make_shared<validator_type>(std::forward<ValidatorT>(v));
+            update(
+                [&](map_type& validators)
+                {
+                    validators[std::move(name)]=std::move(tmp);
+                }
+            );
+        }
+
+        /**
+         * @brief Remove named validator.
+         * @param name Name of validator.
+         * @return True if validator was removed, false if it was not found.
+         */
+        bool erase(const std::string& name)
+        {
+            bool erased=false;
+            update(
+                [&](map_type& validators)
+                {
+                    erased=validators.erase(name)!=0;
+                }
+            );
+            return erased;
+        }
+
+        /**
+         * @brief Remove all validators.
+         */
+        void clear()
+        {
+            update(
+                [](map_type& validators)
+                {
+                    validators.clear();
+                }
+            );
+        }
+
+        /**
+         * @brief Update validators and publish them as a single new snapshot.
+         * @param handler Handler taking a copy of current validators, signature "void (map_type& validators)".
+         *
+         * The copy shares validators with current snapshot, assign new pointers to replace validators.
+         */
+        template <typename HandlerT>
+        void update(HandlerT&& handler)
+        {
+            std::lock_guard<std::mutex> lock(_write_mutex);
+
+            auto current=_current.load(std::memory_order_relaxed);
+            std::unique_ptr<snapshot> next(new snapshot(current->validators,current->version+1));
+            handler(next->validators);
+            next->build_index();
+
+            _retired.reserve(_retired.size()+1);
+            auto old=_current.exchange(next.release(),std::memory_order_seq_cst);
+            auto epoch=_epoch.fetch_add(1,std::memory_order_seq_cst);
+            _retired.push_back(retired_snapshot{old,epoch});
+
+            reclaim_unlocked();
+        }
+
+        /**
+         * @brief Destroy retired snapshots that are not used by readers anymore.
+         *
+         * Retired snapshots are reclaimed automatically on each update, use this method to release memory earlier.
+         */
+        void reclaim()
+        {
+            std::lock_guard<std::mutex> lock(_write_mutex);
+            reclaim_unlocked();
+        }
+
+        /**
+         * @brief Get number of retired snapshots still waiting for reclamation.
+         * @return Number of retired snapshots.
+         */
+        size_t retired_count() const
+        {
+            std::lock_guard<std::mutex> lock(_write_mutex);
+            return _retired.size();
+        }
+
+    private:
+
+        struct snapshot
+        {
+            map_type validators;
+            uint64_t version;
+
+            // index refers to names stored in the map, so lookups do not construct strings
+            std::unordered_map<string_view,const validator_type*,key_hash,std::equal_to<>> index;
+
+            snapshot() : version(0)
+            {}
+
+            snapshot(const map_type& validators, uint64_t version)
+                : validators(validators),version(version)
+            {}
+
+            snapshot(const snapshot&)=delete;
+            snapshot& operator= (const snapshot&)=delete;
+
+            void build_index()
+            {
+                index.reserve(validators.size());
+                for (auto&& it:validators)
+                {
+                    if (it.second)
+                    {
+                        index.emplace(string_view(it.first),it.second.get());
+                    }
+                }
+            }
+
+            const validator_type* find(string_view name) const
+            {
+                auto it=index.find(name);
+                if (it==index.end())
+                {
+                    return nullptr;
+                }
+                return it->second;
+            }
+        };
+
+        void reclaim_unlocked()
+        {
+            if (_retired.empty())
+            {
+                return;
+            }
+
+            auto min_epoch=(std::numeric_limits<uint64_t>::max)();
+            for (auto s=_slots.load(std::memory_order_acquire);s!=nullptr;s=s->next)
+            {
+                auto epoch=s->epoch.load(std::memory_order_seq_cst);
+                if (epoch!=0)
+                {
+                    min_epoch=(std::min)(min_epoch,epoch);
+                }
+            }
+
+            auto it=std::remove_if(_retired.begin(),_retired.end(),
+                [min_epoch](const retired_snapshot& retired)
+                {
+                    if (retired.epoch<min_epoch)
+                    {
+                        delete retired.ptr;
+                        return true;
+                    }
+                    return false;
+                }
+            );
+            _retired.erase(it,_retired.end());
+        }
+
+        std::atomic<snapshot*> _current;
+        std::atomic<uint64_t> _epoch;
+        std::atomic<slot*> _slots;
+
+        mutable std::mutex _write_mutex;
+        std::vector<retired_snapshot> _retired;
+};
+
+//-------------------------------------------------------------
+
+HATN_VALIDATOR_NAMESPACE_END
+
+#endif // HATN_VALIDATOR_VALIDATOR_REGISTRY_HPP
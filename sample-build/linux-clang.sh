@@ -25,6 +25,7 @@ cmake -G "Unix Makefiles" \
     -DCMAKE_INSTALL_PREFIX=$INSTALL_DIR \
     -DCMAKE_BUILD_TYPE=$BUILD_TYPE \
     -DVALIDATOR_WITH_TESTS=On \
+    -DVALIDATOR_WITH_BOOST_JSON_TESTS=On \
     -DVALIDATOR_WITH_EXAMPLES=On \
     -DVALIDATOR_WITH_FMT=On \
     $SRC_DIR
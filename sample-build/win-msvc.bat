@@ -33,6 +33,7 @@ cd %BUILD_DIR%
 cmake -A %MSVC_BUILD_ARCH% -T %MSVC_TOOLSET% ^
     -DCMAKE_INSTALL_PREFIX=%INSTALL_DIR% ^
     -DVALIDATOR_WITH_TESTS=On ^
+    -DVALIDATOR_WITH_BOOST_JSON_TESTS=On ^
     -DVALIDATOR_WITH_EXAMPLES=On ^
     %SRC_DIR%
 
@@ -33,6 +33,20 @@ SET (VALIDATOR_TEST_SOURCES
     ${VALIDATOR_TEST_SRC}/testvaluetransformer.cpp
     ${VALIDATOR_TEST_SRC}/testtree.cpp
     ${VALIDATOR_TEST_SRC}/testpointers.cpp
+    ${VALIDATOR_TEST_SRC}/testincrementalvalidator.cpp
+    ${VALIDATOR_TEST_SRC}/testcachedvalidator.cpp
+    ${VALIDATOR_TEST_SRC}/testvalidationbudget.cpp
+    ${VALIDATOR_TEST_SRC}/testjsonsaxvalidator.cpp
+    ${VALIDATOR_TEST_SRC}/testcsvrow.cpp
+    ${VALIDATOR_TEST_SRC}/testpackedrecord.cpp
+    ${VALIDATOR_TEST_SRC}/teststatickey.cpp
+    ${VALIDATOR_TEST_SRC}/testtransparentlookup.cpp
+    ${VALIDATOR_TEST_SRC}/testanyvalidator.cpp
+    ${VALIDATOR_TEST_SRC}/testvalidatorregistry.cpp
+)
+
+SET (VALIDATOR_BOOST_JSON_TEST_SOURCES
+    ${VALIDATOR_TEST_SRC}/testboostjson.cpp
 )
 
 IF (BUILD_VALIDATOR_HABR_EXAMPLES)
@@ -227,4 +227,69 @@ BOOST_AUTO_TEST_CASE(CheckAggregationAllReport)
     rep1.clear();
 }
 
+BOOST_AUTO_TEST_CASE(CheckAggregationAllSummary)
+{
+    std::map<std::string,std::vector<int>> m1={
+            {"items",{0,0,5,0,-1,20,7,30,1,2}}
+        };
+
+    std::string rep1;
+    auto ra1=make_reporting_adapter(m1,make_reporter(rep1,get_default_formatter(),aggregation_summary(10)));
+    const auto& members=ra1.traits().reporter().failed_members();
+
+    auto v1=validator(
+                _["items"][ALL](gt,0)
+            );
+    BOOST_CHECK(!v1.apply(ra1));
+    BOOST_CHECK_EQUAL(rep1,"each element of items must be greater than 0 (elements [0..1, 3..4])");
+    BOOST_REQUIRE(!members.empty());
+    BOOST_CHECK_EQUAL(members.size(),1);
+    BOOST_CHECK_EQUAL(members[0],"items.ALL");
+    ra1.reset();
+    rep1.clear();
+
+    auto v2=validator(
+                _["items"](ALL(value(gt,0) ^AND^ value(lt,10)))
+            );
+    BOOST_CHECK(!v2.apply(ra1));
+    BOOST_CHECK_EQUAL(rep1,"each element of items must be greater than 0 (elements [0..1, 3..4]) AND each element of items must be less than 10 (elements [5, 7])");
+    ra1.reset();
+    rep1.clear();
+
+    auto v3=validator(
+                _["items"](size(gte,1)),
+                _["items"][ALL](lt,100)
+            );
+    BOOST_CHECK(v3.apply(ra1));
+    BOOST_CHECK(rep1.empty());
+    ra1.reset();
+
+    // limits of groups, failures and listed index ranges
+    auto ra2=make_reporting_adapter(m1,make_reporter(rep1,get_default_formatter(),aggregation_summary(1,5,1)));
+    BOOST_CHECK(!v2.apply(ra2));
+    BOOST_CHECK_EQUAL(rep1,"each element of items must be greater than 0 (elements [0..1, ... ]); 1 more failed element");
+    rep1.clear();
+    m1["items"]={0,20,0,30,40};
+    auto ra5=make_reporting_adapter(m1,make_reporter(rep1,get_default_formatter(),aggregation_summary(1)));
+    BOOST_CHECK(!v2.apply(ra5));
+    BOOST_CHECK_EQUAL(rep1,"each element of items must be greater than 0 (elements [0, 2]); 3 more failed elements");
+    rep1.clear();
+
+    // summary is disabled by default
+    auto ra3=make_reporting_adapter(m1,rep1);
+    BOOST_CHECK(!v2.apply(ra3));
+    BOOST_CHECK_EQUAL(rep1,"each element of items must be greater than 0");
+    rep1.clear();
+
+    // summary is not used with ANY aggregation
+    std::vector<int> vec1{1,2,3};
+    auto ra4=make_reporting_adapter(vec1,make_reporter(rep1,get_default_formatter(),aggregation_summary(10)));
+    auto v4=validator(
+                _[ANY](gt,5)
+            );
+    BOOST_CHECK(!v4.apply(ra4));
+    BOOST_CHECK_EQUAL(rep1,"at least one element must be greater than 5");
+    rep1.clear();
+}
+
 BOOST_AUTO_TEST_SUITE_END()
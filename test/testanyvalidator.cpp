@@ -0,0 +1,123 @@
+#include <map>
+#include <string>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <hatn/validator/validator.hpp>
+#include <hatn/validator/validate.hpp>
+#include <hatn/validator/any_validator.hpp>
+
+using namespace HATN_VALIDATOR_NAMESPACE;
+
+namespace
+{
+using object_type=std::map<std::string,int>;
+}
+
+BOOST_AUTO_TEST_SUITE(TestAnyValidator)
+
+BOOST_AUTO_TEST_CASE(CheckApply)
+{
+    object_type m1{{"field1",10},{"field2",20}};
+    object_type m2{{"field1",1},{"field2",200}};
+
+    std::vector<any_validator<object_type>> validators;
+    validators.emplace_back(validator(_["field1"](gte,5)));
+    validators.emplace_back(validator(_["field2"](lte,100)));
+    validators.emplace_back(validator(_["field1"](lt,_["field2"]),_["field1"](gte,5)));
+
+    for (auto&& v:validators)
+    {
+        BOOST_CHECK(v.apply(m1));
+        BOOST_CHECK(!v.apply(m2));
+    }
+
+    std::string rep;
+    BOOST_CHECK(!validators[0].apply(m2,rep));
+    BOOST_CHECK_EQUAL(rep,std::string("field1 must be greater than or equal to 5"));
+    rep.clear();
+    BOOST_CHECK(!validators[1].apply(m2,rep));
+    BOOST_CHECK_EQUAL(rep,std::string("field2 must be less than or equal to 100"));
+
+    // validate() with constant and non-constant objects
+    error_report err;
+    validate(m1,validators[0],err);
+    BOOST_CHECK(!err);
+    validate(m2,validators[0],err);
+    BOOST_CHECK(err);
+    BOOST_CHECK_EQUAL(err.message(),std::string("field1 must be greater than or equal to 5"));
+    const auto& cm2=m2;
+    validate(cm2,validators[1],err);
+    BOOST_CHECK_EQUAL(err.message(),std::string("field2 must be less than or equal to 100"));
+    validate(m2,validators[1],err);
+    BOOST_CHECK_EQUAL(err.message(),std::string("field2 must be less than or equal to 100"));
+    validate(m1,validators[2],err);
+    BOOST_CHECK(!err);
+    error err1;
+    validate(m2,validators[2],err1);
+    BOOST_CHECK(err1);
+
+    any_validator<object_type> empty_v;
+    BOOST_CHECK(empty_v.empty());
+    BOOST_CHECK(!empty_v);
+    BOOST_CHECK(!empty_v.apply(m1));
+}
+
+BOOST_AUTO_TEST_CASE(CheckStorage)
+{
+    object_type m1{{"field1",10},{"field2",20}};
+    object_type m2{{"field1",1}};
+
+    auto v1=validator(_["field1"](gte,5));
+    using small_validator=any_validator<object_type>;
+    BOOST_CHECK(small_validator::fits_buffer<decltype(v1)>());
+
+    // too small buffer to fit validator, validator is allocated on heap
+    using heap_validator=any_validator<object_type,8>;
+    BOOST_CHECK(!heap_validator::fits_buffer<decltype(v1)>());
+
+    auto check=[&](auto v)
+    {
+        using type=decltype(v);
+
+        BOOST_CHECK(v.apply(m1));
+        BOOST_CHECK(!v.apply(m2));
+
+        type v2(v);
+        BOOST_CHECK(v2.apply(m1));
+        BOOST_CHECK(!v2.apply(m2));
+
+        type v3(std::move(v2));
+        BOOST_CHECK(v2.empty());
+        BOOST_CHECK(v3.apply(m1));
+        BOOST_CHECK(!v3.apply(m2));
+
+        type v4;
+        v4=v3;
+        BOOST_CHECK(v4.apply(m1));
+        BOOST_CHECK(!v4.apply(m2));
+        v4=std::move(v3);
+        BOOST_CHECK(v3.empty());
+        BOOST_CHECK(v4.apply(m1));
+        BOOST_CHECK(!v4.apply(m2));
+
+        v4=type(validator(_["field2"](exists,true)));
+        BOOST_CHECK(v4.apply(m1));
+        BOOST_CHECK(!v4.apply(m2));
+
+        v4.reset();
+        BOOST_CHECK(v4.empty());
+
+        std::vector<type> validators(100,v);
+        validators.resize(1000,v);
+        for (auto&& it:validators)
+        {
+            BOOST_CHECK(!it.apply(m2));
+        }
+    };
+    check(small_validator(v1));
+    check(heap_validator(v1));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,88 @@
+#include <boost/test/unit_test.hpp>
+
+#include <hatn/validator/validator.hpp>
+#include <hatn/validator/validate.hpp>
+#include <hatn/validator/json/boost_json.hpp>
+
+using namespace HATN_VALIDATOR_NAMESPACE;
+
+namespace
+{
+
+boost::json::value make_document()
+{
+    return boost::json::object{
+        {"field1",10},
+        {"field2",boost::json::object{{"field3","value3"},{"f4",4}}},
+        {"field5",boost::json::array{1,2,3}},
+        {"field6",true},
+        {"field7",boost::json::array{boost::json::object{{"x",1}},boost::json::object{{"x",5}}}}
+    };
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE(TestBoostJson)
+
+BOOST_AUTO_TEST_CASE(CheckMembers)
+{
+    auto doc=make_document();
+    error_report err;
+
+    auto v1=validator(
+                _["field1"](gte,5),
+                _["field2"]["field3"](size(gte,3)),
+                _["field2"]["field3"](eq,"value3"),
+                _["field5"](size(eq,3)),
+                _["field5"][1](eq,2),
+                _["field6"](eq,true)
+            );
+    validate(json_view(doc),v1,err);
+    BOOST_CHECK(!err);
+
+    validate(json_view(doc),validator(_["field1"](gte,50)),err);
+    BOOST_CHECK_EQUAL(err.message(),std::string("field1 must be greater than or equal to 50"));
+
+    validate(json_view(doc),validator(_["field5"][1](eq,3)),err);
+    BOOST_CHECK_EQUAL(err.message(),std::string("element #1 of field5 must be equal to 3"));
+
+    validate(json_view(doc),validator(_["field8"](exists,true)),err);
+    BOOST_CHECK_EQUAL(err.message(),std::string("field8 must exist"));
+
+    // values of different kinds are not comparable
+    validate(json_view(doc),validator(_["field1"](eq,"10")),err);
+    BOOST_CHECK(err);
+    validate(json_view(doc),validator(_["field1"](ne,"10")),err);
+    BOOST_CHECK(!err);
+
+    // object and array can be validated directly
+    const auto& obj=*doc.if_object();
+    validate(json_view(obj),validator(_["field1"](gt,9.5)),err);
+    BOOST_CHECK(!err);
+    const auto& arr=*obj.find("field5")->value().if_array();
+    validate(json_view(arr),validator(_[ALL](lt,3)),err);
+    BOOST_CHECK_EQUAL(err.message(),std::string("each element must be less than 3"));
+}
+
+BOOST_AUTO_TEST_CASE(CheckAggregations)
+{
+    auto doc=make_document();
+    error_report err;
+
+    validate(json_view(doc),validator(_["field5"][ALL](lt,10)),err);
+    BOOST_CHECK(!err);
+    validate(json_view(doc),validator(_["field5"][ALL](lt,2)),err);
+    BOOST_CHECK_EQUAL(err.message(),std::string("each element of field5 must be less than 2"));
+
+    validate(json_view(doc),validator(_["field7"][ALL]["x"](lt,_["field1"])),err);
+    BOOST_CHECK(!err);
+    validate(json_view(doc),validator(_["field7"][ANY]["x"](gt,7)),err);
+    BOOST_CHECK_EQUAL(err.message(),std::string("x of at least one element of field7 must be greater than 7"));
+
+    validate(json_view(doc),validator(_["field2"][ALL(keys)](size(lte,6))),err);
+    BOOST_CHECK(!err);
+    validate(json_view(doc),validator(_["field2"][ALL(keys)](size(lte,3))),err);
+    BOOST_CHECK_EQUAL(err.message(),std::string("size of each key of field2 must be less than or equal to 3"));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,233 @@
+#include <map>
+#include <string>
+#include <vector>
+#include <atomic>
+#include <thread>
+#include <new>
+#include <type_traits>
+
+#include <boost/test/unit_test.hpp>
+
+#include <hatn/validator/validator.hpp>
+#include <hatn/validator/cached_validator.hpp>
+
+using namespace HATN_VALIDATOR_NAMESPACE;
+
+namespace
+{
+using object_type=std::map<std::string,int>;
+
+struct counted_int
+{
+    mutable size_t* count;
+    int value;
+
+    bool operator >= (int other) const
+    {
+        ++(*count);
+        return value>=other;
+    }
+};
+}
+
+BOOST_AUTO_TEST_SUITE(TestCachedValidator)
+
+BOOST_AUTO_TEST_CASE(CheckHitsAndMisses)
+{
+    object_type obj1{{"field1",10}};
+    object_type obj2{{"field1",1}};
+
+    auto v=make_cached_validator(validator(_["field1"](gte,5)),16,2);
+    BOOST_CHECK_EQUAL(v.capacity(),16);
+
+    BOOST_CHECK(v.apply(make_object_version(obj1,1),obj1));
+    BOOST_CHECK(v.apply(make_object_version(obj1,1),obj1));
+    BOOST_CHECK(!v.apply(make_object_version(obj2,0),obj2));
+    auto stats=v.stats();
+    BOOST_CHECK_EQUAL(stats.hits,1);
+    BOOST_CHECK_EQUAL(stats.misses,2);
+    BOOST_CHECK_EQUAL(stats.size,2);
+
+    // cached result is returned even if the object was modified without changing its version
+    obj2["field1"]=100;
+    BOOST_CHECK(!v.apply(make_object_version(obj2,0),obj2));
+    BOOST_CHECK(v.apply(make_object_version(obj2,1),obj2));
+    stats=v.stats();
+    BOOST_CHECK_EQUAL(stats.hits,2);
+    BOOST_CHECK_EQUAL(stats.misses,3);
+    BOOST_CHECK_EQUAL(stats.size,3);
+
+    v.erase(make_object_version(obj2,0));
+    BOOST_CHECK_EQUAL(v.stats().size,2);
+    BOOST_CHECK(v.apply(make_object_version(obj2,0),obj2));
+
+    v.reset_stats();
+    stats=v.stats();
+    BOOST_CHECK_EQUAL(stats.hits,0);
+    BOOST_CHECK_EQUAL(stats.misses,0);
+    BOOST_CHECK_EQUAL(stats.size,3);
+
+    v.clear();
+    BOOST_CHECK_EQUAL(v.stats().size,0);
+}
+
+BOOST_AUTO_TEST_CASE(CheckReusedAddress)
+{
+    auto v=make_cached_validator(validator(_["field1"](gte,5)),16,2);
+
+    // objects are placed at the same address one after another
+    std::aligned_storage<sizeof(object_type),alignof(object_type)>::type storage;
+
+    auto obj1=new (&storage) object_type{{"field1",10}};
+    auto version1=next_object_version();
+    BOOST_CHECK(v.apply(make_object_version(*obj1,version1),*obj1));
+    BOOST_CHECK(v.apply(make_object_version(*obj1,1),*obj1));
+    obj1->~object_type();
+
+    auto obj2=new (&storage) object_type{{"field1",1}};
+    auto version2=next_object_version();
+    BOOST_CHECK(version2!=version1);
+    BOOST_CHECK(static_cast<const void*>(obj1)==static_cast<const void*>(obj2));
+    BOOST_CHECK(make_object_version(*obj2,version2)!=make_object_version(*obj1,version1));
+
+    // unique versions do not collide
+    BOOST_CHECK(!v.apply(make_object_version(*obj2,version2),*obj2));
+
+    // per-object versions collide, so the new object gets the result of the destroyed one
+    BOOST_CHECK(v.apply(make_object_version(*obj2,1),*obj2));
+    obj2->~object_type();
+}
+
+BOOST_AUTO_TEST_CASE(CheckReport)
+{
+    object_type obj{{"field1",1}};
+
+    auto v=make_cached_validator<std::string>(validator(_["field1"](gte,5)));
+    error_report err;
+
+    // status without report is not enough to make report
+    BOOST_CHECK(!v.apply("hash1",obj));
+    v.apply("hash1",obj,err);
+    BOOST_CHECK(err);
+    BOOST_CHECK_EQUAL(err.message(),std::string("field1 must be greater than or equal to 5"));
+    auto stats=v.stats();
+    BOOST_CHECK_EQUAL(stats.hits,0);
+    BOOST_CHECK_EQUAL(stats.misses,2);
+    BOOST_CHECK_EQUAL(stats.size,1);
+
+    // report is taken from cache
+    v.apply("hash1",obj,err);
+    BOOST_CHECK(err);
+    BOOST_CHECK_EQUAL(err.message(),std::string("field1 must be greater than or equal to 5"));
+    BOOST_CHECK(!v.apply("hash1",obj));
+    BOOST_CHECK_EQUAL(v.stats().hits,2);
+
+    obj["field1"]=10;
+    v.apply("hash2",obj,err);
+    BOOST_CHECK(!err);
+    v.apply("hash2",obj,err);
+    BOOST_CHECK(!err);
+    BOOST_CHECK(err.message().empty());
+    BOOST_CHECK_EQUAL(v.stats().hits,3);
+}
+
+BOOST_AUTO_TEST_CASE(CheckEviction)
+{
+    size_t count=0;
+    std::map<std::string,counted_int> obj{{"field1",counted_int{&count,10}}};
+
+    auto v=make_cached_validator<int>(validator(_["field1"](gte,5)),2,1);
+
+    BOOST_CHECK(v.apply(1,obj));
+    BOOST_CHECK(v.apply(2,obj));
+    BOOST_CHECK_EQUAL(count,2);
+
+    // 1 is recently used, so 2 is evicted
+    BOOST_CHECK(v.apply(1,obj));
+    BOOST_CHECK(v.apply(3,obj));
+    BOOST_CHECK_EQUAL(count,3);
+    auto stats=v.stats();
+    BOOST_CHECK_EQUAL(stats.evictions,1);
+    BOOST_CHECK_EQUAL(stats.size,2);
+
+    BOOST_CHECK(v.apply(1,obj));
+    BOOST_CHECK_EQUAL(count,3);
+    BOOST_CHECK(v.apply(2,obj));
+    BOOST_CHECK_EQUAL(count,4);
+    stats=v.stats();
+    BOOST_CHECK_EQUAL(stats.evictions,2);
+    BOOST_CHECK_EQUAL(stats.hits,2);
+    BOOST_CHECK_EQUAL(stats.misses,4);
+
+    // cache with zero capacity always validates
+    auto v0=make_cached_validator<int>(validator(_["field1"](gte,5)),0);
+    BOOST_CHECK(v0.apply(1,obj));
+    BOOST_CHECK(v0.apply(1,obj));
+    BOOST_CHECK_EQUAL(count,6);
+    BOOST_CHECK_EQUAL(v0.stats().size,0);
+    BOOST_CHECK_EQUAL(v0.capacity(),0);
+}
+
+BOOST_AUTO_TEST_CASE(CheckCapacity)
+{
+    auto v=validator(_["field1"](gte,5));
+
+    BOOST_CHECK_EQUAL(make_cached_validator<int>(v,1,16).capacity(),1);
+    BOOST_CHECK_EQUAL(make_cached_validator<int>(v,17,16).capacity(),17);
+    BOOST_CHECK_EQUAL(make_cached_validator<int>(v,100,7).capacity(),100);
+    BOOST_CHECK_EQUAL(make_cached_validator<int>(v,1024).capacity(),1024);
+
+    // number of cached results never exceeds capacity
+    object_type obj{{"field1",10}};
+    auto v1=make_cached_validator<int>(v,5,4);
+    for (int i=0;i<100;i++)
+    {
+        BOOST_CHECK(v1.apply(i,obj));
+    }
+    BOOST_CHECK_EQUAL(v1.stats().size,5);
+}
+
+BOOST_AUTO_TEST_CASE(CheckConcurrentAccess)
+{
+    const size_t objects_count=64;
+    std::vector<object_type> objects;
+    for (size_t i=0;i<objects_count;i++)
+    {
+        objects.push_back(object_type{{"field1",static_cast<int>(i)}});
+    }
+
+    // capacity is less than number of objects, so threads evict entries of each other
+    auto v=make_cached_validator(validator(_["field1"](gte,32)),32,4);
+    std::atomic<size_t> failures{0};
+    std::vector<std::thread> threads;
+    for (size_t i=0;i<4;i++)
+    {
+        threads.emplace_back(
+            [&v,&objects,&failures,i]()
+            {
+                error_report err;
+                for (size_t j=0;j<5000;j++)
+                {
+                    auto idx=(i*13+j*7)%objects.size();
+                    const auto& obj=objects[idx];
+                    auto key=make_object_version(obj,1);
+                    bool ok=(j%2==0) ? static_cast<bool>(v.apply(key,obj)) : (v.apply(key,obj,err),!err);
+                    if (ok!=(idx>=32) || (!ok && j%2!=0 && err.message()!="field1 must be greater than or equal to 32"))
+                    {
+                        ++failures;
+                    }
+                }
+            }
+        );
+    }
+    for (auto&& thread:threads)
+    {
+        thread.join();
+    }
+    BOOST_CHECK_EQUAL(failures.load(),0);
+    auto stats=v.stats();
+    BOOST_CHECK_EQUAL(stats.hits+stats.misses,4*5000);
+    BOOST_CHECK(stats.size<=v.capacity());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,141 @@
+#include <string>
+
+#include <boost/test/unit_test.hpp>
+
+#include <hatn/validator/validator.hpp>
+#include <hatn/validator/validate.hpp>
+#include <hatn/validator/operators/number_patterns.hpp>
+#include <hatn/validator/csv/csv_row.hpp>
+
+using namespace HATN_VALIDATOR_NAMESPACE;
+
+BOOST_AUTO_TEST_SUITE(TestCsvRow)
+
+BOOST_AUTO_TEST_CASE(CheckFields)
+{
+    std::string data{"1,\"apple, red\",10.5,\"the \"\"best\"\"\",-7\r"};
+    csv_row row{data};
+    BOOST_CHECK(row.well_formed());
+    BOOST_REQUIRE_EQUAL(row.size(),5);
+
+    // unquoted and quoted fields without escapes are views of the line
+    BOOST_CHECK(row.field(0).data()==data.data());
+    BOOST_CHECK_EQUAL(row.field(1).str(),string_view("apple, red"));
+    BOOST_CHECK(row.field(1).data()==data.data()+3);
+    BOOST_CHECK_EQUAL(row.field(3).str(),string_view("the \"best\""));
+    BOOST_CHECK_EQUAL(row.field(4).str(),string_view("-7"));
+    BOOST_CHECK(row.field(5).is_missing());
+
+    // numbers are parsed only in comparisons
+    BOOST_CHECK(row.field(0)==1);
+    BOOST_CHECK(row.field(0)<1.5);
+    BOOST_CHECK(row.field(2)>10);
+    BOOST_CHECK(row.field(2)==10.5);
+    BOOST_CHECK(row.field(4)<0);
+    BOOST_CHECK(row.field(4)<0u);
+    BOOST_CHECK(row.field(0)=="1");
+    BOOST_CHECK(!(row.field(1)==0));
+    BOOST_CHECK(row.field(1)!=0);
+    BOOST_CHECK(!(row.field(1)<0) && !(row.field(1)>=0));
+    BOOST_CHECK(!(row.field(5)==0) && !(row.field(5)==""));
+    BOOST_CHECK(row.field(2)>row.field(0));
+    BOOST_CHECK(row.field(1)<row.field(3));
+
+    int val=0;
+    BOOST_CHECK(row.field(4).to_number(val));
+    BOOST_CHECK_EQUAL(val,-7);
+    BOOST_CHECK(!row.field(2).to_number(val));
+    double dval=0.0;
+    BOOST_CHECK(row.field(2).to_number(dval));
+    BOOST_CHECK_EQUAL(dval,10.5);
+
+    csv_row tsv{"a\tb,c\t",'\t'};
+    BOOST_REQUIRE_EQUAL(tsv.size(),3);
+    BOOST_CHECK_EQUAL(tsv.field(1).str(),string_view("b,c"));
+    BOOST_CHECK(tsv.field(2).empty());
+
+    csv_row malformed{"1,\"abc"};
+    BOOST_CHECK(!malformed.well_formed());
+    BOOST_CHECK_EQUAL(malformed.field(1).str(),string_view("abc"));
+}
+
+BOOST_AUTO_TEST_CASE(CheckValidation)
+{
+    csv_header header{"id,name,price,min,max"};
+    BOOST_CHECK_EQUAL(header.size(),5);
+    BOOST_CHECK_EQUAL(header.index("price"),2);
+    BOOST_CHECK(header.index("unknown")==csv_header::npos);
+
+    auto v=validator(
+                size(eq,5),
+                _["id"](str_int,true),
+                _["id"](gte,0),
+                _["name"](size(gte,1)),
+                _["price"](gt,0),
+                _["max"](gte,_["min"])
+            );
+    error_report err;
+
+    std::string line1{"1,apple,10.5,2,10"};
+    validate(csv_row(line1,header),v,err);
+    BOOST_CHECK(!err);
+
+    std::string line2{"1,apple,-1,2,10"};
+    validate(csv_row(line2,header),v,err);
+    BOOST_CHECK_EQUAL(err.message(),std::string("price must be greater than 0"));
+
+    // fields are compared as numbers rather than as strings
+    std::string line3{"1,apple,10.5,9,10"};
+    validate(csv_row(line3,header),v,err);
+    BOOST_CHECK(!err);
+    std::string line4{"1,apple,10.5,11,10"};
+    validate(csv_row(line4,header),v,err);
+    BOOST_CHECK_EQUAL(err.message(),std::string("max must be greater than or equal to min"));
+
+    std::string line5{"x,apple,10.5,2,10"};
+    validate(csv_row(line5,header),v,err);
+    BOOST_CHECK_EQUAL(err.message(),std::string("id must be integer"));
+
+    std::string line6{"1,apple,10.5"};
+    validate(csv_row(line6,header),v,err);
+    BOOST_CHECK_EQUAL(err.message(),std::string("size must be equal to 5"));
+    validate(csv_row(line6,header),validator(_["max"](exists,true)),err);
+    BOOST_CHECK_EQUAL(err.message(),std::string("max must exist"));
+
+    // NaN is not ordered with numbers, infinities are
+    std::string line7{"1,apple,nan,2,10"};
+    validate(csv_row(line7,header),v,err);
+    BOOST_CHECK_EQUAL(err.message(),std::string("price must be greater than 0"));
+    validate(csv_row(line7,header),validator(_["price"](gte,0)),err);
+    BOOST_CHECK_EQUAL(err.message(),std::string("price must be greater than or equal to 0"));
+    validate(csv_row(line7,header),validator(_["price"](lt,100)),err);
+    BOOST_CHECK_EQUAL(err.message(),std::string("price must be less than 100"));
+    validate(csv_row(line7,header),validator(_["price"](eq,_["price"])),err);
+    BOOST_CHECK_EQUAL(err.message(),std::string("price must be equal to price"));
+    validate(csv_row(line7,header),validator(_["price"](gte,0.0)),err);
+    BOOST_CHECK_EQUAL(err.message(),std::string("price must be greater than or equal to 0"));
+
+    std::string line8{"1,apple,inf,-inf,10"};
+    validate(csv_row(line8,header),validator(_["price"](gt,0),_["price"](gte,1.5)),err);
+    BOOST_CHECK(!err);
+    validate(csv_row(line8,header),validator(_["price"](lt,100)),err);
+    BOOST_CHECK_EQUAL(err.message(),std::string("price must be less than 100"));
+    validate(csv_row(line8,header),validator(_["price"](eq,_["min"])),err);
+    BOOST_CHECK_EQUAL(err.message(),std::string("price must be equal to min"));
+    validate(csv_row(line8,header),validator(_["min"](lt,_["max"]),_["price"](gt,_["max"])),err);
+    BOOST_CHECK(!err);
+
+    // fields by indexes
+    validate(csv_row(line1),validator(_[2](lt,100),_[1](eq,"apple")),err);
+    BOOST_CHECK(!err);
+    validate(csv_row(line1),validator(_[0](gt,1)),err);
+    BOOST_CHECK_EQUAL(err.message(),std::string("element #0 must be greater than 1"));
+
+    // aggregations
+    validate(csv_row(line1,header),validator(_[ALL](size(gte,1))),err);
+    BOOST_CHECK(!err);
+    validate(csv_row(line1,header),validator(_[ALL(keys)](size(lte,4))),err);
+    BOOST_CHECK_EQUAL(err.message(),std::string("size of each key must be less than or equal to 4"));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -1,6 +1,8 @@
 #include <string>
 #include <vector>
 #include <iterator>
+#include <atomic>
+#include <thread>
 
 #include <boost/test/unit_test.hpp>
 
@@ -8,6 +10,8 @@
 #include <hatn/validator/reporting/formatter.hpp>
 #include <hatn/validator/properties.hpp>
 #include <hatn/validator/reporting/mapped_translator.hpp>
+#include <hatn/validator/reporting/hashed_translator.hpp>
+#include <hatn/validator/reporting/formatter_cache.hpp>
 #include <hatn/validator/reporting/translator_repository.hpp>
 #include <hatn/validator/utils/hana_to_std_tuple.hpp>
 
@@ -142,6 +146,16 @@ BOOST_AUTO_TEST_CASE(CheckFmtFormatterWithRvals)
     checkFormatterWithRvals(make_backend_formatter);
 }
 
+BOOST_AUTO_TEST_CASE(CheckFmtFormatterWithHashedTranslator)
+{
+    checkFormatterWithHashedTranslator(make_backend_formatter);
+}
+
+BOOST_AUTO_TEST_CASE(CheckFmtFormatterCache)
+{
+    checkFormatterCache(make_backend_formatter);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 #endif
@@ -477,6 +477,165 @@ void checkFormatterWithRvals(const WrapStringFn& wrapper)
     testFormatter(fm,wrapper);
 }
 
+template <typename WrapStringFn>
+void checkFormatterWithHashedTranslator(const WrapStringFn& wrapper)
+{
+    std::map<std::string,std::string> m=
+    {
+        {std::string(gte),"must be at least"},
+        {size.name(),"number of elements"}
+    };
+    hashed_translator tr1{m};
+    auto fm=make_formatter(tr1);
+
+    std::string str1;
+    auto w1=wrapper(str1);
+    fm.validate_operator(w1,gte,10);
+    BOOST_CHECK_EQUAL(str1,std::string("must be at least 10"));
+
+    std::string str2;
+    auto w2=wrapper(str2);
+    fm.validate_property(w2,size,gte,100);
+    BOOST_CHECK_EQUAL(str2,std::string("number of elements must be at least 100"));
+}
+
+
+template <typename WrapStringFn>
+void checkFormatterCache(const WrapStringFn& wrapper)
+{
+    std::map<std::string,std::string> m1=
+    {
+        {std::string(gte),"must be at least"}
+    };
+    auto tr1=std::make_shared<mapped_translator>(m1);
+    translator_repository rep1;
+    rep1.add_translator(tr1,{"en"});
+
+    formatter_cache<> cache1(rep1,formatter_cache<>::default_max_locales,"en_US.UTF-8");
+    BOOST_CHECK_EQUAL(cache1.default_locale(),std::string("en_US.UTF-8"));
+    BOOST_CHECK_EQUAL(cache1.size(),0u);
+    auto reader1=cache1.make_reader();
+
+    {
+        auto g1=reader1.lock("en_US.UTF-8");
+        const auto* fm1=&g1.formatter();
+        BOOST_CHECK_EQUAL(cache1.size(),1u);
+        {
+            // guards of the same reader can be nested
+            auto g=reader1.lock("en_US.UTF-8");
+            BOOST_CHECK(fm1==&g.formatter());
+        }
+        BOOST_CHECK_EQUAL(cache1.size(),1u);
+
+        std::string str1;
+        auto w1=wrapper(str1);
+        fm1->validate_operator(w1,gte,10);
+        BOOST_CHECK_EQUAL(str1,std::string("must be at least 10"));
+
+        // formatter of default locale is shared with formatter of the same name
+        {
+            auto g=reader1.lock();
+            BOOST_CHECK(fm1==&g.formatter());
+        }
+        BOOST_CHECK_EQUAL(cache1.size(),1u);
+
+        auto g2=reader1.lock("de");
+        const auto* fm2=&g2.formatter();
+        BOOST_CHECK(fm1!=fm2);
+        // formatter found in the cache pins the snapshot
+        auto g2p=reader1.lock("de");
+        BOOST_CHECK(fm2==&g2p.formatter());
+        BOOST_CHECK_EQUAL(cache1.size(),2u);
+        std::string str2;
+        auto w2=wrapper(str2);
+        fm2->validate_operator(w2,gte,10);
+        BOOST_CHECK_EQUAL(str2,std::string("must be greater than or equal to 10"));
+
+        // modification of repository invalidates cache
+        std::map<std::string,std::string> m2=
+        {
+            {std::string(gte),"muss mindestens sein"}
+        };
+        auto tr2=std::make_shared<mapped_translator>(m2);
+        rep1.add_translator(tr2,{"de"});
+        BOOST_CHECK_EQUAL(cache1.size(),0u);
+
+        {
+            auto g3=reader1.lock("de");
+            BOOST_CHECK(&g3.formatter()!=fm2);
+            std::string str3;
+            auto w3=wrapper(str3);
+            g3.formatter().validate_operator(w3,gte,10);
+            BOOST_CHECK_EQUAL(str3,std::string("muss mindestens sein 10"));
+        }
+
+        // formatters pinned before invalidation are still valid
+        std::string str4;
+        auto w4=wrapper(str4);
+        fm2->validate_operator(w4,gte,10);
+        BOOST_CHECK_EQUAL(str4,std::string("must be greater than or equal to 10"));
+        BOOST_CHECK(cache1.retired_count()!=0u);
+    }
+
+    // retired snapshots are destroyed on next update when guards are released
+    {
+        auto g=reader1.lock("fr");
+    }
+    BOOST_CHECK_EQUAL(cache1.retired_count(),0u);
+
+    // number of cached locales is limited
+    formatter_cache<> cache2(rep1,1);
+    auto reader2=cache2.make_reader();
+    auto g5=reader2.lock("en");
+    auto fm5=&g5.formatter();
+    BOOST_CHECK(fm5==&reader2.lock("en").formatter());
+    auto g6=reader2.lock("de");
+    auto fm6=&g6.formatter();
+    BOOST_CHECK(fm6!=&reader2.lock("de").formatter());
+    BOOST_CHECK_EQUAL(cache2.size(),1u);
+    std::string str6;
+    auto w6=wrapper(str6);
+    fm6->validate_operator(w6,gte,10);
+    BOOST_CHECK_EQUAL(str6,std::string("muss mindestens sein 10"));
+
+    // concurrent lookups while new locales are added replace and destroy snapshots
+    formatter_cache<> cache3(rep1);
+    std::vector<std::string> locales;
+    for (size_t i=0;i<32;i++)
+    {
+        locales.push_back((i%2==0 ? "en_" : "de_")+std::to_string(i));
+    }
+    std::atomic<size_t> failures{0};
+    std::vector<std::thread> threads;
+    for (size_t i=0;i<4;i++)
+    {
+        threads.emplace_back(
+            [&cache3,&locales,&failures,&wrapper,i]()
+            {
+                auto reader=cache3.make_reader();
+                for (size_t j=0;j<1000;j++)
+                {
+                    const auto& loc=locales[(i*7+j)%locales.size()];
+                    auto guard=reader.lock(loc);
+                    std::string str;
+                    auto w=wrapper(str);
+                    guard.formatter().validate_operator(w,gte,10);
+                    if (str!=(loc[0]=='e' ? "must be at least 10" : "muss mindestens sein 10"))
+                    {
+                        ++failures;
+                    }
+                }
+            }
+        );
+    }
+    for (auto&& thread:threads)
+    {
+        thread.join();
+    }
+    BOOST_CHECK_EQUAL(failures.load(),0u);
+    BOOST_CHECK_EQUAL(cache3.size(),locales.size());
+}
+
 }
 
 #endif
@@ -0,0 +1,199 @@
+#include <map>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <hatn/validator/validator.hpp>
+#include <hatn/validator/incremental_validator.hpp>
+#include <hatn/validator/prevalidation/set_validated.hpp>
+#include <hatn/validator/prevalidation/unset_validated.hpp>
+#include <hatn/validator/prevalidation/resize_validated.hpp>
+#include <hatn/validator/prevalidation/clear_validated.hpp>
+
+using namespace HATN_VALIDATOR_NAMESPACE;
+
+namespace
+{
+using object_type=std::map<std::string,std::map<std::string,int>>;
+
+std::vector<std::string> to_paths(std::initializer_list<const char*> paths)
+{
+    return std::vector<std::string>(paths.begin(),paths.end());
+}
+
+std::vector<bool> to_flags(std::initializer_list<bool> flags)
+{
+    return std::vector<bool>(flags.begin(),flags.end());
+}
+}
+
+BOOST_AUTO_TEST_SUITE(TestIncrementalValidator)
+
+BOOST_AUTO_TEST_CASE(CheckDependencies)
+{
+    object_type obj{
+        {"a",{{"x",1},{"y",2}}},
+        {"b",{{"x",3}}},
+        {"c",{}}
+    };
+
+    auto v=make_incremental_validator(
+                _["a"]["x"](gte,1),
+                _["a"]["y"](gt,_["a"]["x"]),
+                _["b"](size(gte,1)),
+                _["c"][ALL](gte,10),
+                _["b"][ANY](eq,3) ^OR^ _["a"]["x"](eq,100),
+                _["a"](_["x"](lt,5)),
+                _["d"](exists,false),
+                _["a"](ALL(value(gte,0)))
+            );
+    BOOST_CHECK_EQUAL(v.size(),8);
+
+    error_report err;
+    v.apply(obj,err);
+    BOOST_CHECK(!err);
+
+    BOOST_CHECK(v.dependencies(0)==to_paths({"a.x"}));
+    BOOST_CHECK(v.dependencies(1)==to_paths({"a.x","a.y"}));
+    BOOST_CHECK(v.dependencies(2)==to_paths({"b"}));
+    // empty container under element aggregation
+    BOOST_CHECK(v.dependencies(3)==to_paths({"c"}));
+    // OR stops at the first operand that succeeded
+    BOOST_CHECK(v.dependencies(4)==to_paths({"b"}));
+    BOOST_CHECK(v.dependencies(5)==to_paths({"a.x"}));
+    BOOST_CHECK(v.dependencies(6)==to_paths({"d"}));
+    BOOST_CHECK(v.dependencies(7)==to_paths({"a"}));
+
+    changed_paths changes;
+    changes.add(_["a"]["y"]);
+    BOOST_CHECK(v.affected_nodes(changes)==to_flags({false,true,false,false,false,false,false,true}));
+    changes.clear();
+    changes.add(_["a"]);
+    BOOST_CHECK(v.affected_nodes(changes)==to_flags({true,true,false,false,false,true,false,true}));
+    changes.clear();
+    changes.add(_["c"]["z"]);
+    BOOST_CHECK(v.affected_nodes(changes)==to_flags({false,false,false,true,false,false,false,false}));
+    changes.clear();
+    changes.add(_["e"]);
+    BOOST_CHECK(v.affected_nodes(changes)==to_flags({false,false,false,false,false,false,false,false}));
+    changes.clear();
+    changes.add_object();
+    BOOST_CHECK(v.affected_nodes(changes)==to_flags({true,true,true,true,true,true,true,true}));
+}
+
+BOOST_AUTO_TEST_CASE(CheckRevalidate)
+{
+    object_type obj{
+        {"a",{{"x",1},{"y",2}}},
+        {"b",{{"x",3}}}
+    };
+
+    auto v=make_incremental_validator(
+                _["a"]["x"](gte,1),
+                _["a"]["y"](gt,_["a"]["x"]),
+                _["b"]["x"](lt,10)
+            );
+    auto v_full=validator(
+                _["a"]["x"](gte,1),
+                _["a"]["y"](gt,_["a"]["x"]),
+                _["b"]["x"](lt,10)
+            );
+
+    error_report err;
+    changed_paths changes;
+
+    // not validated yet, so all nodes are validated
+    v.revalidate(obj,changes,err);
+    BOOST_CHECK(!err);
+
+    set_validated(obj,_["a"]["x"],5,v_full,err,changes);
+    BOOST_CHECK(!err);
+    BOOST_CHECK_EQUAL(changes.paths().size(),1);
+    BOOST_CHECK_EQUAL(changes.paths().front(),std::string("a.x"));
+    v.revalidate(obj,changes,err);
+    BOOST_CHECK(err);
+    BOOST_CHECK_EQUAL(err.message(),std::string("y of a must be greater than x of a"));
+    changes.clear();
+
+    // failed pre-validation does not add changes
+    set_validated(obj,_["b"]["x"],20,v_full,err,changes);
+    BOOST_CHECK(err);
+    BOOST_CHECK(changes.empty());
+
+    set_validated(obj,_["a"]["y"],6,v_full,changes);
+    BOOST_CHECK_EQUAL(obj["a"]["y"],6);
+    BOOST_CHECK(!v.revalidate(obj,changes).fail());
+    changes.clear();
+
+    // results of nodes not affected by changes are taken from cache
+    obj["b"]["x"]=20;
+    changes.add(_["a"]["x"]);
+    BOOST_CHECK(!v.revalidate(obj,changes).fail());
+    changes.clear();
+    changes.add(_["b"]);
+    v.revalidate(obj,changes,err);
+    BOOST_CHECK(err);
+    BOOST_CHECK_EQUAL(err.message(),std::string("x of b must be less than 10"));
+    changes.clear();
+
+    v.apply(obj,err);
+    BOOST_CHECK(err);
+    BOOST_CHECK_EQUAL(err.message(),std::string("x of b must be less than 10"));
+
+    v.reset();
+    BOOST_CHECK(v.dependencies(0).empty());
+    obj["b"]["x"]=1;
+    BOOST_CHECK(!v.revalidate(obj,changes).fail());
+}
+
+BOOST_AUTO_TEST_CASE(CheckTrackChanges)
+{
+    std::map<std::string,std::string> obj{
+        {"field1","value1"},
+        {"field2","value2"},
+        {"field3","value3"}
+    };
+
+    auto v_full=validator(
+                _["field1"](size(gte,3)),
+                _["field2"](exists,true)
+            );
+    auto v=make_incremental_validator(
+                _["field1"](size(gte,3)),
+                _["field2"](exists,true),
+                _["field3"](exists,true)
+            );
+    BOOST_CHECK(!v.apply(obj).fail());
+
+    error_report err;
+    changed_paths changes;
+
+    resize_validated(obj,_["field1"],2,v_full,err,changes);
+    BOOST_CHECK(err);
+    BOOST_CHECK(changes.empty());
+    resize_validated(obj,_["field1"],4,v_full,err,changes);
+    BOOST_CHECK(!err);
+    resize_validated(obj,_["field1"],3,v_full,changes);
+
+    unset_validated(obj,_["field2"],v_full,err,changes);
+    BOOST_CHECK(err);
+    unset_validated(obj,_["field3"],v_full,err,changes);
+    BOOST_CHECK(!err);
+    BOOST_CHECK(obj.find("field3")==obj.end());
+
+    BOOST_CHECK(changes.paths()==to_paths({"field1","field1","field3"}));
+    BOOST_CHECK(v.affected_nodes(changes)==to_flags({true,false,true}));
+    v.revalidate(obj,changes,err);
+    BOOST_CHECK(err);
+    BOOST_CHECK_EQUAL(err.message(),std::string("field3 must exist"));
+    changes.clear();
+
+    obj["field3"]="value3";
+    clear_validated(obj,_["field3"],v_full,err,changes);
+    BOOST_CHECK(!err);
+    unset_validated(obj,_["field3"],v_full,changes);
+    BOOST_CHECK(changes.paths()==to_paths({"field3","field3"}));
+    changes.clear();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,318 @@
+#include <map>
+#include <string>
+#include <system_error>
+
+#include <boost/test/unit_test.hpp>
+
+#include <hatn/validator/validator.hpp>
+#include <hatn/validator/json/json_sax_validator.hpp>
+
+using namespace HATN_VALIDATOR_NAMESPACE;
+
+namespace
+{
+
+/*
+ * Events are emitted the same way as boost::json::basic_parser emits them for document
+ * {"field1":10,"field2":{"field3":"value3","field4":[1,2,3]},"field5":null,"field6":[true,false]}
+ */
+template <typename HandlerT>
+bool parse_document(HandlerT& h, int64_t field1, const std::string& field3, size_t field4_count, bool field6_1=false)
+{
+    std::error_code ec;
+    auto ok=h.on_document_begin(ec)
+        && h.on_object_begin(ec)
+        && h.on_key_part(string_view("fie"),3,ec) && h.on_key(string_view("ld1"),6,ec)
+        && h.on_number_part(string_view("1"),ec) && h.on_int64(field1,string_view("0"),ec)
+        && h.on_key(string_view("field2"),6,ec)
+        && h.on_object_begin(ec)
+        && h.on_key(string_view("field3"),6,ec)
+        && h.on_string_part(string_view(field3.data(),field3.size()/2),field3.size()/2,ec)
+        && h.on_string(string_view(field3.data()+field3.size()/2,field3.size()-field3.size()/2),field3.size(),ec)
+        && h.on_key(string_view("field4"),6,ec)
+        && h.on_array_begin(ec);
+    for (size_t i=0;ok && i<field4_count;i++)
+    {
+        ok=h.on_uint64(i+1,string_view("1"),ec);
+    }
+    ok=ok
+        && h.on_array_end(field4_count,ec)
+        && h.on_object_end(2,ec)
+        && h.on_key(string_view("field5"),6,ec)
+        && h.on_null(ec)
+        && h.on_key(string_view("field6"),6,ec)
+        && h.on_array_begin(ec)
+        && h.on_bool(true,ec)
+        && h.on_bool(field6_1,ec)
+        && h.on_array_end(2,ec)
+        && h.on_object_end(4,ec)
+        && h.on_document_end(ec);
+    if (!ok)
+    {
+        BOOST_CHECK(ec==std::errc::invalid_argument);
+    }
+    return ok;
+}
+
+/*
+ * Events are emitted for document {"a":a,"b":b,"c":{"d":d,"e":[e0,e1]}} with members in given order,
+ * any member is skipped if its key is empty.
+ */
+template <typename HandlerT>
+bool parse_members(HandlerT& h, const std::string& a, int64_t a_val, const std::string& b, int64_t b_val, int64_t d_val=1, int64_t e_val=1)
+{
+    std::error_code ec;
+    auto ok=h.on_document_begin(ec)
+        && h.on_object_begin(ec)
+        && (a.empty() || (h.on_key(string_view(a),a.size(),ec) && h.on_int64(a_val,string_view("1"),ec)))
+        && h.on_key(string_view("c"),1,ec)
+        && h.on_object_begin(ec)
+        && h.on_key(string_view("e"),1,ec)
+        && h.on_array_begin(ec)
+        && h.on_int64(e_val,string_view("1"),ec)
+        && h.on_int64(e_val+1,string_view("1"),ec)
+        && h.on_array_end(2,ec)
+        && h.on_key(string_view("d"),1,ec)
+        && h.on_int64(d_val,string_view("1"),ec)
+        && h.on_object_end(2,ec)
+        && (b.empty() || (h.on_key(string_view(b),b.size(),ec) && h.on_int64(b_val,string_view("1"),ec)))
+        && h.on_object_end(3,ec)
+        && h.on_document_end(ec);
+    if (!ok)
+    {
+        BOOST_CHECK(ec==std::errc::invalid_argument);
+    }
+    return ok;
+}
+
+/*
+ * Events are emitted for document {"id":id,"a":{"b":{"c":{"d":{"e":[1,{"f":"x"}]}}}}}
+ */
+template <typename HandlerT>
+bool parse_deep(HandlerT& h, int64_t id)
+{
+    std::error_code ec;
+    auto ok=h.on_document_begin(ec)
+        && h.on_object_begin(ec)
+        && h.on_key(string_view("id"),2,ec) && h.on_int64(id,string_view("1"),ec);
+    for (auto key : {"a","b","c","d"})
+    {
+        ok=ok && h.on_key(string_view(key),1,ec) && h.on_object_begin(ec);
+    }
+    ok=ok
+        && h.on_key(string_view("e"),1,ec)
+        && h.on_array_begin(ec)
+        && h.on_int64(1,string_view("1"),ec)
+        && h.on_object_begin(ec)
+        && h.on_key(string_view("f"),1,ec)
+        && h.on_string(string_view("x"),1,ec)
+        && h.on_object_end(1,ec)
+        && h.on_array_end(2,ec);
+    for (size_t i=0;i<5;i++)
+    {
+        ok=ok && h.on_object_end(1,ec);
+    }
+    ok=ok && h.on_document_end(ec);
+    if (!ok)
+    {
+        BOOST_CHECK(ec==std::errc::invalid_argument);
+    }
+    return ok;
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE(TestJsonSaxValidator)
+
+BOOST_AUTO_TEST_CASE(CheckScalars)
+{
+    auto v=validator(
+                _["field1"](gte,5),
+                _["field2"]["field3"](size(gte,4)),
+                _["field2"]["field4"][ALL](lt,10),
+                _["field6"][1](eq,false)
+            );
+    auto h=make_json_sax_validator(v);
+
+    BOOST_CHECK(parse_document(h,10,"value3",3));
+    BOOST_CHECK(!h.failed());
+
+    BOOST_CHECK(!parse_document(h,1,"value3",3));
+    BOOST_CHECK(h.failed());
+    BOOST_CHECK_EQUAL(h.error().message(),std::string("field1 must be greater than or equal to 5"));
+
+    BOOST_CHECK(!parse_document(h,10,"v3",3));
+    BOOST_CHECK_EQUAL(h.error().message(),std::string("size of field3 of field2 must be greater than or equal to 4"));
+
+    BOOST_CHECK(!parse_document(h,10,"value3",12));
+    BOOST_CHECK_EQUAL(h.error().message(),std::string("each element of field4 of field2 must be less than 10"));
+
+    BOOST_CHECK(!parse_document(h,10,"value3",3,true));
+    BOOST_CHECK_EQUAL(h.error().message(),std::string("element #1 of field6 must be equal to false"));
+
+    // handler is reusable after reset
+    h.reset();
+    BOOST_CHECK(!h.failed());
+    BOOST_CHECK(parse_document(h,10,"value3",3));
+}
+
+BOOST_AUTO_TEST_CASE(CheckContainers)
+{
+    auto v=validator(
+                _["field2"]["field4"](size(lte,5)),
+                _["field2"]["field4"](empty(flag,false)),
+                _["field5"](exists,true),
+                _["field7"](exists,false)
+            );
+    auto h=make_json_sax_validator(v);
+
+    BOOST_CHECK(parse_document(h,10,"value3",3));
+
+    BOOST_CHECK(!parse_document(h,10,"value3",6));
+    BOOST_CHECK_EQUAL(h.error().message(),std::string("size of field4 of field2 must be less than or equal to 5"));
+
+    BOOST_CHECK(!parse_document(h,10,"value3",0));
+    BOOST_CHECK_EQUAL(h.error().message(),std::string("field4 of field2 must be not empty"));
+
+    auto v1=validator(_["field5"](exists,false));
+    auto h1=make_json_sax_validator(v1);
+    BOOST_CHECK(!parse_document(h1,10,"value3",3));
+    BOOST_CHECK_EQUAL(h1.error().message(),std::string("field5 must not exist"));
+}
+
+BOOST_AUTO_TEST_CASE(CheckDepth)
+{
+    auto v=validator(
+                _["field2"]["field4"][ALL](lt,2)
+            );
+
+    // members deeper than max depth can not be validated while rules may apply to them, so they fail
+    auto h1=make_json_sax_validator<2>(v);
+    BOOST_CHECK(!parse_document(h1,10,"value3",3));
+    BOOST_CHECK_EQUAL(h1.error().message(),std::string("field2.field4.0 exceeds max depth of validated members"));
+    BOOST_CHECK(parse_document(h1,10,"value3",0));
+
+    auto h2=make_json_sax_validator<3>(v);
+    BOOST_CHECK(!parse_document(h2,10,"value3",3));
+    BOOST_CHECK_EQUAL(h2.error().message(),std::string("each element of field4 of field2 must be less than 2"));
+}
+
+BOOST_AUTO_TEST_CASE(CheckDeepDocument)
+{
+    BOOST_CHECK_EQUAL(json_validated_depth(validator(_["id"](gte,1))),1u);
+    BOOST_CHECK_EQUAL(json_validated_depth(validator(_["a"][ALL]["b"](exists,true))),3u);
+    BOOST_CHECK_EQUAL(json_validated_depth(validator(_["a"](gte,_["b"]["c"]))),2u);
+    BOOST_CHECK_EQUAL(json_validated_depth(validator(NOT(_["a"](gte,_["b"]["c"]["d"])))),3u);
+    BOOST_CHECK_EQUAL(json_validated_depth(validator(_["a"](gte,1) || _["b"][1][2](size(lt,2)))),3u);
+
+    // members below the deepest validated member are skipped regardless of max depth
+    auto v1=validator(_["id"](gte,1));
+    auto h1=make_json_sax_validator(v1);
+    BOOST_CHECK(parse_deep(h1,5));
+    BOOST_CHECK(!parse_deep(h1,0));
+    BOOST_CHECK_EQUAL(h1.error().message(),std::string("id must be greater than or equal to 1"));
+
+    auto v2=validator(_["a"]["b"]["c"]["d"](size(lte,1)));
+    auto h2=make_json_sax_validator(v2);
+    BOOST_CHECK(parse_deep(h2,5));
+
+    // rules deeper than max depth can apply to members of the document
+    auto v3=validator(_["a"]["b"]["c"]["d"]["e"](size(lte,1)));
+    auto h3=make_json_sax_validator(v3);
+    BOOST_CHECK(!parse_deep(h3,5));
+    BOOST_CHECK_EQUAL(h3.error().message(),std::string("a.b.c.d.e exceeds max depth of validated members"));
+    auto h4=make_json_sax_validator<5>(v3);
+    BOOST_CHECK(!parse_deep(h4,5));
+    BOOST_CHECK_EQUAL(h4.error().message(),std::string("size of e of d of c of b of a must be less than or equal to 1"));
+}
+
+BOOST_AUTO_TEST_CASE(CheckExists)
+{
+    auto v1=validator(
+                _["id"](exists,true),
+                _["a"](gte,_["b"])
+            );
+    auto h1=make_json_sax_validator(v1);
+    BOOST_CHECK(!parse_members(h1,"a",1,"b",5));
+    BOOST_CHECK_EQUAL(h1.error().message(),std::string("id must exist"));
+    BOOST_CHECK(parse_members(h1,"id",1,"b",5));
+    BOOST_CHECK(parse_members(h1,"id",1,"",5));
+
+    auto v2=validator(
+                _["c"]["d"](exists,true),
+                _["c"]["e"][1](exists,true),
+                _["c"]["e"][2](exists,false),
+                _["c"]["f"](exists,false)
+            );
+    auto h2=make_json_sax_validator(v2);
+    BOOST_CHECK(parse_members(h2,"a",1,"b",5));
+
+    auto v3=validator(
+                _["c"]["e"][2](exists,true)
+            );
+    auto h3=make_json_sax_validator(v3);
+    BOOST_CHECK(!parse_members(h3,"a",1,"b",5));
+    BOOST_CHECK_EQUAL(h3.error().message(),std::string("element #2 of e of c must exist"));
+
+    auto v4=validator(
+                _["c"]["g"](exists,true)
+            );
+    auto h4=make_json_sax_validator(v4);
+    BOOST_CHECK(!parse_members(h4,"a",1,"b",5));
+    BOOST_CHECK_EQUAL(h4.error().message(),std::string("g of c must exist"));
+}
+
+BOOST_AUTO_TEST_CASE(CheckOtherMember)
+{
+    auto v1=validator(
+                _["a"](gte,_["b"])
+            );
+    auto h1=make_json_sax_validator(v1);
+
+    // operand is parsed after validated member
+    BOOST_CHECK(!parse_members(h1,"a",1,"b",5));
+    BOOST_CHECK_EQUAL(h1.error().message(),std::string("a must be greater than or equal to b"));
+    BOOST_CHECK(parse_members(h1,"a",5,"b",5));
+    BOOST_CHECK(parse_members(h1,"a",1,"",5));
+
+    // operand is parsed before validated member
+    BOOST_CHECK(!parse_members(h1,"b",5,"a",1));
+    BOOST_CHECK_EQUAL(h1.error().message(),std::string("a must be greater than or equal to b"));
+    BOOST_CHECK(parse_members(h1,"b",1,"a",5));
+
+    auto v2=validator(
+                _["c"]["e"][ALL](lt,_["c"]["d"]),
+                _["c"]["d"](lte,_["b"])
+            );
+    auto h2=make_json_sax_validator(v2);
+    BOOST_CHECK(parse_members(h2,"a",1,"b",5,5,1));
+    BOOST_CHECK(!parse_members(h2,"a",1,"b",5,5,4));
+    BOOST_CHECK_EQUAL(h2.error().message(),std::string("each element of e of c must be less than d of c"));
+    BOOST_CHECK(!parse_members(h2,"a",1,"b",4,5,1));
+    BOOST_CHECK_EQUAL(h2.error().message(),std::string("d of c must be less than or equal to b"));
+
+    auto v3=validator(
+                _["c"]["e"][ALL](gt,_["a"])
+            );
+    auto h3=make_json_sax_validator(v3);
+    BOOST_CHECK(parse_members(h3,"a",0,"b",5));
+    BOOST_CHECK(!parse_members(h3,"a",1,"b",5));
+    BOOST_CHECK(!parse_members(h3,"b",1,"a",1));
+    BOOST_CHECK_EQUAL(h3.error().message(),std::string("each element of e of c must be greater than a"));
+}
+
+BOOST_AUTO_TEST_CASE(CheckMasterSample)
+{
+    std::map<std::string,int64_t> sample{{"a",3},{"b",5}};
+    auto v=validator(
+                _["a"](gte,_(sample)),
+                _["b"](eq,_(sample))
+            );
+    auto h=make_json_sax_validator(v);
+    BOOST_CHECK(parse_members(h,"a",3,"b",5));
+    BOOST_CHECK(!parse_members(h,"a",1,"b",5));
+    BOOST_CHECK(!parse_members(h,"a",3,"b",6));
+    BOOST_CHECK(parse_members(h,"",3,"",6));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -6,6 +6,7 @@
 #include <hatn/validator/interval.hpp>
 #include <hatn/validator/operators/in.hpp>
 #include <hatn/validator/operators/lex_in.hpp>
+#include <hatn/validator/reporting/quotes_decorator.hpp>
 
 using namespace HATN_VALIDATOR_NAMESPACE;
 
@@ -406,4 +407,33 @@ BOOST_AUTO_TEST_CASE(CheckInRangeReport)
     rep.clear();
 }
 
+BOOST_AUTO_TEST_CASE(CheckInRangeDecoratedReport)
+{
+    std::string rep;
+    std::string val="hello";
+
+    auto v1=validator(lex_in,range({"one","two","three"},2));
+    auto v2=validator(lex_in,interval("a","b",interval.open()));
+    auto v3=validator(lex_in,range({" one","two "}));
+
+    auto a1=make_reporting_adapter(val,rep);
+    BOOST_CHECK(!v1.apply(a1));
+    BOOST_CHECK_EQUAL(rep,"must be in range [one, two, ... ]");
+    rep.clear();
+    BOOST_CHECK(!v2.apply(a1));
+    BOOST_CHECK_EQUAL(rep,"must be in interval (a,b)");
+    rep.clear();
+    BOOST_CHECK(!v3.apply(a1));
+    BOOST_CHECK_EQUAL(rep,"must be in range [one, two]");
+    rep.clear();
+
+    auto a2=make_reporting_adapter(val,make_reporter(rep,make_formatter(get_default_member_names(),make_operand_formatter(quotes_decorator))));
+    BOOST_CHECK(!v1.apply(a2));
+    BOOST_CHECK_EQUAL(rep,"must be in range \"[\"one\", \"two\", ... ]\"");
+    rep.clear();
+    BOOST_CHECK(!v2.apply(a2));
+    BOOST_CHECK_EQUAL(rep,"must be in interval \"(\"a\",\"b\")\"");
+    rep.clear();
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,138 @@
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <hatn/validator/validator.hpp>
+#include <hatn/validator/validate.hpp>
+#include <hatn/validator/binary/packed_record.hpp>
+
+using namespace HATN_VALIDATOR_NAMESPACE;
+
+namespace {
+
+enum class side : uint8_t
+{
+    buy=1,
+    sell=2
+};
+
+// order message: uint32 id (big endian), uint8 side, char symbol[8], int64 price (little endian), double quantity (big endian)
+constexpr packed_field<uint32_t,0,byte_order::big> order_id{"order id"};
+constexpr packed_field<uint8_t,4> order_side{"side"};
+constexpr packed_field<side,4> order_side_enum{"side"};
+constexpr packed_field<bool,4> order_side_set{"side set"};
+constexpr packed_string<5,8> symbol{"symbol"};
+constexpr packed_field<int64_t,13,byte_order::little> price{"price"};
+constexpr packed_field<double,21,byte_order::big> quantity{"quantity"};
+
+std::vector<unsigned char> make_order(uint32_t id, side s, const char* sym, int64_t px, double qty)
+{
+    // leading byte makes all fields unaligned
+    std::vector<unsigned char> buf(30,0);
+    auto msg=buf.data()+1;
+
+    msg[0]=static_cast<unsigned char>(id>>24);
+    msg[1]=static_cast<unsigned char>(id>>16);
+    msg[2]=static_cast<unsigned char>(id>>8);
+    msg[3]=static_cast<unsigned char>(id);
+    msg[4]=static_cast<unsigned char>(s);
+    std::memcpy(msg+5,sym,std::min(std::strlen(sym),size_t(8)));
+    auto upx=static_cast<uint64_t>(px);
+    for (size_t i=0;i<8;i++)
+    {
+        msg[13+i]=static_cast<unsigned char>(upx>>(8*i));
+    }
+    uint64_t uqty;
+    std::memcpy(&uqty,&qty,sizeof(qty));
+    for (size_t i=0;i<8;i++)
+    {
+        msg[21+i]=static_cast<unsigned char>(uqty>>(8*(7-i)));
+    }
+    return buf;
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE(TestPackedRecord)
+
+BOOST_AUTO_TEST_CASE(CheckFields)
+{
+    auto buf=make_order(0x01020304,side::sell,"ABCD",-15,2.5);
+    auto record=make_packed_record(buf.data()+1,29);
+
+    BOOST_CHECK_EQUAL(record.at(order_id),0x01020304u);
+    BOOST_CHECK_EQUAL(record.at(order_side),2);
+    BOOST_CHECK(record.at(order_side_enum)==side::sell);
+    BOOST_CHECK_EQUAL(record.at(symbol),string_view("ABCD"));
+    BOOST_CHECK_EQUAL(record.at(price),-15);
+    BOOST_CHECK_EQUAL(record.at(quantity),2.5);
+
+    BOOST_CHECK(record.contains(quantity));
+    BOOST_CHECK(!make_packed_record(buf.data()+1,28).contains(quantity));
+    BOOST_CHECK(make_packed_record(buf.data()+1,28).contains(price));
+
+    auto full=make_order(1,side::buy,"ABCDEFGHIJ",1,1.0);
+    BOOST_CHECK_EQUAL(make_packed_record(full.data()+1,29).at(symbol),string_view("ABCDEFGH"));
+}
+
+BOOST_AUTO_TEST_CASE(CheckValidation)
+{
+    auto v=validator(
+                _[order_id](gt,0),
+                _[order_side](in,range({1,2})),
+                _[symbol](size(gte,1)),
+                _[price](gt,0),
+                _[quantity](gt,0.0),
+                _[quantity](lte,_[price])
+            );
+    error_report err;
+
+    auto buf1=make_order(100,side::buy,"ABCD",10,2.5);
+    validate(make_packed_record(buf1.data()+1,29),v,err);
+    BOOST_CHECK(!err);
+
+    auto buf2=make_order(100,side::buy,"ABCD",-10,2.5);
+    validate(make_packed_record(buf2.data()+1,29),v,err);
+    BOOST_CHECK_EQUAL(err.message(),std::string("price must be greater than 0"));
+
+    auto buf3=make_order(0,side::buy,"ABCD",10,2.5);
+    validate(make_packed_record(buf3.data()+1,29),v,err);
+    BOOST_CHECK_EQUAL(err.message(),std::string("order id must be greater than 0"));
+
+    auto buf4=make_order(100,side::buy,"",10,2.5);
+    validate(make_packed_record(buf4.data()+1,29),v,err);
+    BOOST_CHECK_EQUAL(err.message(),std::string("size of symbol must be greater than or equal to 1"));
+
+    auto buf5=make_order(100,side::buy,"ABCD",10,20.5);
+    validate(make_packed_record(buf5.data()+1,29),v,err);
+    BOOST_CHECK_EQUAL(err.message(),std::string("quantity must be less than or equal to price"));
+
+    // truncated record
+    validate(make_packed_record(buf1.data()+1,20),v,err);
+    BOOST_CHECK(!err);
+    validate(make_packed_record(buf1.data()+1,20),validator(_[quantity](exists,true)),err);
+    BOOST_CHECK_EQUAL(err.message(),std::string("quantity must exist"));
+}
+
+BOOST_AUTO_TEST_CASE(CheckBoolField)
+{
+    // byte of side is 2, bool field must not be read as a raw copy of it
+    auto buf1=make_order(100,side::sell,"ABCD",10,2.5);
+    auto record1=make_packed_record(buf1.data()+1,29);
+    BOOST_CHECK(record1.at(order_side_set)==true);
+
+    auto buf2=make_order(100,static_cast<side>(0),"ABCD",10,2.5);
+    auto record2=make_packed_record(buf2.data()+1,29);
+    BOOST_CHECK(record2.at(order_side_set)==false);
+
+    auto v=validator(_[order_side_set](eq,true));
+    error_report err;
+    validate(record1,v,err);
+    BOOST_CHECK(!err);
+    validate(record2,v,err);
+    BOOST_CHECK_EQUAL(err.message(),std::string("side set must be equal to true"));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -1,3 +1,6 @@
+#include <string>
+#include <vector>
+
 #include <boost/test/unit_test.hpp>
 
 #include <hatn/validator/validator.hpp>
@@ -5,6 +8,7 @@
 #include <hatn/validator/adapters/reporting_adapter.hpp>
 
 #include <hatn/validator/filter_path.hpp>
+#include <hatn/validator/filter_path_index.hpp>
 
 using namespace HATN_VALIDATOR_NAMESPACE;
 
@@ -187,6 +191,153 @@ BOOST_AUTO_TEST_CASE(CheckNestedPaths)
             );
     BOOST_CHECK(v1.apply(a11));
 }
+BOOST_AUTO_TEST_CASE(CheckPathIndex)
+{
+    auto paths=member_path_list(
+                    _["level1"]["field1"],
+                    _["level2"],
+                    _["level3"][ALL]["field5"],
+                    _["level4"][1],
+                    _["level5"][size]
+                );
+    auto index=make_filter_path_index(paths);
+    BOOST_CHECK_EQUAL(index.size(),5u);
+    BOOST_CHECK(!index.empty());
+    BOOST_CHECK(filter_path_index().empty());
+
+    BOOST_CHECK(index.has_path(_["level1"]["field1"].path()));
+    BOOST_CHECK(index.has_path(_["level1"]["field1"]["field2"].path()));
+    BOOST_CHECK(!index.has_path(_["level1"].path()));
+    BOOST_CHECK(!index.has_path(_["level1"]["field2"].path()));
+    BOOST_CHECK(index.has_path(_["level2"].path()));
+    BOOST_CHECK(index.has_path(_["level2"][10].path()));
+    BOOST_CHECK(!index.has_path(_["level"].path()));
+
+    // wildcards in index
+    BOOST_CHECK(index.has_path(_["level3"]["any"]["field5"].path()));
+    BOOST_CHECK(index.has_path(_["level3"][100]["field5"][size].path()));
+    BOOST_CHECK(!index.has_path(_["level3"][100]["field6"].path()));
+
+    // wildcards in path
+    BOOST_CHECK(index.has_path(_["level1"][ALL].path()));
+    BOOST_CHECK(index.has_path(_[ANY]["field5"].path()));
+    BOOST_CHECK(!index.has_path(_["level3"][ANY].path()));
+    BOOST_CHECK(index.has_path(_["level3"][ANY][ANY].path()));
+
+    // integral and property keys
+    BOOST_CHECK(index.has_path(_["level4"][1].path()));
+    BOOST_CHECK(index.has_path(_["level4"][size_t(1)].path()));
+    BOOST_CHECK(!index.has_path(_["level4"][2].path()));
+    BOOST_CHECK(!index.has_path(_["level4"]["1"].path()));
+    BOOST_CHECK(index.has_path(_["level5"][size].path()));
+    BOOST_CHECK(!index.has_path(_["level5"][empty].path()));
+    BOOST_CHECK(!index.has_path(_["level5"]["size"].path()));
+
+    // the same results as with list of paths
+    auto check_same=[&](auto&& member)
+    {
+        BOOST_CHECK_EQUAL(index.has_path(member.path()),has_path(paths,member.path()));
+    };
+    check_same(_["level1"]["field1"]);
+    check_same(_["level1"]["field1"][size]);
+    check_same(_["level1"]["field2"]);
+    check_same(_["level2"][ALL]);
+    check_same(_["level3"][ALL]["field5"]);
+    check_same(_["level3"][1]["field6"]);
+    check_same(_["level4"][1]);
+    check_same(_["level4"][2]);
+    check_same(_["level5"][size]);
+    check_same(_["level5"][empty]);
+    check_same(_[ALL][ALL]);
+
+    // index from container of paths
+    std::vector<std::decay_t<decltype(_["level1"]["field1"].path())>> paths2;
+    for (size_t i=0;i<500;i++)
+    {
+        paths2.push_back(_[std::string("level")+std::to_string(i)][std::string("field")+std::to_string(i)].path());
+    }
+    auto index2=make_filter_path_index(paths2);
+    BOOST_CHECK_EQUAL(index2.size(),500u);
+    for (size_t i=0;i<500;i++)
+    {
+        auto level=std::string("level")+std::to_string(i);
+        BOOST_CHECK(index2.has_path(_[level][std::string("field")+std::to_string(i)].path()));
+        BOOST_CHECK(!index2.has_path(_[level][std::string("field")+std::to_string(i+1)].path()));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(CheckIndexedPaths)
+{
+    auto v1=validator(
+        _["level1"]["field1"](exists,true),
+        _["level1"]["field2"](exists,true),
+        _["level2"]["field3"](exists,true)
+    );
+
+    std::map<std::string,std::set<std::string>> m1{
+        {"level1",{"field1","field2"}},
+        {"level2",{"field4"}},
+    };
+    auto a1=make_default_adapter(m1);
+    BOOST_CHECK(!v1.apply(a1));
+
+    auto a2=include_paths(a1,
+                make_filter_path_index(member_path_list(_["level1"]))
+            );
+    BOOST_CHECK(v1.apply(a2));
+    auto a3=include_paths(a1,
+                make_filter_path_index(member_path_list(_["level2"]))
+            );
+    BOOST_CHECK(!v1.apply(a3));
+    auto a4=include_paths(a1,
+                make_filter_path_index(member_path_list(_["level2"]["field4"]))
+            );
+    BOOST_CHECK(v1.apply(a4));
+
+    auto a5=exclude_paths(a1,
+                make_filter_path_index(member_path_list(_["level2"]["field3"]))
+            );
+    BOOST_CHECK(v1.apply(a5));
+    auto a6=exclude_paths(a1,
+                make_filter_path_index(member_path_list(_["level2"]["field4"]))
+            );
+    BOOST_CHECK(!v1.apply(a6));
+    auto a7=exclude_paths(a1,
+                make_filter_path_index(member_path_list(_["level2"][ALL]))
+            );
+    BOOST_CHECK(v1.apply(a7));
+
+    auto a8=include_and_exclude_paths(a1,
+                make_filter_path_index(member_path_list(_["level1"],_["level2"])),
+                make_filter_path_index(member_path_list(_["level2"]["field3"]))
+            );
+    BOOST_CHECK(v1.apply(a8));
+    auto a9=include_and_exclude_paths(a1,
+                make_filter_path_index(member_path_list(_["level1"],_["level2"])),
+                member_path_list(_["level1"]["field2"])
+            );
+    BOOST_CHECK(!v1.apply(a9));
+
+    // index passed as lvalue is referred to by adapter rather than copied
+    auto index=make_filter_path_index(member_path_list(_["level2"]["field4"]));
+    auto a11=include_paths(a1,index);
+    static_assert(std::is_same<
+                    std::decay_t<decltype(traits_of(a11))>,
+                    filter_path_traits<std::decay_t<decltype(traits_of(a1))>,std::reference_wrapper<const filter_path_index>,std::tuple<>>
+                  >::value,"");
+    BOOST_CHECK(v1.apply(a11));
+    index.add(_["level2"]["field3"].path());
+    BOOST_CHECK(!v1.apply(a11));
+    BOOST_CHECK(v1.apply(include_and_exclude_paths(a1,index,index)));
+    BOOST_CHECK(v1.apply(exclude_paths(a1,index)));
+
+    std::string rep;
+    auto a10=include_paths(make_reporting_adapter(m1,rep),
+                make_filter_path_index(member_path_list(_["level2"]))
+            );
+    BOOST_CHECK(!v1.apply(a10));
+    BOOST_CHECK_EQUAL(std::string("field3 of level2 must exist"),rep);
+}
 #endif
 
 BOOST_AUTO_TEST_SUITE_END()
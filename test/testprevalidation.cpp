@@ -6,6 +6,8 @@
 #include <hatn/validator/validator.hpp>
 #include <hatn/validator/adapters/prevalidation_adapter.hpp>
 #include <hatn/validator/prevalidation/set_validated.hpp>
+#include <hatn/validator/interval.hpp>
+#include <hatn/validator/operators/in.hpp>
 
 namespace hana=boost::hana;
 
@@ -529,6 +531,200 @@ BOOST_AUTO_TEST_CASE(CheckSingleMemberAnyAllReport)
     rep1.clear();
 }
 
+BOOST_AUTO_TEST_CASE(CheckLargeRangePrevalidation)
+{
+    std::string rep1;
+
+    // ranges longer than a block are validated block by block
+    std::vector<int> ints;
+    for (int i=0;i<1000;i++)
+    {
+        ints.push_back(i);
+    }
+    std::vector<double> doubles(ints.begin(),ints.end());
+
+    auto v1=validator(
+                _["field1"](ALL(value(gte,0)))
+            );
+    auto pa1=make_prevalidation_adapter(_["field1"],range(ints),rep1);
+    BOOST_CHECK(v1.apply(pa1));
+    rep1.clear();
+    auto pa2=make_prevalidation_adapter(_["field1"],range(doubles),rep1);
+    BOOST_CHECK(v1.apply(pa2));
+    rep1.clear();
+
+    auto v2=validator(
+                _["field1"](ALL(value(in,interval(0,999))))
+            );
+    BOOST_CHECK(v2.apply(pa1));
+    rep1.clear();
+    BOOST_CHECK(v2.apply(pa2));
+    rep1.clear();
+
+    auto v3=validator(
+                _["field1"](ALL(value(in,interval(0,999,interval.open_to()))))
+            );
+    BOOST_CHECK(!v3.apply(pa1));
+    BOOST_CHECK_EQUAL(rep1,std::string("each element of field1 must be in interval [0,999)"));
+    rep1.clear();
+
+    auto v4=validator(
+                _["field1"](ALL(value(lte,999)))
+            );
+    BOOST_CHECK(v4.apply(pa1));
+    rep1.clear();
+
+    // failed element in the middle block
+    auto ints_mid=ints;
+    ints_mid[500]=-1;
+    auto pa3=make_prevalidation_adapter(_["field1"],range(ints_mid),rep1);
+    BOOST_CHECK(!v1.apply(pa3));
+    BOOST_CHECK_EQUAL(rep1,std::string("each element of field1 must be greater than or equal to 0"));
+    rep1.clear();
+    BOOST_CHECK(!v2.apply(pa3));
+    BOOST_CHECK_EQUAL(rep1,std::string("each element of field1 must be in interval [0,999]"));
+    rep1.clear();
+
+    // failed element in the tail that does not fill a block
+    auto ints_tail=ints;
+    ints_tail.back()=1000;
+    auto pa4=make_prevalidation_adapter(_["field1"],range(ints_tail),rep1);
+    BOOST_CHECK(!v2.apply(pa4));
+    BOOST_CHECK_EQUAL(rep1,std::string("each element of field1 must be in interval [0,999]"));
+    rep1.clear();
+    auto v5=validator(
+                _["field1"](ALL(value(nin,interval(1000,2000))))
+            );
+    BOOST_CHECK(v5.apply(pa1));
+    rep1.clear();
+    BOOST_CHECK(!v5.apply(pa4));
+    BOOST_CHECK_EQUAL(rep1,std::string("each element of field1 must be not in interval [1000,2000]"));
+    rep1.clear();
+
+    // strict ANY
+    auto v6=validator(
+                _["field1"](ANY(value(eq,1000)))
+            );
+    auto pa5=make_prevalidation_adapter(_["field1"],strict_any(range(ints)),rep1);
+    BOOST_CHECK(!v6.apply(pa5));
+    BOOST_CHECK_EQUAL(rep1,std::string("at least one element of field1 must be equal to 1000"));
+    rep1.clear();
+    auto pa6=make_prevalidation_adapter(_["field1"],strict_any(range(ints_tail)),rep1);
+    BOOST_CHECK(v6.apply(pa6));
+    rep1.clear();
+    auto v7=validator(
+                _["field1"](ANY(value(in,interval(-10,-1))))
+            );
+    auto pa7=make_prevalidation_adapter(_["field1"],strict_any(range(ints_mid)),rep1);
+    BOOST_CHECK(v7.apply(pa7));
+    rep1.clear();
+    BOOST_CHECK(!v7.apply(pa5));
+    BOOST_CHECK_EQUAL(rep1,std::string("at least one element of field1 must be in interval [-10,-1]"));
+    rep1.clear();
+
+    // empty range
+    std::vector<int> empty;
+    auto pa8=make_prevalidation_adapter(_["field1"],range(empty),rep1);
+    BOOST_CHECK(v1.apply(pa8));
+    rep1.clear();
+    auto pa9=make_prevalidation_adapter(_["field1"],strict_any(range(empty)),rep1);
+    BOOST_CHECK(!v6.apply(pa9));
+    rep1.clear();
+}
+
+BOOST_AUTO_TEST_CASE(CheckParallelRangePrevalidation)
+{
+    std::string rep1;
+
+    std::vector<int> ints;
+    for (int i=0;i<10000;i++)
+    {
+        ints.push_back(i%1000);
+    }
+
+    // numbers are validated block by block in each chunk
+    auto v1=validator(
+                _["field1"](ALL(value(gte,0)))
+            );
+    auto pa1=make_prevalidation_adapter(_["field1"],parallel_range(ints,4),rep1);
+    BOOST_CHECK(v1.apply(pa1));
+    rep1.clear();
+    auto v2=validator(
+                _["field1"](ALL(value(in,interval(0,999))))
+            );
+    BOOST_CHECK(v2.apply(pa1));
+    rep1.clear();
+
+    // failed element in the first chunk and in the last chunk
+    auto ints_first=ints;
+    ints_first[10]=-1;
+    auto pa2=make_prevalidation_adapter(_["field1"],parallel_range(ints_first,4),rep1);
+    BOOST_CHECK(!v1.apply(pa2));
+    BOOST_CHECK_EQUAL(rep1,std::string("each element of field1 must be greater than or equal to 0"));
+    rep1.clear();
+    auto ints_last=ints;
+    ints_last.back()=1000;
+    auto pa3=make_prevalidation_adapter(_["field1"],parallel_range(ints_last,4),rep1);
+    BOOST_CHECK(!v2.apply(pa3));
+    BOOST_CHECK_EQUAL(rep1,std::string("each element of field1 must be in interval [0,999]"));
+    rep1.clear();
+
+    // strict ANY matched only in the last chunk
+    auto v3=validator(
+                _["field1"](ANY(value(eq,1000)))
+            );
+    auto pa4=make_prevalidation_adapter(_["field1"],strict_any(parallel_range(ints_last,4)),rep1);
+    BOOST_CHECK(v3.apply(pa4));
+    rep1.clear();
+    auto pa5=make_prevalidation_adapter(_["field1"],strict_any(parallel_range(ints,4)),rep1);
+    BOOST_CHECK(!v3.apply(pa5));
+    BOOST_CHECK_EQUAL(rep1,std::string("at least one element of field1 must be equal to 1000"));
+    rep1.clear();
+
+    // expensive operators are validated element by element in each chunk
+    std::vector<int> allowed;
+    for (int i=0;i<1000;i++)
+    {
+        allowed.push_back(i);
+    }
+    auto v4=validator(
+                _["field1"](ALL(value(in,range(allowed))))
+            );
+    BOOST_CHECK(v4.apply(pa1));
+    rep1.clear();
+    auto v5=validator(
+                _["field1"](ALL(value(in,range(allowed,3))))
+            );
+    BOOST_CHECK(!v5.apply(pa3));
+    BOOST_CHECK_EQUAL(rep1,std::string("each element of field1 must be in range [0, 1, 2, ... ]"));
+    rep1.clear();
+
+    std::vector<std::string> strs(1000,"value");
+    auto v6=validator(
+                _["field1"](ALL(size(gte,1)))
+            );
+    auto pa6=make_prevalidation_adapter(_["field1"],parallel_range(strs,8),rep1);
+    BOOST_CHECK(v6.apply(pa6));
+    rep1.clear();
+    strs[999].clear();
+    BOOST_CHECK(!v6.apply(pa6));
+    BOOST_CHECK_EQUAL(rep1,std::string("size of each element of field1 must be greater than or equal to 1"));
+    rep1.clear();
+
+    // containers without random access are validated in the calling thread
+    std::set<int> set1(ints.begin(),ints.end());
+    auto pa7=make_prevalidation_adapter(_["field1"],parallel_range(set1,4),rep1);
+    BOOST_CHECK(v4.apply(pa7));
+    rep1.clear();
+
+    // ranges smaller than a chunk are not split
+    std::vector<int> small{1,2,-3};
+    auto pa8=make_prevalidation_adapter(_["field1"],parallel_range(small,4),rep1);
+    BOOST_CHECK(!v1.apply(pa8));
+    BOOST_CHECK_EQUAL(rep1,std::string("each element of field1 must be greater than or equal to 0"));
+    rep1.clear();
+}
+
 BOOST_AUTO_TEST_CASE(CheckUpdateValidatedWithSample)
 {
     error_report err;
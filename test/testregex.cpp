@@ -4,6 +4,7 @@
 #include <hatn/validator/adapters/reporting_adapter.hpp>
 #include <hatn/validator/operators/regex.hpp>
 #include <hatn/validator/operators/string_patterns.hpp>
+#include <hatn/validator/validate.hpp>
 
 using namespace HATN_VALIDATOR_NAMESPACE;
 
@@ -214,4 +215,47 @@ BOOST_AUTO_TEST_CASE(CheckHex)
     rep.clear();
 }
 
+BOOST_AUTO_TEST_CASE(CheckPrevalidateStringView)
+{
+    // views of a buffer that are not null-terminated
+    const char buf[]="abc_12 ff00zz";
+    string_view word(buf,6);
+    string_view hex(buf+7,4);
+    string_view text(buf,13);
+
+    error_report err;
+
+    validate(_["field1"],word,validator(_["field1"](str_alpha,true)),err);
+    BOOST_CHECK(!err);
+    validate(_["field1"],text,validator(_["field1"](str_alpha,true)),err);
+    BOOST_CHECK(err);
+    BOOST_CHECK_EQUAL(err.message(),std::string("field1 must contain only letters and digits"));
+
+    validate(_["field1"],hex,validator(_["field1"](str_hex,true)),err);
+    BOOST_CHECK(!err);
+    validate(_["field1"],string_view(buf+7,6),validator(_["field1"](str_hex,true)),err);
+    BOOST_CHECK(err);
+    validate(_["field1"],string_view(buf,0),validator(_["field1"](str_hex,true)),err);
+    BOOST_CHECK(err);
+
+    validate(_["field1"],word,validator(_["field1"](regex_match,"[a-z_0-9]+")),err);
+    BOOST_CHECK(!err);
+    validate(_["field1"],word,validator(_["field1"](regex_match,std::regex("[a-z_0-9]+"))),err);
+    BOOST_CHECK(!err);
+    validate(_["field1"],word,validator(_["field1"](regex_match,boost::regex("[a-z_0-9]+"))),err);
+    BOOST_CHECK(!err);
+    validate(_["field1"],text,validator(_["field1"](regex_match,string_view("[a-z_0-9]+"))),err);
+    BOOST_CHECK(err);
+    BOOST_CHECK_EQUAL(err.message(),std::string("field1 must match expression [a-z_0-9]+"));
+
+    validate(_["field1"],word,validator(_["field1"](regex_contains,"[0-9]")),err);
+    BOOST_CHECK(!err);
+    validate(_["field1"],word,validator(_["field1"](regex_contains,std::regex("[0-9]"))),err);
+    BOOST_CHECK(!err);
+    validate(_["field1"],word,validator(_["field1"](regex_contains,boost::regex("[0-9]"))),err);
+    BOOST_CHECK(!err);
+    validate(_["field1"],word,validator(_["field1"](regex_ncontains,boost::regex("f"))),err);
+    BOOST_CHECK(!err);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
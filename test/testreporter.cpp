@@ -3,6 +3,9 @@
 #include <hatn/validator/validator.hpp>
 #include <hatn/validator/reporting/reporter.hpp>
 #include <hatn/validator/reporting/reporter_with_object_name.hpp>
+#include <hatn/validator/reporting/fixed_buffer.hpp>
+#include <hatn/validator/reporting/inline_buffer.hpp>
+#include <hatn/validator/reporting/output_iterator_dst.hpp>
 
 using namespace HATN_VALIDATOR_NAMESPACE;
 
@@ -106,4 +109,126 @@ BOOST_AUTO_TEST_CASE(CheckReporterWithObjectName)
     rep1.clear();
 }
 
+namespace
+{
+
+template <typename DstT, typename ToStringT>
+void checkReporterDst(DstT& dst, const ToStringT& to_string)
+{
+    auto r1=make_reporter(dst);
+    r1.validate("field1",value,gte,10);
+    BOOST_CHECK_EQUAL(to_string(),std::string("field1 must be greater than or equal to 10"));
+}
+
+template <typename DstT, typename ToStringT>
+void checkReporterDstAggregate(DstT& dst, const ToStringT& to_string)
+{
+    auto r1=make_reporter(dst);
+    r1.aggregate_open(string_not);
+    r1.aggregate_open(string_or);
+    r1.validate("field1",value,gte,10);
+    r1.validate("field1",size,lt,100);
+    r1.aggregate_open(string_and);
+        r1.validate("field10",value,gte,5);
+        r1.validate("field10",size,lt,50);
+    r1.aggregate_close(false);
+    r1.aggregate_close(false);
+    r1.aggregate_close(false);
+    BOOST_CHECK_EQUAL(to_string(),std::string("NOT (field1 must be greater than or equal to 10 OR size of field1 must be less than 100 OR (field10 must be greater than or equal to 5 AND size of field10 must be less than 50))"));
+}
+
+}
+
+BOOST_AUTO_TEST_CASE(CheckReporterFixedBuffer)
+{
+    char buf1[128];
+    fixed_buffer dst1{buf1};
+    auto to_string1=[&dst1]()
+    {
+        return std::string(dst1.data(),dst1.size());
+    };
+    checkReporterDst(dst1,to_string1);
+    BOOST_CHECK(!dst1.truncated());
+    BOOST_CHECK_EQUAL(std::string(buf1),std::string("field1 must be greater than or equal to 10"));
+
+    char buf2[256];
+    fixed_buffer dst2{buf2};
+    auto to_string2=[&dst2]()
+    {
+        return std::string(dst2.c_str());
+    };
+    checkReporterDstAggregate(dst2,to_string2);
+    BOOST_CHECK(!dst2.truncated());
+
+    char buf3[16];
+    fixed_buffer dst3{buf3};
+    auto r3=make_reporter(dst3);
+    r3.validate("field1",value,gte,10);
+    BOOST_CHECK(dst3.truncated());
+    BOOST_CHECK_EQUAL(dst3.size(),14u);
+    BOOST_CHECK_EQUAL(std::string(buf3),std::string("field1 must be"));
+
+    dst3.clear();
+    BOOST_CHECK(!dst3.truncated());
+    BOOST_CHECK(dst3.empty());
+    BOOST_CHECK_EQUAL(std::string(buf3),std::string());
+}
+
+BOOST_AUTO_TEST_CASE(CheckReporterInlineBuffer)
+{
+    inline_buffer<> dst1;
+    auto to_string1=[&dst1]()
+    {
+        return std::string(dst1.data(),dst1.size());
+    };
+    checkReporterDst(dst1,to_string1);
+    BOOST_CHECK(dst1.is_inline());
+
+    inline_buffer<16> dst2;
+    auto to_string2=[&dst2]()
+    {
+        return std::string(dst2.data(),dst2.size());
+    };
+    checkReporterDstAggregate(dst2,to_string2);
+    BOOST_CHECK(!dst2.is_inline());
+
+    auto str2=to_string2();
+    auto dst3=std::move(dst2);
+    BOOST_CHECK(dst2.empty());
+    BOOST_CHECK_EQUAL(std::string(dst3.data(),dst3.size()),str2);
+    auto dst4=dst1;
+    BOOST_CHECK(dst4.is_inline());
+    BOOST_CHECK_EQUAL(std::string(dst4.data(),dst4.size()),to_string1());
+}
+
+BOOST_AUTO_TEST_CASE(CheckReporterOutputIterator)
+{
+    std::vector<char> frame1;
+    auto dst1=make_output_iterator_dst(std::back_inserter(frame1));
+    auto to_string1=[&frame1]()
+    {
+        return std::string(frame1.data(),frame1.size());
+    };
+    checkReporterDst(dst1,to_string1);
+    BOOST_CHECK_EQUAL(dst1.size(),frame1.size());
+
+    char buf2[256];
+    auto dst2=make_output_iterator_dst(&buf2[0]);
+    auto to_string2=[&buf2,&dst2]()
+    {
+        return std::string(&buf2[0],dst2.iterator());
+    };
+    checkReporterDstAggregate(dst2,to_string2);
+
+    std::string str3;
+    auto dst3=make_output_iterator_dst(std::back_inserter(str3));
+    dst3.append("  one  ",7);
+    dst3.push_back('2');
+    dst3.append(" three ",7);
+    BOOST_CHECK_EQUAL(str3,std::string("one  2 three"));
+    dst3.trim();
+    dst3.push_back('4');
+    BOOST_CHECK_EQUAL(str3,std::string("one  2 three4"));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
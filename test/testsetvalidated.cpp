@@ -1,20 +1,29 @@
 #include <set>
+#include <stdexcept>
 #include <iterator>
 
 #include <boost/test/unit_test.hpp>
 
 #include <hatn/validator/validator.hpp>
 #include <hatn/validator/prevalidation/set_validated.hpp>
+#include <hatn/validator/prevalidation/set_validated_batch.hpp>
 
 namespace hana=boost::hana;
 
 HATN_VALIDATOR_PROPERTY(field1)
+HATN_VALIDATOR_PROPERTY(field2)
 
 namespace {
 struct TestSetValidatorStruct
 {
     size_t field1=0;
 };
+
+struct TestSetValidatorThrowStruct
+{
+    size_t field1=0;
+    size_t field2=0;
+};
 }
 
 HATN_VALIDATOR_NAMESPACE_BEGIN
@@ -33,6 +42,34 @@ struct set_member_t<TestSetValidatorStruct,HATN_VALIDATOR_PROPERTY_TYPE(field1)>
     }
 };
 
+template <>
+struct set_member_t<TestSetValidatorThrowStruct,HATN_VALIDATOR_PROPERTY_TYPE(field1)>
+{
+    template <typename ObjectT, typename MemberT, typename ValueT>
+    void operator() (
+            ObjectT& obj,
+            MemberT&&,
+            ValueT&& val
+        ) const
+    {
+        obj.field1=val;
+    }
+};
+
+template <>
+struct set_member_t<TestSetValidatorThrowStruct,HATN_VALIDATOR_PROPERTY_TYPE(field2)>
+{
+    template <typename ObjectT, typename MemberT, typename ValueT>
+    void operator() (
+            ObjectT&,
+            MemberT&&,
+            ValueT&&
+        ) const
+    {
+        throw std::runtime_error("field2 can not be set");
+    }
+};
+
 HATN_VALIDATOR_NAMESPACE_END
 
 namespace validator_ns {
@@ -206,4 +243,110 @@ BOOST_AUTO_TEST_CASE(CheckSetValidatedEmpty)
     BOOST_CHECK(!err);
 }
 
+BOOST_AUTO_TEST_CASE(CheckSetValidatedBatch)
+{
+    auto v=validator(
+        _["field1"](gte,100),
+        _["field2"](lt,10)
+    );
+
+    error_report err;
+    std::map<std::string,size_t> m;
+
+    set_validated_batch(m,hana::make_tuple(hana::make_pair(_["field1"],1000),hana::make_pair(_["field2"],5)),v,err);
+    BOOST_CHECK(!err);
+    BOOST_CHECK_EQUAL(m["field1"],1000);
+    BOOST_CHECK_EQUAL(m["field2"],5);
+
+    // nothing is written if any member fails
+    set_validated_batch(m,hana::make_tuple(hana::make_pair(_["field1"],2000),hana::make_pair(_["field2"],50)),v,err);
+    BOOST_CHECK(err);
+    BOOST_CHECK_EQUAL(err.message(),std::string("field2 must be less than 10"));
+    BOOST_CHECK_EQUAL(m["field1"],1000);
+    BOOST_CHECK_EQUAL(m["field2"],5);
+
+    // the first failed member is reported
+    set_validated_batch(m,hana::make_tuple(hana::make_pair(_["field1"],20),hana::make_pair(_["field2"],50)),v,err);
+    BOOST_CHECK(err);
+    BOOST_CHECK_EQUAL(err.message(),std::string("field1 must be greater than or equal to 100"));
+
+    BOOST_CHECK_NO_THROW(set_validated_batch(m,hana::make_tuple(hana::make_pair(_["field1"],300),hana::make_pair(_["field2"],7)),v));
+    BOOST_CHECK_EQUAL(m["field1"],300);
+    BOOST_CHECK_EQUAL(m["field2"],7);
+    BOOST_CHECK_THROW(set_validated_batch(m,hana::make_tuple(hana::make_pair(_["field1"],300),hana::make_pair(_["field2"],70)),v),validation_error);
+    BOOST_CHECK_EQUAL(m["field2"],7);
+
+    // values are moved from rvalue batch
+    auto vs=validator(
+        _["field1"](size(gte,3))
+    );
+    std::map<std::string,std::string> ms;
+    auto values=hana::make_tuple(hana::make_pair(_["field1"],std::string("Hello world, long enough to be allocated on heap")));
+    set_validated_batch(ms,std::move(values),vs,err);
+    BOOST_CHECK(!err);
+    BOOST_CHECK_EQUAL(ms["field1"],std::string("Hello world, long enough to be allocated on heap"));
+    BOOST_CHECK(hana::second(hana::at_c<0>(values)).empty());
+
+    // properties of structure
+    TestSetValidatorStruct st;
+    set_validated_batch(st,hana::make_tuple(hana::make_pair(_[field1],1000)),validator(_[field1](gte,100)),err);
+    BOOST_CHECK(!err);
+    BOOST_CHECK_EQUAL(st.field1,1000);
+}
+
+BOOST_AUTO_TEST_CASE(CheckSetValidatedBatchStaged)
+{
+    auto v=validator(
+        _["field1"](gte,100),
+        _["field2"](lt,_["field1"])
+    );
+
+    error_report err;
+    std::map<std::string,size_t> m{
+        {"field1",200},
+        {"field2",150}
+    };
+
+    // each value is valid by itself but condition on other member fails in staged object
+    set_validated_batch_staged(m,hana::make_tuple(hana::make_pair(_["field1"],120),hana::make_pair(_["field2"],130)),v,err);
+    BOOST_CHECK(err);
+    BOOST_CHECK_EQUAL(err.message(),std::string("field2 must be less than field1"));
+    BOOST_CHECK_EQUAL(m["field1"],200);
+    BOOST_CHECK_EQUAL(m["field2"],150);
+
+    set_validated_batch_staged(m,hana::make_tuple(hana::make_pair(_["field1"],120),hana::make_pair(_["field2"],110)),v,err);
+    BOOST_CHECK(!err);
+    BOOST_CHECK_EQUAL(m["field1"],120);
+    BOOST_CHECK_EQUAL(m["field2"],110);
+
+    // pre-validation fails before staging
+    set_validated_batch_staged(m,hana::make_tuple(hana::make_pair(_["field1"],10)),v,err);
+    BOOST_CHECK(err);
+    BOOST_CHECK_EQUAL(err.message(),std::string("field1 must be greater than or equal to 100"));
+    BOOST_CHECK_EQUAL(m["field1"],120);
+
+    BOOST_CHECK_THROW(set_validated_batch_staged(m,hana::make_tuple(hana::make_pair(_["field2"],500)),v),validation_error);
+    BOOST_CHECK_EQUAL(m["field2"],110);
+    BOOST_CHECK_NO_THROW(set_validated_batch_staged(m,hana::make_tuple(hana::make_pair(_["field2"],100)),v));
+    BOOST_CHECK_EQUAL(m["field2"],100);
+}
+
+BOOST_AUTO_TEST_CASE(CheckSetValidatedBatchExceptionSafety)
+{
+    auto v=validator(
+        _[field1](gte,100)
+    );
+    auto values=hana::make_tuple(hana::make_pair(_[field1],1000),hana::make_pair(_[field2],10));
+
+    // members preceding the failed one are already set
+    TestSetValidatorThrowStruct st1;
+    BOOST_CHECK_THROW(set_validated_batch(st1,values,v),std::runtime_error);
+    BOOST_CHECK_EQUAL(st1.field1,1000);
+
+    // staged object is left unchanged
+    TestSetValidatorThrowStruct st2;
+    BOOST_CHECK_THROW(set_validated_batch_staged(st2,values,v),std::runtime_error);
+    BOOST_CHECK_EQUAL(st2.field1,0);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
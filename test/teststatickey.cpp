@@ -0,0 +1,101 @@
+#include <map>
+#include <string>
+#include <unordered_map>
+
+#include <boost/test/unit_test.hpp>
+
+#include <hatn/validator/validator.hpp>
+#include <hatn/validator/validate.hpp>
+#include <hatn/validator/static_key.hpp>
+
+using namespace HATN_VALIDATOR_NAMESPACE;
+
+BOOST_AUTO_TEST_SUITE(TestStaticKey)
+
+BOOST_AUTO_TEST_CASE(CheckKey)
+{
+    auto key1=HATN_KEY("field1");
+    auto key2=HATN_KEY("field2");
+    auto key3=HATN_KEY("field1");
+    using key1_type=decltype(key1);
+
+    static_assert(key1_type::size()==6,"");
+    static_assert(std::is_same<key1_type,decltype(key3)>::value,"");
+    static_assert(key1_type::hash()==decltype(key3)::hash(),"");
+    static_assert(key1_type::hash()!=decltype(key2)::hash(),"");
+    static_assert(key1_type::hash()==static_cast<size_t>(string_hash("field1",6)),"");
+    static_assert(string_hash("",0)==0xcbf29ce484222325ull,"");
+    static_assert(string_hash("a",1)==0xaf63dc4c8601ec8cull,"");
+    static_assert(std::is_empty<key1_type>::value,"");
+    static_assert(!std::is_same<key1_type,decltype(key2)>::value,"");
+
+    BOOST_CHECK(key1.view()==string_view("field1"));
+    BOOST_CHECK(std::string(key1.c_str())==std::string("field1"));
+    BOOST_CHECK(&key1.str()==&key3.str());
+    BOOST_CHECK(key1==std::string("field1"));
+    BOOST_CHECK(std::string("field1")==key1);
+    BOOST_CHECK(key1!="field2");
+    BOOST_CHECK(key1<key2.view());
+    BOOST_CHECK(key1==key3);
+
+    key_hash hasher;
+    BOOST_CHECK(hasher(key1)==hasher(std::string("field1")));
+    BOOST_CHECK(hasher(key1)!=hasher(string_view("field2")));
+
+#ifdef BOOST_HANA_CONFIG_ENABLE_STRING_UDL
+    using namespace literals;
+    static_assert(std::is_same<decltype("field1"_key),key1_type>::value,"");
+#endif
+}
+
+BOOST_AUTO_TEST_CASE(CheckMember)
+{
+    auto m1=_[HATN_KEY("field1")][HATN_KEY("field2")];
+    static_assert(std::is_trivially_destructible<decltype(m1)>::value,"");
+
+    BOOST_CHECK(m1.equals(_[HATN_KEY("field1")][HATN_KEY("field2")]));
+    auto m2=_[HATN_KEY("field1")][HATN_KEY("field3")];
+    BOOST_CHECK(!m1.equals(m2));
+    static_assert(!decltype(same_member_path_types(m1,m2))::value,"");
+    auto m3=_["field1"]["field2"];
+    static_assert(decltype(same_member_path_types(m1,m3))::value,"");
+    BOOST_CHECK(m1.equals(_["field1"]["field2"]));
+    BOOST_CHECK(!m1.equals(_["field1"]["field3"]));
+
+#if __cplusplus >= 201703L
+    constexpr auto m4=_[HATN_KEY("field1")][HATN_KEY("field2")];
+    static_assert(m4.path_depth()==2,"");
+#endif
+}
+
+BOOST_AUTO_TEST_CASE(CheckValidation)
+{
+    auto v=validator(
+                _[HATN_KEY("field1")](gte,"10"),
+                _[HATN_KEY("field2")](size(lte,3))
+            );
+    error_report err;
+
+    std::map<std::string,std::string> m1{{"field1","20"},{"field2","abc"}};
+    validate(m1,v,err);
+    BOOST_CHECK(!err);
+    m1["field2"]="abcd";
+    validate(m1,v,err);
+    BOOST_CHECK_EQUAL(err.message(),std::string("size of field2 must be less than or equal to 3"));
+
+    std::map<std::string,std::string,std::less<>> m2{{"field1","20"},{"field2","abc"}};
+    validate(m2,v,err);
+    BOOST_CHECK(!err);
+    m2["field1"]="05";
+    validate(m2,v,err);
+    BOOST_CHECK_EQUAL(err.message(),std::string("field1 must be greater than or equal to 10"));
+
+    std::unordered_map<std::string,std::string,key_hash> m3{{"field1","20"},{"field2","abc"}};
+    validate(m3,v,err);
+    BOOST_CHECK(!err);
+    m3.erase("field2");
+    validate(m3,validator(_[HATN_KEY("field2")](exists,true)),err);
+    BOOST_CHECK_EQUAL(err.message(),std::string("field2 must exist"));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
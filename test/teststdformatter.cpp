@@ -1,3 +1,9 @@
+#include <sstream>
+#include <limits>
+#include <vector>
+#include <atomic>
+#include <thread>
+
 #include <boost/test/unit_test.hpp>
 
 #include <hatn/validator/config.hpp>
@@ -7,7 +13,9 @@
 
 #include <hatn/validator/reporting/formatter.hpp>
 #include <hatn/validator/reporting/mapped_translator.hpp>
+#include <hatn/validator/reporting/hashed_translator.hpp>
 #include <hatn/validator/reporting/translator_repository.hpp>
+#include <hatn/validator/reporting/formatter_cache.hpp>
 
 using namespace HATN_VALIDATOR_NAMESPACE;
 
@@ -74,4 +82,51 @@ BOOST_AUTO_TEST_CASE(CheckStdFormatterWithRvals)
     checkFormatterWithRvals(make_backend_formatter);
 }
 
+BOOST_AUTO_TEST_CASE(CheckStdFormatterWithHashedTranslator)
+{
+    checkFormatterWithHashedTranslator(make_backend_formatter);
+}
+
+BOOST_AUTO_TEST_CASE(CheckStdFormatterCache)
+{
+    checkFormatterCache(make_backend_formatter);
+}
+
+BOOST_AUTO_TEST_CASE(CheckStdAppendValues)
+{
+    auto check=[](const auto&... args)
+    {
+        std::ostringstream ss;
+        std::string sample;
+        auto fold=[&ss](const auto& v)
+        {
+            ss<<v<<",";
+            return true;
+        };
+        bool folded[]={fold(args)...};
+        std::ignore=folded;
+        sample=ss.str();
+
+        std::string dst{"prefix:"};
+        auto fm=make_backend_formatter(dst);
+        fm.append_join_args(",",args...,"");
+        BOOST_CHECK_EQUAL(dst,std::string("prefix:")+sample);
+    };
+
+    check(0,1,-1,123456789,std::numeric_limits<int>::min(),std::numeric_limits<int>::max());
+    check(std::numeric_limits<long long>::min(),std::numeric_limits<unsigned long long>::max());
+    check(static_cast<short>(-10),static_cast<unsigned short>(10),10u,10l,10ul);
+    check(0.0,-0.0,0.1,1.5,100.0,1234567.0,0.000012345,1e20,-1e-20,3.14159265358979);
+    check(1.5f,0.1f,1e10f,12.5L);
+    check(std::numeric_limits<double>::infinity(),-std::numeric_limits<double>::infinity(),std::numeric_limits<double>::max());
+    check(true,false,'a',static_cast<unsigned char>('b'),static_cast<signed char>('c'));
+    check("const char",std::string("string"),string_view("view"),concrete_phrase("phrase"),concrete_phrase::ref("ref"));
+
+    std::string dst;
+    auto fm=make_backend_formatter(dst);
+    fm.append_join(" ",std::vector<std::string>{"one","two","three"});
+    fm.append_join(" ",hana::make_tuple(1,2.5,"three"));
+    BOOST_CHECK_EQUAL(dst,std::string("one two three1 2.5 three"));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
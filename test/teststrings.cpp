@@ -122,6 +122,22 @@ BOOST_AUTO_TEST_SUITE(TestStrings)
 BOOST_AUTO_TEST_CASE(CheckDefaultStrings)
 {
     check_strings_bypass(default_strings);
+
+    // static texts of operators and properties are not copied
+    auto gte_phrase=default_strings(gte);
+    BOOST_CHECK(gte_phrase.is_ref());
+    BOOST_CHECK(gte_phrase.view().data()==gte.description);
+    BOOST_CHECK_EQUAL(gte_phrase.grammar_cats(),0u);
+    auto size_phrase=default_strings(size);
+    BOOST_CHECK(size_phrase.is_ref());
+    BOOST_CHECK_EQUAL(size_phrase.text(),size.name());
+
+    // other IDs are converted to strings
+    BOOST_CHECK(!default_strings("field1").is_ref());
+    BOOST_CHECK(!default_strings(_n(gt)).is_ref());
+    BOOST_CHECK_EQUAL(std::string(default_strings(_n(gt))),"must be less than or equal to");
+    BOOST_CHECK(!default_strings(_(gte,"not less than")).is_ref());
+    BOOST_CHECK_EQUAL(std::string(default_strings(_(gte,"not less than"))),"not less than");
 }
 
 BOOST_AUTO_TEST_CASE(CheckTranslatedStrings)
@@ -3,6 +3,7 @@
 #include <hatn/validator/validator.hpp>
 #include <hatn/validator/adapters/reporting_adapter.hpp>
 #include <hatn/validator/operators/number_patterns.hpp>
+#include <hatn/validator/validate.hpp>
 
 using namespace HATN_VALIDATOR_NAMESPACE;
 
@@ -120,4 +121,53 @@ BOOST_AUTO_TEST_CASE(CheckStrFloat)
     rep.clear();
 }
 
+BOOST_AUTO_TEST_CASE(CheckPrevalidateStringView)
+{
+    // views of a buffer that are not null-terminated
+    const char buf[]="-1234.5e10+";
+    error_report err;
+
+    auto v1=validator(
+        _["field1"](str_int,true)
+    );
+    validate(_["field1"],string_view(buf,5),v1,err);
+    BOOST_CHECK(!err);
+    validate(_["field1"],string_view(buf,6),v1,err);
+    BOOST_CHECK(err);
+    BOOST_CHECK_EQUAL(err.message(),std::string("field1 must be integer"));
+    validate(_["field1"],string_view(buf,1),v1,err);
+    BOOST_CHECK(err);
+    validate(_["field1"],string_view(buf+10,1),v1,err);
+    BOOST_CHECK(err);
+    validate(_["field1"],string_view(buf,0),v1,err);
+    BOOST_CHECK(err);
+    validate(_["field1"],std::string("+100"),v1,err);
+    BOOST_CHECK(!err);
+    validate(_["field1"],"100",v1,err);
+    BOOST_CHECK(!err);
+
+    auto v2=validator(
+        _["field1"](str_float,true)
+    );
+    validate(_["field1"],string_view(buf,5),v2,err);
+    BOOST_CHECK(!err);
+    validate(_["field1"],string_view(buf,7),v2,err);
+    BOOST_CHECK(!err);
+    validate(_["field1"],string_view(buf,10),v2,err);
+    BOOST_CHECK(!err);
+    validate(_["field1"],string_view(buf,6),v2,err);
+    BOOST_CHECK(err);
+    BOOST_CHECK_EQUAL(err.message(),std::string("field1 must be a floating point number"));
+    validate(_["field1"],string_view(buf,8),v2,err);
+    BOOST_CHECK(err);
+    validate(_["field1"],string_view(buf,11),v2,err);
+    BOOST_CHECK(err);
+    validate(_["field1"],string_view(buf+5,2),v2,err);
+    BOOST_CHECK(!err);
+    validate(_["field1"],string_view(buf+5,1),v2,err);
+    BOOST_CHECK(err);
+    validate(_["field1"],string_view(buf,0),v2,err);
+    BOOST_CHECK(err);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -4,7 +4,9 @@
 #include <hatn/validator/reporting/translator.hpp>
 #include <hatn/validator/reporting/no_translator.hpp>
 #include <hatn/validator/reporting/mapped_translator.hpp>
+#include <hatn/validator/reporting/hashed_translator.hpp>
 #include <hatn/validator/reporting/phrase_translator.hpp>
+#include <hatn/validator/reporting/static_translator.hpp>
 #include <hatn/validator/reporting/translator_repository.hpp>
 #include <hatn/validator/reporting/member_operand.hpp>
 
@@ -55,6 +57,55 @@ BOOST_AUTO_TEST_CASE(CheckMappedTranslator)
     BOOST_CHECK_EQUAL(not_translated,std::string(tr2(not_translated)));
 }
 
+BOOST_AUTO_TEST_CASE(CheckHashedTranslator)
+{
+    std::string not_translated("not translated");
+    std::map<std::string,std::string> m=
+    {
+        {"one","one_translated"},
+        {"two","two_translated"},
+        {"three","three_translated"}
+    };
+
+    hashed_translator tr1{m};
+    BOOST_CHECK_EQUAL(tr1.size(),3);
+    BOOST_CHECK_EQUAL(m["one"],std::string(tr1("one")));
+    BOOST_CHECK_EQUAL(m["two"],std::string(tr1(std::string("two"))));
+    BOOST_CHECK_EQUAL(m["three"],std::string(tr1(string_view("three"))));
+    BOOST_CHECK_EQUAL(not_translated,std::string(tr1(not_translated)));
+    BOOST_CHECK(tr1.find("one"));
+    BOOST_CHECK(!tr1.find(not_translated));
+
+    // translations are not copied
+    auto ph1=tr1("one");
+    auto ph2=tr1("one");
+    BOOST_CHECK(ph1.is_ref());
+    BOOST_CHECK(ph1.view().data()==ph2.view().data());
+    BOOST_CHECK(!tr1(not_translated).is_ref());
+
+    tr1.add("one","one_replaced",grammar_categories_bitmask(grammar::plural));
+    BOOST_CHECK_EQUAL(tr1.size(),3);
+    auto ph3=tr1("one");
+    BOOST_CHECK_EQUAL(ph3.text(),"one_replaced");
+    BOOST_CHECK(is_grammar_category_set(ph3.grammar_cats(),grammar::plural));
+
+    hashed_translator tr2;
+    BOOST_CHECK(tr2.empty());
+    BOOST_CHECK_EQUAL(std::string(tr2("one")),"one");
+    for (size_t i=0;i<100;i++)
+    {
+        tr2.add(std::to_string(i),std::string("translated ")+std::to_string(i));
+    }
+    BOOST_CHECK_EQUAL(tr2.size(),100);
+    for (size_t i=0;i<100;i++)
+    {
+        BOOST_CHECK_EQUAL(tr2(std::to_string(i)).text(),std::string("translated ")+std::to_string(i));
+    }
+    tr2.reset();
+    BOOST_CHECK(tr2.empty());
+    BOOST_CHECK_EQUAL(std::string(tr2("1")),"1");
+}
+
 BOOST_AUTO_TEST_CASE(CheckTranslatorRepository)
 {
     std::string not_translated("not translated");
@@ -162,9 +213,11 @@ BOOST_AUTO_TEST_CASE(CheckTranslatorRepository)
     BOOST_TEST_CONTEXT("Default ctor")
     {
         translator_repository rep;
+        BOOST_CHECK_EQUAL(rep.revision(),0u);
         rep.add_translator(translator1,locales1);
         rep.add_translator(translator2,locales2);
         rep.set_default_translator(def_translator);
+        BOOST_CHECK_EQUAL(rep.revision(),3u);
         check(rep);
     }
 
@@ -281,6 +334,123 @@ BOOST_AUTO_TEST_CASE(CheckPhraseTranslator)
     BOOST_CHECK_EQUAL(tr1("value",grammar_categories_bitmask(grammar::feminine)).text(),"value");
 }
 
+BOOST_AUTO_TEST_CASE(CheckPhraseTranslatorSelection)
+{
+    std::vector<phrase_and_grammar_cats> variants={
+        {"normal"},
+        {"plural",grammar::plural},
+        {"feminine",grammar::feminine},
+        {"feminine plural",grammar::feminine,grammar::plural},
+        {"masculine",grammar::masculine},
+        {"neuter",grammar::neuter},
+        {"neuter plural",grammar::neuter,grammar::plural},
+        {"masculine again",grammar::masculine},
+        {"custom",static_cast<grammar>(3),static_cast<grammar>(4)}
+    };
+    auto check=[](const phrase_translator& tr, const std::vector<phrase_and_grammar_cats>& phrases, grammar_categories cats)
+    {
+        auto expected=phrases.front().phrase.text();
+        if (cats!=0)
+        {
+            auto max_el=std::max_element(phrases.begin(),phrases.end(),
+                             [&cats](const phrase_and_grammar_cats& left, const phrase_and_grammar_cats& right)
+                             {
+                                return count_grammar_categories(left.categories,cats)<count_grammar_categories(right.categories,cats);
+                             }
+                        );
+            expected=max_el->phrase.text();
+        }
+        BOOST_CHECK_EQUAL(tr("word",cats).text(),expected);
+    };
+
+    phrase_translator tr1{phrase_translator::container_type{{"word",variants}}};
+    for (grammar_categories cats=0;cats<(1u<<5);cats++)
+    {
+        check(tr1,variants,cats);
+        check(tr1,variants,cats|grammar_categories_bitmask(grammar::plural));
+        check(tr1,variants,cats|grammar_categories_bitmask(grammar::plural,static_cast<grammar>(20)));
+    }
+
+    // variants with too many categories are not indexed
+    std::vector<phrase_and_grammar_cats> many_variants;
+    for (size_t i=0;i<12;i++)
+    {
+        many_variants.emplace_back(concrete_phrase(std::to_string(i)),grammar_categories(1u<<i)|grammar_categories(1u<<(i+1)));
+    }
+    phrase_translator tr2{phrase_translator::container_type{{"word",many_variants}}};
+    for (grammar_categories cats=0;cats<(1u<<13);cats+=7)
+    {
+        check(tr2,many_variants,cats);
+    }
+
+    // no variants
+    phrase_translator tr3;
+    tr3["word"];
+    BOOST_CHECK(!tr3.find("word"));
+    BOOST_CHECK_EQUAL(tr3("word").text(),"word");
+
+    // phrases refer to translator
+    BOOST_CHECK(tr1("word").is_ref());
+    BOOST_CHECK(tr1("word").view().data()==tr1("word").view().data());
+}
+
+BOOST_AUTO_TEST_CASE(CheckStaticTranslator)
+{
+    constexpr static static_phrase phrases[]={
+        {"word2","translated word2"},
+        {"the word","normal the word"},
+        {gte,"must be at least"},
+        {"the word","plural the word",grammar_categories_bits(grammar::plural),grammar_categories_bits(grammar::plural)},
+        {"the word","feminine the word",0,grammar_categories_bits(grammar::feminine)},
+        {"the word","feminine and plural the word",grammar_categories_bits(grammar::plural),grammar_categories_bits(grammar::plural,grammar::feminine)},
+        {"word1","translated word1"}
+    };
+    constexpr static auto table=make_static_phrases(phrases);
+    static_assert(table.size()==7,"");
+    static_assert(detail::compare_static_phrase_ids(table.items[0],table.items[1])<0,"");
+    static_assert(table.items[3].text_cats==0,"");
+    static_assert(table.items[4].selector_cats==grammar_categories_bits(grammar::plural,grammar::feminine),"");
+
+    static const static_translator tr1{table};
+    BOOST_CHECK_EQUAL(tr1.size(),7);
+
+    BOOST_CHECK_EQUAL(tr1("word1").text(),"translated word1");
+    BOOST_CHECK_EQUAL(tr1(std::string("word2")).text(),"translated word2");
+    BOOST_CHECK_EQUAL(tr1(gte).text(),"must be at least");
+    BOOST_CHECK_EQUAL(tr1("word3").text(),"word3");
+    BOOST_CHECK(!tr1.find("word3"));
+    BOOST_CHECK(!tr1.find("word"));
+    BOOST_CHECK(tr1("word1").is_ref());
+
+    BOOST_CHECK_EQUAL(tr1("the word").text(),"normal the word");
+    BOOST_CHECK_EQUAL(tr1("the word",grammar_categories_bitmask(grammar::masculine)).text(),"normal the word");
+    BOOST_CHECK_EQUAL(tr1("the word",grammar_categories_bitmask(grammar::feminine)).text(),"feminine the word");
+    BOOST_CHECK_EQUAL(tr1("the word",grammar_categories_bitmask(grammar::plural,grammar::feminine)).text(),"feminine and plural the word");
+    auto plural=tr1("the word",grammar_categories_bitmask(grammar::plural));
+    BOOST_CHECK_EQUAL(plural.text(),"plural the word");
+    BOOST_CHECK(is_grammar_category_set(plural.grammar_cats(),grammar::plural));
+}
+
+BOOST_AUTO_TEST_CASE(CheckPhraseTranslatorOfStaticTranslator)
+{
+    const auto& st=validator_static_translator_sample();
+    const auto& pt=validator_translator_sample();
+    BOOST_CHECK(&pt==&validator_translator_sample());
+
+    for (auto&& it:st)
+    {
+        auto id=it.id_view();
+        auto expected=st.find(id,it.selector_cats);
+        auto translated=pt.find(id,it.selector_cats);
+        BOOST_CHECK(translated);
+        BOOST_CHECK_EQUAL(translated.phrase.text(),expected.phrase.text());
+        BOOST_CHECK_EQUAL(translated.phrase.grammar_cats(),expected.phrase.grammar_cats());
+        BOOST_CHECK(translated.phrase.view().data()==expected.phrase.view().data());
+    }
+    BOOST_CHECK_EQUAL(pt(string_empty).text(),std::string(string_empty));
+    BOOST_CHECK_EQUAL(pt("unknown phrase").text(),"unknown phrase");
+}
+
 BOOST_AUTO_TEST_CASE(CheckSampleLocale)
 {
     const auto& m=validator_translator_sample();
@@ -0,0 +1,106 @@
+#include <map>
+#include <string>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <hatn/validator/validator.hpp>
+#include <hatn/validator/validate.hpp>
+#include <hatn/validator/static_key.hpp>
+
+using namespace HATN_VALIDATOR_NAMESPACE;
+
+namespace {
+
+// key that counts its constructions from strings
+struct counted_key : public std::string
+{
+    static size_t count;
+
+    counted_key(const char* str) : std::string(str)
+    {
+        ++count;
+    }
+
+    counted_key(const std::string& str) : std::string(str)
+    {
+        ++count;
+    }
+};
+size_t counted_key::count=0;
+
+struct counted_key_less
+{
+    using is_transparent=void;
+
+    bool operator () (string_view left, string_view right) const noexcept
+    {
+        return left<right;
+    }
+};
+
+}
+
+BOOST_AUTO_TEST_SUITE(TestTransparentLookup)
+
+BOOST_AUTO_TEST_CASE(CheckTraits)
+{
+    using transparent_map=std::map<std::string,int,std::less<>>;
+    using plain_map=std::map<std::string,int>;
+
+    static_assert(detail::transparent_lookup_t<transparent_map,string_view>::value,"");
+    static_assert(detail::transparent_lookup_t<const transparent_map&,const char*>::value,"");
+    static_assert(!detail::transparent_lookup_t<transparent_map,std::string>::value,"");
+    static_assert(!detail::transparent_lookup_t<transparent_map,int>::value,"");
+    static_assert(!detail::transparent_lookup_t<plain_map,string_view>::value,"");
+    static_assert(!detail::transparent_lookup_t<std::vector<int>,string_view>::value,"");
+
+    static_assert(can_check_contains<transparent_map,string_view>(),"");
+    static_assert(!can_check_contains<plain_map,string_view>(),"");
+}
+
+BOOST_AUTO_TEST_CASE(CheckGet)
+{
+    std::map<std::string,int,std::less<>> m{{"field1",10},{"field2",20}};
+
+    BOOST_CHECK_EQUAL(get(m,string_view("field1")),10);
+    BOOST_CHECK_EQUAL(get(m,HATN_KEY("field2")),20);
+    BOOST_CHECK(check_contains(m,string_view("field1")));
+    BOOST_CHECK(!check_contains(m,string_view("field3")));
+    BOOST_CHECK_THROW(get(m,string_view("field3")),std::out_of_range);
+
+    get(m,string_view("field2"))=30;
+    BOOST_CHECK_EQUAL(m["field2"],30);
+}
+
+BOOST_AUTO_TEST_CASE(CheckValidation)
+{
+    std::map<counted_key,int,counted_key_less> m{{"field1",10},{"field2",20}};
+    error_report err;
+
+    auto v1=validator(
+                _["field1"](gte,10),
+                _["field1"](lt,_["field2"]),
+                _[string_view("field2")](lte,100)
+            );
+    counted_key::count=0;
+    validate(m,v1,err);
+    BOOST_CHECK(!err);
+    BOOST_CHECK_EQUAL(counted_key::count,0u);
+
+    auto v2=validator(
+                _[HATN_KEY("field2")](lt,_[HATN_KEY("field1")])
+            );
+    validate(m,v2,err);
+    BOOST_CHECK_EQUAL(err.message(),std::string("field2 must be less than field1"));
+    BOOST_CHECK_EQUAL(counted_key::count,0u);
+
+    auto v3=validator(
+                _["field3"](exists,true)
+            );
+    validate(m,v3,err);
+    BOOST_CHECK_EQUAL(err.message(),std::string("field3 must exist"));
+    BOOST_CHECK_EQUAL(counted_key::count,0u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,192 @@
+#include <map>
+#include <vector>
+#include <memory>
+#include <chrono>
+
+#include <boost/test/unit_test.hpp>
+
+#include <hatn/validator/validator.hpp>
+#include <hatn/validator/aggregation/tree.hpp>
+#include <hatn/validator/variadic_property.hpp>
+#include <hatn/validator/adapters/budget_adapter.hpp>
+
+using namespace HATN_VALIDATOR_NAMESPACE;
+
+namespace {
+
+struct TreeNode
+{
+    TreeNode(std::string name) : _name(std::move(name))
+    {}
+
+    void add_child(std::shared_ptr<TreeNode> child)
+    {
+        _children.push_back(std::move(child));
+    }
+
+    const TreeNode& child(size_t index) const
+    {
+        return *_children.at(index);
+    }
+
+    size_t child_count() const
+    {
+        return _children.size();
+    }
+
+    std::string name() const
+    {
+        return _name;
+    }
+
+    std::vector<std::shared_ptr<TreeNode>> _children;
+    std::string _name;
+};
+
+HATN_VALIDATOR_PROPERTY(name)
+HATN_VALIDATOR_PROPERTY(child_count)
+HATN_VALIDATOR_VARIADIC_PROPERTY(child)
+
+}
+
+BOOST_AUTO_TEST_SUITE(TestValidationBudget)
+
+BOOST_AUTO_TEST_CASE(CheckOperations)
+{
+    std::map<std::string,int> m1{{"field1",1},{"field2",2},{"field3",3}};
+    auto v=validator(
+                _["field1"](gte,0),
+                _["field2"](gte,0),
+                _["field3"](gte,0)
+            );
+
+    validation_budget budget;
+    BOOST_CHECK(validate_with_budget(m1,v,budget).success());
+    BOOST_CHECK_EQUAL(budget.operations(),3);
+    BOOST_CHECK(!budget.exhausted());
+
+    budget.reset();
+    budget.set_max_operations(2);
+    auto ret=validate_with_budget(m1,v,budget);
+    BOOST_CHECK(ret.exhausted());
+    BOOST_CHECK(ret.fail());
+    BOOST_CHECK(!ret);
+    BOOST_CHECK(budget.exhausted_reason()==validation_budget::reason::operations);
+
+    error_report err;
+    budget.reset();
+    validate_with_budget(m1,v,budget,err);
+    BOOST_CHECK(err);
+    BOOST_CHECK(err.value().exhausted());
+    BOOST_CHECK_EQUAL(err.message(),std::string("validation budget exhausted: too many operations"));
+
+    // regular failure is reported as usual
+    m1["field1"]=-1;
+    budget.reset();
+    budget.set_max_operations(10);
+    validate_with_budget(m1,v,budget,err);
+    BOOST_CHECK(err);
+    BOOST_CHECK(err.value()==status::code::fail);
+    BOOST_CHECK_EQUAL(err.message(),std::string("field1 must be greater than or equal to 0"));
+}
+
+BOOST_AUTO_TEST_CASE(CheckAggregations)
+{
+    std::map<std::string,int> m1{{"field1",1},{"field2",2}};
+    validation_budget budget;
+    budget.set_max_operations(0);
+
+    // NOT does not turn exhaustion into success
+    auto v1=validator(_["field1"](NOT(value(lt,0))));
+    BOOST_CHECK(validate_with_budget(m1,v1,budget).exhausted());
+    BOOST_CHECK(v1.apply(make_budget_adapter(budget,m1)).exhausted());
+
+    auto v2=validator(!_["field1"](lt,0));
+    budget.reset();
+    BOOST_CHECK(v2.apply(make_budget_adapter(budget,m1)).exhausted());
+
+    // OR does not go on with other operands
+    auto v3=validator(_["field1"](lt,0) ^OR^ _["field2"](gt,0));
+    budget.reset();
+    budget.set_max_operations(1);
+    BOOST_CHECK(v3.apply(make_budget_adapter(budget,m1)).exhausted());
+    BOOST_CHECK_EQUAL(budget.operations(),2);
+    budget.reset();
+    budget.set_max_operations(2);
+    BOOST_CHECK(v3.apply(make_budget_adapter(budget,m1)).success());
+}
+
+BOOST_AUTO_TEST_CASE(CheckElements)
+{
+    std::map<std::string,std::vector<int>> m1{{"field1",std::vector<int>(1000,1)}};
+    auto v1=validator(_["field1"][ALL](gte,0));
+    auto v2=validator(_["field1"][ANY](lt,0));
+
+    validation_budget budget;
+    BOOST_CHECK(validate_with_budget(m1,v1,budget).success());
+    BOOST_CHECK_EQUAL(budget.elements(),1000);
+    budget.reset();
+    BOOST_CHECK(validate_with_budget(m1,v2,budget).fail());
+    BOOST_CHECK(!budget.exhausted());
+
+    budget.reset();
+    budget.set_max_elements(100);
+    error_report err;
+    validate_with_budget(m1,v1,budget,err);
+    BOOST_CHECK(err.value().exhausted());
+    BOOST_CHECK_EQUAL(err.message(),std::string("validation budget exhausted: too many elements"));
+    BOOST_CHECK_EQUAL(budget.operations(),100);
+
+    budget.reset();
+    validate_with_budget(m1,v2,budget,err);
+    BOOST_CHECK(err.value().exhausted());
+    BOOST_CHECK_EQUAL(budget.operations(),100);
+}
+
+BOOST_AUTO_TEST_CASE(CheckTree)
+{
+    auto v=validator(
+            _[tree(ALL,child,child_count)][name](gte,"Node")
+         );
+
+    TreeNode tr("Node 0");
+    for (size_t i=0;i<10;i++)
+    {
+        auto child=std::make_shared<TreeNode>("Node 0.x");
+        for (size_t j=0;j<10;j++)
+        {
+            child->add_child(std::make_shared<TreeNode>("Node 0.x.x"));
+        }
+        tr.add_child(child);
+    }
+
+    validation_budget budget;
+    BOOST_CHECK(validate_with_budget(tr,v,budget).success());
+    BOOST_CHECK_EQUAL(budget.elements(),110);
+
+    budget.reset();
+    budget.set_max_elements(50);
+    BOOST_CHECK(validate_with_budget(tr,v,budget).exhausted());
+    BOOST_CHECK(budget.exhausted_reason()==validation_budget::reason::elements);
+}
+
+BOOST_AUTO_TEST_CASE(CheckDeadline)
+{
+    std::map<std::string,std::vector<int>> m1{{"field1",std::vector<int>(1000,1)}};
+    auto v=validator(_["field1"][ALL](gte,0));
+
+    validation_budget budget;
+    budget.set_deadline(validation_budget::clock::now()-std::chrono::seconds(1));
+    error_report err;
+    validate_with_budget(m1,v,budget,err);
+    BOOST_CHECK(err.value().exhausted());
+    BOOST_CHECK_EQUAL(err.message(),std::string("validation budget exhausted: deadline expired"));
+    BOOST_CHECK(budget.elements()<validation_budget::deadline_check_interval);
+
+    budget.reset();
+    budget.set_timeout(std::chrono::hours(1));
+    validate_with_budget(m1,v,budget,err);
+    BOOST_CHECK(!err);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
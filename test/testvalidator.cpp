@@ -2,6 +2,9 @@
 #include <boost/test/unit_test.hpp>
 
 #include <hatn/validator/validator.hpp>
+#include <hatn/validator/interval.hpp>
+#include <hatn/validator/operators/in.hpp>
+#include <hatn/validator/adapters/reporting_adapter.hpp>
 
 using namespace HATN_VALIDATOR_NAMESPACE;
 
@@ -67,6 +70,31 @@ BOOST_AUTO_TEST_CASE(CheckValidation)
     BOOST_CHECK(!v3.apply(a2));
 }
 
+BOOST_AUTO_TEST_CASE(CheckComparisonBoundaries)
+{
+    std::map<std::string,int> m1={{"a",5}};
+
+    BOOST_CHECK(validator(_["a"](lte,5)).apply(m1));
+    BOOST_CHECK(validator(_["a"](lte,6)).apply(m1));
+    BOOST_CHECK(!validator(_["a"](lte,4)).apply(m1));
+    BOOST_CHECK(validator(_["a"](lte,5.0)).apply(m1));
+    BOOST_CHECK(validator(_["a"](lte,5u)).apply(m1));
+
+    BOOST_CHECK(validator(_["a"](gte,5)).apply(m1));
+    BOOST_CHECK(!validator(_["a"](gte,6)).apply(m1));
+    BOOST_CHECK(!validator(_["a"](lt,5)).apply(m1));
+    BOOST_CHECK(!validator(_["a"](gt,5)).apply(m1));
+
+    BOOST_CHECK(validator(_["a"](in,interval(1,5))).apply(m1));
+    BOOST_CHECK(validator(_["a"](in,interval(5,10))).apply(m1));
+    BOOST_CHECK(!validator(_["a"](in,interval(1,5,interval.open_to()))).apply(m1));
+
+    std::string rep;
+    auto ra=make_reporting_adapter(m1,rep);
+    BOOST_CHECK(!validator(_["a"](lte,4)).apply(ra));
+    BOOST_CHECK_EQUAL(rep,std::string("a must be less than or equal to 4"));
+}
+
 BOOST_AUTO_TEST_CASE(CheckLazyValidation)
 {
     std::map<std::string,size_t> m1={{"field1",1}};
@@ -0,0 +1,181 @@
+#include <map>
+#include <string>
+#include <vector>
+#include <thread>
+#include <atomic>
+
+#include <boost/test/unit_test.hpp>
+
+#include <hatn/validator/validator.hpp>
+#include <hatn/validator/validator_registry.hpp>
+
+using namespace HATN_VALIDATOR_NAMESPACE;
+
+namespace
+{
+using object_type=std::map<std::string,int>;
+}
+
+BOOST_AUTO_TEST_SUITE(TestValidatorRegistry)
+
+BOOST_AUTO_TEST_CASE(CheckUpdates)
+{
+    object_type m1{{"field1",10},{"field2",20}};
+    object_type m2{{"field1",1},{"field2",200}};
+
+    validator_registry<object_type> registry;
+    auto reader=registry.make_reader();
+    BOOST_CHECK_EQUAL(reader.lock().version(),0u);
+    BOOST_CHECK(!reader.apply("tenant1",m1));
+
+    registry.set("tenant1",validator(_["field1"](gte,5)));
+    registry.set("tenant2",validator(_["field2"](lte,100)));
+    BOOST_CHECK_EQUAL(reader.lock().version(),2u);
+    BOOST_CHECK(reader.apply("tenant1",m1));
+    BOOST_CHECK(!reader.apply("tenant1",m2));
+    BOOST_CHECK(reader.apply("tenant2",m1));
+    BOOST_CHECK(reader.apply(string_view("tenant2_").substr(0,7),m1));
+
+    const validator_registry<object_type>::validator_type* tenant2=nullptr;
+    {
+        auto guard=reader.lock();
+        tenant2=guard.find(string_view("tenant2"));
+        BOOST_CHECK(tenant2!=nullptr);
+        BOOST_CHECK(guard.find(string_view("tenant"))==nullptr);
+    }
+
+    std::string rep;
+    BOOST_CHECK(!reader.apply("tenant2",m2,rep));
+    BOOST_CHECK_EQUAL(rep,std::string("field2 must be less than or equal to 100"));
+
+    // replace validator
+    registry.set("tenant1",validator(_["field1"](lt,5)));
+    BOOST_CHECK(!reader.apply("tenant1",m1));
+    BOOST_CHECK(reader.apply("tenant1",m2));
+
+    // unchanged validator is shared by new snapshot and is not copied
+    BOOST_CHECK(reader.lock().find("tenant2")==tenant2);
+
+    BOOST_CHECK(registry.erase("tenant1"));
+    BOOST_CHECK(!registry.erase("tenant1"));
+    BOOST_CHECK(!reader.apply("tenant1",m2));
+    {
+        auto guard=reader.lock();
+        BOOST_CHECK(guard.find("tenant1")==nullptr);
+        BOOST_CHECK(guard.find("tenant2")!=nullptr);
+        BOOST_CHECK_EQUAL(guard.validators().size(),1u);
+    }
+
+    // batch update is published as single version
+    auto version=reader.lock().version();
+    registry.update(
+        [](validator_registry<object_type>::map_type& validators)
+        {
+            using validator_type=validator_registry<object_type>::validator_type;
+            validators["tenant3"]=std::make_shared<validator_type>(validator(_["field1"](eq,10)));
+            validators["tenant4"]=std::make_shared<validator_type>(validator(_["field1"](eq,1)));
+        }
+    );
+    BOOST_CHECK_EQUAL(reader.lock().version(),version+1);
+    BOOST_CHECK(reader.apply("tenant3",m1));
+    BOOST_CHECK(reader.apply("tenant4",m2));
+
+    registry.clear();
+    BOOST_CHECK(reader.lock().validators().empty());
+    BOOST_CHECK_EQUAL(registry.retired_count(),0u);
+}
+
+BOOST_AUTO_TEST_CASE(CheckReclamation)
+{
+    object_type m1{{"field1",10}};
+
+    validator_registry<object_type> registry;
+    registry.set("tenant1",validator(_["field1"](gte,5)));
+
+    auto reader1=registry.make_reader();
+    auto reader2=registry.make_reader();
+    {
+        auto guard=reader1.lock();
+        auto v=guard.find("tenant1");
+        BOOST_REQUIRE(v!=nullptr);
+
+        // pinned snapshot is not destroyed while guard is alive
+        registry.set("tenant1",validator(_["field1"](lt,5)));
+        registry.set("tenant1",validator(_["field1"](eq,5)));
+        BOOST_CHECK_EQUAL(registry.retired_count(),2u);
+        BOOST_CHECK(v->apply(m1));
+        BOOST_CHECK_EQUAL(guard.version(),1u);
+
+        // nested guard and other readers see new snapshot
+        BOOST_CHECK(!reader1.apply("tenant1",m1));
+        BOOST_CHECK(!reader2.apply("tenant1",m1));
+        BOOST_CHECK_EQUAL(reader2.lock().version(),3u);
+
+        // snapshot retired after the guard was pinned is still protected
+        registry.set("tenant1",validator(_["field1"](eq,10)));
+        BOOST_CHECK_EQUAL(registry.retired_count(),3u);
+    }
+    registry.reclaim();
+    BOOST_CHECK_EQUAL(registry.retired_count(),0u);
+    BOOST_CHECK(reader1.apply("tenant1",m1));
+
+    // slot of destroyed reader is reused
+    {
+        auto reader3=registry.make_reader();
+        BOOST_CHECK(reader3.apply("tenant1",m1));
+    }
+    auto reader4=registry.make_reader();
+    BOOST_CHECK(reader4.apply("tenant1",m1));
+}
+
+BOOST_AUTO_TEST_CASE(CheckConcurrentReaders)
+{
+    object_type m1{{"field1",10}};
+    object_type m2{{"field1",1}};
+
+    validator_registry<object_type> registry;
+    registry.set("tenant1",validator(_["field1"](gte,5)));
+
+    std::atomic<bool> stop{false};
+    std::atomic<size_t> errors{0};
+    std::vector<std::thread> threads;
+    for (size_t i=0;i<4;i++)
+    {
+        threads.emplace_back(
+            [&]()
+            {
+                auto reader=registry.make_reader();
+                while (!stop.load(std::memory_order_relaxed))
+                {
+                    if (!reader.apply("tenant1",m1) || reader.apply("tenant1",m2))
+                    {
+                        ++errors;
+                    }
+                }
+            }
+        );
+    }
+
+    for (size_t i=0;i<1000;i++)
+    {
+        if (i%2==0)
+        {
+            registry.set("tenant1",validator(_["field1"](gt,1)));
+        }
+        else
+        {
+            registry.set("tenant1",validator(_["field1"](gte,5)));
+        }
+    }
+    stop.store(true);
+    for (auto&& thread:threads)
+    {
+        thread.join();
+    }
+
+    BOOST_CHECK_EQUAL(errors.load(),0u);
+    registry.reclaim();
+    BOOST_CHECK_EQUAL(registry.retired_count(),0u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,261 @@
+/**
+@copyright Evgeny Sidorov 2020
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+*/
+
+/****************************************************************************/
+
+/** @file tools/filecheck/filecheck.hpp
+*
+*  Defines parallel validation of records of line-delimited files.
+*
+*/
+
+/****************************************************************************/
+
+#ifndef HATN_VALIDATOR_FILECHECK_HPP
+#define HATN_VALIDATOR_FILECHECK_HPP
+
+#include <cstring>
+#include <string>
+#include <vector>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <exception>
+
+#include <hatn/validator/utils/string_view.hpp>
+
+namespace filecheck
+{
+
+using HATN_VALIDATOR_NAMESPACE::string_view;
+
+/**
+ * @brief Failed record.
+ */
+struct failure
+{
+    size_t line;
+    std::string report;
+};
+
+/**
+ * @brief Result of validation of a chunk.
+ */
+struct chunk_result
+{
+    size_t records=0;
+    size_t lines=0;
+    std::vector<failure> failures;
+};
+
+/**
+ * @brief Result of validation of a file.
+ */
+struct check_result
+{
+    size_t records=0;
+    size_t lines=0;
+    size_t failed=0;
+};
+
+/**
+ * @brief Split buffer into chunks whose boundaries are at line boundaries.
+ * @param data Buffer.
+ * @param size Size of buffer.
+ * @param chunk_size Minimal size of a chunk, the last chunk can be smaller.
+ * @return Offsets of chunks' beginnings followed by the size of buffer.
+ */
+inline std::vector<size_t> split_chunks(const char* data, size_t size, size_t chunk_size)
+{
+    std::vector<size_t> offsets{0};
+    size_t pos=0;
+    while (size-pos>chunk_size)
+    {
+        auto next=pos+chunk_size;
+        auto eol=static_cast<const char*>(std::memchr(data+next,'\n',size-next));
+        if (eol==nullptr)
+        {
+            break;
+        }
+        pos=static_cast<size_t>(eol-data)+1;
+        if (pos==size)
+        {
+            break;
+        }
+        offsets.push_back(pos);
+    }
+    offsets.push_back(size);
+    return offsets;
+}
+
+/**
+ * @brief Validate records of a chunk line by line.
+ * @param data Chunk.
+ * @param size Size of chunk.
+ * @param checker Checker of records.
+ * @return Result of validation, line numbers of failures are counted from the beginning of the chunk starting with 0.
+ *
+ * Empty lines are counted but not validated, trailing carriage return is stripped from each line.
+ */
+template <typename CheckerT>
+chunk_result check_chunk(const char* data, size_t size, CheckerT& checker)
+{
+    chunk_result result;
+    std::string report;
+    size_t pos=0;
+    while (pos<size)
+    {
+        auto eol=static_cast<const char*>(std::memchr(data+pos,'\n',size-pos));
+        auto end=(eol==nullptr) ? size : static_cast<size_t>(eol-data);
+        auto len=end-pos;
+        if (len!=0 && data[end-1]=='\r')
+        {
+            --len;
+        }
+        if (len!=0)
+        {
+            ++result.records;
+            if (!checker.check(string_view(data+pos,len),report))
+            {
+                result.failures.push_back(failure{result.lines,std::move(report)});
+                report.clear();
+            }
+        }
+        ++result.lines;
+        pos=end+1;
+    }
+    return result;
+}
+
+/**
+ * @brief Validate records of line-delimited buffer in parallel.
+ * @param data Buffer.
+ * @param size Size of buffer.
+ * @param threads Number of threads.
+ * @param chunk_size Size of chunks the buffer is split into.
+ * @param make_checker Factory of checkers of records, each thread uses its own checker.
+ * @param write_failure Handler of failed records.
+ * @param first_line Number of the first line of buffer.
+ * @return Result of validation.
+ *
+ * A checker must have method bool check(string_view record, std::string& report).
+ * Chunks are distributed among threads dynamically, so that threads stay busy even if records have different cost of validation.
+ *
+ * Failures are passed to write_failure(const failure&) ordered by line numbers as soon as all preceding chunks are done,
+ * so only failures of chunks done ahead of a slower chunk are kept in memory. The handler is never invoked concurrently
+ * and it is invoked without holding locks, so that threads can go on with the next chunks while failures are being written.
+ */
+template <typename MakeCheckerT, typename WriteFailureT>
+check_result check_parallel(const char* data, size_t size, size_t threads, size_t chunk_size,
+                            const MakeCheckerT& make_checker, const WriteFailureT& write_failure, size_t first_line=1)
+{
+    auto offsets=split_chunks(data,size,chunk_size);
+    auto chunks_count=offsets.size()-1;
+    std::vector<chunk_result> chunks(chunks_count);
+    std::vector<bool> done(chunks_count,false);
+    std::vector<std::exception_ptr> errors(threads);
+
+    check_result result;
+    std::mutex mutex;
+    size_t next_write=0;
+    bool writing=false;
+    auto line=first_line;
+
+    // write failures of consecutive done chunks, only one thread writes at a time
+    auto write_done=[&](std::unique_lock<std::mutex>& lock)
+    {
+        if (writing)
+        {
+            // current writer will pick up the chunk
+            return;
+        }
+        writing=true;
+        std::vector<failure> failures;
+        for (;;)
+        {
+            failures.clear();
+            while (next_write<chunks_count && done[next_write])
+            {
+                auto& chunk=chunks[next_write];
+                result.records+=chunk.records;
+                result.lines+=chunk.lines;
+                result.failed+=chunk.failures.size();
+                for (auto&& item : chunk.failures)
+                {
+                    item.line+=line;
+                    failures.push_back(std::move(item));
+                }
+                line+=chunk.lines;
+                std::vector<failure>{}.swap(chunk.failures);
+                ++next_write;
+            }
+            if (failures.empty())
+            {
+                break;
+            }
+            lock.unlock();
+            for (auto&& item : failures)
+            {
+                write_failure(item);
+            }
+            lock.lock();
+        }
+        writing=false;
+    };
+
+    std::atomic<size_t> next{0};
+    auto worker=[&](size_t index)
+    {
+        try
+        {
+            auto checker=make_checker();
+            for (;;)
+            {
+                auto i=next.fetch_add(1,std::memory_order_relaxed);
+                if (i>=chunks_count)
+                {
+                    break;
+                }
+                auto chunk=check_chunk(data+offsets[i],offsets[i+1]-offsets[i],checker);
+
+                std::unique_lock<std::mutex> lock{mutex};
+                chunks[i]=std::move(chunk);
+                done[i]=true;
+                write_done(lock);
+            }
+        }
+        catch (...)
+        {
+            errors[index]=std::current_exception();
+            next.store(chunks_count,std::memory_order_relaxed);
+        }
+    };
+
+    std::vector<std::thread> pool;
+    for (size_t i=1;i<threads;i++)
+    {
+        pool.emplace_back(worker,i);
+    }
+    worker(0);
+    for (auto&& thread : pool)
+    {
+        thread.join();
+    }
+    for (auto&& error : errors)
+    {
+        if (error)
+        {
+            std::rethrow_exception(error);
+        }
+    }
+    return result;
+}
+
+}
+
+#endif // HATN_VALIDATOR_FILECHECK_HPP
@@ -0,0 +1,561 @@
+/**
+@copyright Evgeny Sidorov 2020
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+*/
+
+/****************************************************************************/
+
+/** @file tools/filecheck/json_reader.hpp
+*
+*  Defines minimal JSON reader emitting SAX events to a handler of JSON parser.
+*
+*/
+
+/****************************************************************************/
+
+#ifndef HATN_VALIDATOR_FILECHECK_JSON_READER_HPP
+#define HATN_VALIDATOR_FILECHECK_JSON_READER_HPP
+
+#include <cerrno>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <system_error>
+
+#include <hatn/validator/utils/string_view.hpp>
+
+namespace filecheck
+{
+
+using HATN_VALIDATOR_NAMESPACE::string_view;
+
+/**
+ * @brief Minimal reader of a single JSON document.
+ *
+ * The reader invokes the same methods of a handler as boost::json::basic_parser does,
+ * so json_sax_validator can be used without dependency on Boost.JSON.
+ * The tool uses it only as a fallback when Boost.JSON is not found.
+ * The whole document must be in memory, so strings and numbers are never split into parts.
+ * Strings without escape sequences are passed to the handler as views of the source buffer.
+ */
+class json_reader
+{
+    public:
+
+        constexpr static const size_t max_depth=64;
+
+        /**
+         * @brief Read JSON document and emit events to the handler.
+         * @param data Document.
+         * @param handler Handler of events.
+         * @return True if the document was read completely, false if the document is malformed or the handler stopped reading.
+         *
+         * If the document is malformed then error() returns description of the error and position() points to the error.
+         */
+        template <typename HandlerT>
+        bool read(string_view data, HandlerT& handler)
+        {
+            _data=data;
+            _pos=0;
+            _error=nullptr;
+            _stopped=false;
+
+            if (!handler.on_document_begin(_ec))
+            {
+                return stop();
+            }
+            skip_ws();
+            if (!value(handler,0))
+            {
+                return false;
+            }
+            skip_ws();
+            if (_pos!=_data.size())
+            {
+                return fail("unexpected data after JSON value");
+            }
+            if (!handler.on_document_end(_ec))
+            {
+                return stop();
+            }
+            return true;
+        }
+
+        /**
+         * @brief Get description of syntax error.
+         * @return Description of error or nullptr if document is well-formed.
+         */
+        const char* error() const noexcept
+        {
+            return _error;
+        }
+
+        /**
+         * @brief Get position where reading stopped.
+         * @return Offset in the document.
+         */
+        size_t position() const noexcept
+        {
+            return _pos;
+        }
+
+        /**
+         * @brief Check if reading was stopped by the handler.
+         * @return Boolean result.
+         */
+        bool stopped() const noexcept
+        {
+            return _stopped;
+        }
+
+    private:
+
+        bool fail(const char* msg) noexcept
+        {
+            _error=msg;
+            return false;
+        }
+
+        bool stop() noexcept
+        {
+            _stopped=true;
+            return false;
+        }
+
+        void skip_ws() noexcept
+        {
+            while (_pos<_data.size())
+            {
+                auto ch=_data[_pos];
+                if (ch!=' ' && ch!='\t' && ch!='\n' && ch!='\r')
+                {
+                    break;
+                }
+                ++_pos;
+            }
+        }
+
+        bool eof() const noexcept
+        {
+            return _pos>=_data.size();
+        }
+
+        template <typename HandlerT>
+        bool value(HandlerT& handler, size_t depth)
+        {
+            if (eof())
+            {
+                return fail("unexpected end of JSON");
+            }
+            switch (_data[_pos])
+            {
+                case '{':
+                    return object(handler,depth+1);
+                case '[':
+                    return array(handler,depth+1);
+                case '"':
+                {
+                    if (!string())
+                    {
+                        return false;
+                    }
+                    return handler.on_string(_str,_str.size(),_ec) || stop();
+                }
+                case 't':
+                    return literal("true") && (handler.on_bool(true,_ec) || stop());
+                case 'f':
+                    return literal("false") && (handler.on_bool(false,_ec) || stop());
+                case 'n':
+                    return literal("null") && (handler.on_null(_ec) || stop());
+                default:
+                    return number(handler);
+            }
+        }
+
+        template <typename HandlerT>
+        bool object(HandlerT& handler, size_t depth)
+        {
+            if (depth>max_depth)
+            {
+                return fail("too deep JSON");
+            }
+            ++_pos;
+            if (!handler.on_object_begin(_ec))
+            {
+                return stop();
+            }
+            size_t count=0;
+            skip_ws();
+            if (!eof() && _data[_pos]=='}')
+            {
+                ++_pos;
+                return handler.on_object_end(count,_ec) || stop();
+            }
+            for (;;)
+            {
+                skip_ws();
+                if (eof() || _data[_pos]!='"')
+                {
+                    return fail("expected name of object member");
+                }
+                if (!string())
+                {
+                    return false;
+                }
+                if (!handler.on_key(_str,_str.size(),_ec))
+                {
+                    return stop();
+                }
+                skip_ws();
+                if (eof() || _data[_pos]!=':')
+                {
+                    return fail("expected ':'");
+                }
+                ++_pos;
+                skip_ws();
+                if (!value(handler,depth))
+                {
+                    return false;
+                }
+                ++count;
+                skip_ws();
+                if (eof())
+                {
+                    return fail("unexpected end of JSON");
+                }
+                if (_data[_pos]==',')
+                {
+                    ++_pos;
+                    continue;
+                }
+                if (_data[_pos]=='}')
+                {
+                    ++_pos;
+                    return handler.on_object_end(count,_ec) || stop();
+                }
+                return fail("expected ',' or '}'");
+            }
+        }
+
+        template <typename HandlerT>
+        bool array(HandlerT& handler, size_t depth)
+        {
+            if (depth>max_depth)
+            {
+                return fail("too deep JSON");
+            }
+            ++_pos;
+            if (!handler.on_array_begin(_ec))
+            {
+                return stop();
+            }
+            size_t count=0;
+            skip_ws();
+            if (!eof() && _data[_pos]==']')
+            {
+                ++_pos;
+                return handler.on_array_end(count,_ec) || stop();
+            }
+            for (;;)
+            {
+                skip_ws();
+                if (!value(handler,depth))
+                {
+                    return false;
+                }
+                ++count;
+                skip_ws();
+                if (eof())
+                {
+                    return fail("unexpected end of JSON");
+                }
+                if (_data[_pos]==',')
+                {
+                    ++_pos;
+                    continue;
+                }
+                if (_data[_pos]==']')
+                {
+                    ++_pos;
+                    return handler.on_array_end(count,_ec) || stop();
+                }
+                return fail("expected ',' or ']'");
+            }
+        }
+
+        bool literal(const char* lit) noexcept
+        {
+            auto len=std::strlen(lit);
+            if (_data.size()-_pos<len || _data.compare(_pos,len,lit)!=0)
+            {
+                return fail("invalid literal");
+            }
+            _pos+=len;
+            return true;
+        }
+
+        /**
+         * @brief Read string, the result is put to _str.
+         */
+        bool string()
+        {
+            ++_pos;
+            auto begin=_pos;
+            while (!eof())
+            {
+                auto ch=_data[_pos];
+                if (ch=='"')
+                {
+                    _str=_data.substr(begin,_pos-begin);
+                    ++_pos;
+                    return true;
+                }
+                if (ch=='\\')
+                {
+                    _buffer.assign(_data.data()+begin,_pos-begin);
+                    return escaped_string();
+                }
+                if (static_cast<unsigned char>(ch)<0x20)
+                {
+                    return fail("invalid character in string");
+                }
+                ++_pos;
+            }
+            return fail("unterminated string");
+        }
+
+        bool escaped_string()
+        {
+            while (!eof())
+            {
+                auto ch=_data[_pos++];
+                if (ch=='"')
+                {
+                    _str=string_view(_buffer);
+                    return true;
+                }
+                if (static_cast<unsigned char>(ch)<0x20)
+                {
+                    return fail("invalid character in string");
+                }
+                if (ch!='\\')
+                {
+                    _buffer.push_back(ch);
+                    continue;
+                }
+                if (eof())
+                {
+                    break;
+                }
+                ch=_data[_pos++];
+                switch (ch)
+                {
+                    case '"': _buffer.push_back('"'); break;
+                    case '\\': _buffer.push_back('\\'); break;
+                    case '/': _buffer.push_back('/'); break;
+                    case 'b': _buffer.push_back('\b'); break;
+                    case 'f': _buffer.push_back('\f'); break;
+                    case 'n': _buffer.push_back('\n'); break;
+                    case 'r': _buffer.push_back('\r'); break;
+                    case 't': _buffer.push_back('\t'); break;
+                    case 'u':
+                    {
+                        if (!unicode_escape())
+                        {
+                            return false;
+                        }
+                        break;
+                    }
+                    default:
+                        return fail("invalid escape sequence");
+                }
+            }
+            return fail("unterminated string");
+        }
+
+        bool hex4(uint32_t& code) noexcept
+        {
+            if (_data.size()-_pos<4)
+            {
+                return fail("invalid escape sequence");
+            }
+            code=0;
+            for (size_t i=0;i<4;i++)
+            {
+                auto ch=_data[_pos++];
+                code<<=4;
+                if (ch>='0' && ch<='9')
+                {
+                    code|=static_cast<uint32_t>(ch-'0');
+                }
+                else if (ch>='a' && ch<='f')
+                {
+                    code|=static_cast<uint32_t>(ch-'a'+10);
+                }
+                else if (ch>='A' && ch<='F')
+                {
+                    code|=static_cast<uint32_t>(ch-'A'+10);
+                }
+                else
+                {
+                    return fail("invalid escape sequence");
+                }
+            }
+            return true;
+        }
+
+        bool unicode_escape()
+        {
+            uint32_t code=0;
+            if (!hex4(code))
+            {
+                return false;
+            }
+            if (code>=0xD800 && code<=0xDBFF)
+            {
+                uint32_t low=0;
+                if (_data.size()-_pos<2 || _data[_pos]!='\\' || _data[_pos+1]!='u')
+                {
+                    return fail("invalid surrogate pair");
+                }
+                _pos+=2;
+                if (!hex4(low))
+                {
+                    return false;
+                }
+                if (low<0xDC00 || low>0xDFFF)
+                {
+                    return fail("invalid surrogate pair");
+                }
+                code=0x10000+((code-0xD800)<<10)+(low-0xDC00);
+            }
+            else if (code>=0xDC00 && code<=0xDFFF)
+            {
+                return fail("invalid surrogate pair");
+            }
+
+            // encode UTF-8
+            if (code<0x80)
+            {
+                _buffer.push_back(static_cast<char>(code));
+            }
+            else if (code<0x800)
+            {
+                _buffer.push_back(static_cast<char>(0xC0|(code>>6)));
+                _buffer.push_back(static_cast<char>(0x80|(code&0x3F)));
+            }
+            else if (code<0x10000)
+            {
+                _buffer.push_back(static_cast<char>(0xE0|(code>>12)));
+                _buffer.push_back(static_cast<char>(0x80|((code>>6)&0x3F)));
+                _buffer.push_back(static_cast<char>(0x80|(code&0x3F)));
+            }
+            else
+            {
+                _buffer.push_back(static_cast<char>(0xF0|(code>>18)));
+                _buffer.push_back(static_cast<char>(0x80|((code>>12)&0x3F)));
+                _buffer.push_back(static_cast<char>(0x80|((code>>6)&0x3F)));
+                _buffer.push_back(static_cast<char>(0x80|(code&0x3F)));
+            }
+            return true;
+        }
+
+        size_t skip_digits() noexcept
+        {
+            auto begin=_pos;
+            while (!eof() && _data[_pos]>='0' && _data[_pos]<='9')
+            {
+                ++_pos;
+            }
+            return _pos-begin;
+        }
+
+        template <typename HandlerT>
+        bool number(HandlerT& handler)
+        {
+            auto begin=_pos;
+            bool negative=false;
+            bool integer=true;
+
+            if (_data[_pos]=='-')
+            {
+                negative=true;
+                ++_pos;
+            }
+            auto int_begin=_pos;
+            auto digits=skip_digits();
+            if (digits==0 || (digits>1 && _data[int_begin]=='0'))
+            {
+                return fail("invalid number");
+            }
+            if (!eof() && _data[_pos]=='.')
+            {
+                integer=false;
+                ++_pos;
+                if (skip_digits()==0)
+                {
+                    return fail("invalid number");
+                }
+            }
+            if (!eof() && (_data[_pos]=='e' || _data[_pos]=='E'))
+            {
+                integer=false;
+                ++_pos;
+                if (!eof() && (_data[_pos]=='+' || _data[_pos]=='-'))
+                {
+                    ++_pos;
+                }
+                if (skip_digits()==0)
+                {
+                    return fail("invalid number");
+                }
+            }
+
+            auto str=_data.substr(begin,_pos-begin);
+            _number.assign(str.data(),str.size());
+            if (integer)
+            {
+                errno=0;
+                if (negative)
+                {
+                    auto val=std::strtoll(_number.c_str(),nullptr,10);
+                    if (errno==0)
+                    {
+                        return handler.on_int64(static_cast<int64_t>(val),str,_ec) || stop();
+                    }
+                }
+                else
+                {
+                    auto val=std::strtoull(_number.c_str(),nullptr,10);
+                    if (errno==0)
+                    {
+                        if (val<=static_cast<unsigned long long>(INT64_MAX))
+                        {
+                            return handler.on_int64(static_cast<int64_t>(val),str,_ec) || stop();
+                        }
+                        return handler.on_uint64(static_cast<uint64_t>(val),str,_ec) || stop();
+                    }
+                }
+            }
+            auto val=std::strtod(_number.c_str(),nullptr);
+            return handler.on_double(val,str,_ec) || stop();
+        }
+
+        string_view _data;
+        size_t _pos=0;
+        const char* _error=nullptr;
+        bool _stopped=false;
+        std::error_code _ec;
+
+        string_view _str;
+        std::string _buffer;
+        std::string _number;
+};
+
+}
+
+#endif // HATN_VALIDATOR_FILECHECK_JSON_READER_HPP
@@ -0,0 +1,396 @@
+/**
+@copyright Evgeny Sidorov 2020
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+*/
+
+/****************************************************************************/
+
+/** @file tools/filecheck/main.cpp
+*
+*  Command line tool for validation of NDJSON and CSV files.
+*
+*/
+
+/****************************************************************************/
+
+#include <cstdlib>
+#include <cstring>
+#include <chrono>
+#include <string>
+#include <fstream>
+#include <iostream>
+#include <iomanip>
+#include <thread>
+
+#include <hatn/validator/validator.hpp>
+#include <hatn/validator/validate.hpp>
+#include <hatn/validator/json/json_sax_validator.hpp>
+#include <hatn/validator/csv/csv_row.hpp>
+
+#ifdef HATN_VALIDATOR_FILECHECK_SCHEMA
+#include HATN_VALIDATOR_FILECHECK_SCHEMA
+#else
+#include "schema.hpp"
+#endif
+
+#ifdef HATN_VALIDATOR_FILECHECK_BOOST_JSON
+#include <memory>
+#include <boost/json/basic_parser_impl.hpp>
+#else
+#include "json_reader.hpp"
+#endif
+
+#include "mapped_file.hpp"
+#include "filecheck.hpp"
+
+using namespace HATN_VALIDATOR_NAMESPACE;
+
+namespace
+{
+
+#ifdef HATN_VALIDATOR_FILECHECK_BOOST_JSON
+
+/**
+ * @brief Checker of NDJSON records parsed with boost::json::basic_parser.
+ */
+template <typename ValidatorT>
+class ndjson_checker
+{
+    public:
+
+        using handler_type=json_sax_validator<ValidatorT,8>;
+
+        explicit ndjson_checker(const ValidatorT& v)
+            : _parser(std::make_unique<boost::json::basic_parser<handler_type>>(boost::json::parse_options(),v))
+        {}
+
+        bool check(string_view record, std::string& report)
+        {
+            boost::json::error_code ec;
+            _parser->reset();
+            auto pos=_parser->write_some(false,record.data(),record.size(),ec);
+            if (!ec && !_parser->handler().failed())
+            {
+                return true;
+            }
+            if (_parser->handler().failed())
+            {
+                report=_parser->handler().error().message();
+            }
+            else
+            {
+                report="invalid JSON: "+ec.message()+" at column "+std::to_string(pos+1);
+            }
+            return false;
+        }
+
+    private:
+
+        // parser is neither copyable nor movable
+        std::unique_ptr<boost::json::basic_parser<handler_type>> _parser;
+};
+
+#else
+
+/**
+ * @brief Checker of NDJSON records parsed with built-in reader.
+ */
+template <typename ValidatorT>
+class ndjson_checker
+{
+    public:
+
+        explicit ndjson_checker(const ValidatorT& v) : _handler(v)
+        {}
+
+        bool check(string_view record, std::string& report)
+        {
+            if (_reader.read(record,_handler))
+            {
+                return true;
+            }
+            if (_reader.error()!=nullptr)
+            {
+                report=std::string("invalid JSON: ")+_reader.error()+" at column "+std::to_string(_reader.position()+1);
+            }
+            else
+            {
+                report=_handler.error().message();
+            }
+            return false;
+        }
+
+    private:
+
+        filecheck::json_reader _reader;
+        json_sax_validator<ValidatorT,8> _handler;
+};
+
+#endif
+
+/**
+ * @brief Checker of CSV records.
+ */
+template <typename ValidatorT>
+class csv_checker
+{
+    public:
+
+        csv_checker(const ValidatorT& v, const csv_header& header) : _validator(v),_header(header)
+        {}
+
+        bool check(string_view record, std::string& report)
+        {
+            csv_row row{record,_header};
+            if (!row.well_formed())
+            {
+                report="invalid CSV: unterminated quoted field";
+                return false;
+            }
+            validate(row,_validator,_err);
+            if (!_err)
+            {
+                return true;
+            }
+            report=_err.message();
+            return false;
+        }
+
+    private:
+
+        const ValidatorT& _validator;
+        const csv_header& _header;
+        error_report _err;
+};
+
+struct options
+{
+    std::string format;
+    std::string input;
+    std::string output;
+    size_t threads=0;
+    size_t chunk_size=16*1024*1024;
+    bool csv_header=false;
+    bool csv_no_header=false;
+    char delimiter=',';
+};
+
+void usage(const char* name)
+{
+    std::cerr << "Usage: " << name << " [options] FILE\n"
+              << "Validate records of newline-delimited JSON or CSV file.\n\n"
+              << "Options:\n"
+              << "  --format ndjson|csv   format of the file, default is detected by file extension\n"
+              << "  --threads N           number of threads, default is number of CPU cores\n"
+              << "  --chunk-size BYTES    size of chunks the file is split into, default is 16 MB\n"
+              << "  --output FILE         file to write failed lines to, default is standard error\n"
+              << "  --csv-header          use the first line of CSV file as names of columns\n"
+              << "  --csv-no-header       validate the first line of CSV file as a record, by default it is skipped\n"
+              << "  --delimiter C         delimiter of CSV fields, default is ','\n\n"
+              << "Exit status is 0 if all records are valid, 1 if some records are invalid, 2 on errors.\n";
+}
+
+bool ends_with(const std::string& str, const char* suffix)
+{
+    auto len=std::strlen(suffix);
+    return str.size()>=len && str.compare(str.size()-len,len,suffix)==0;
+}
+
+bool parse_options(int argc, char* argv[], options& opts)
+{
+    for (int i=1;i<argc;i++)
+    {
+        std::string arg=argv[i];
+        auto next=[&]() -> const char*
+        {
+            return (i+1<argc) ? argv[++i] : nullptr;
+        };
+        const char* val=nullptr;
+
+        if (arg=="--format" && (val=next()))
+        {
+            opts.format=val;
+        }
+        else if (arg=="--threads" && (val=next()))
+        {
+            opts.threads=static_cast<size_t>(std::strtoull(val,nullptr,10));
+        }
+        else if (arg=="--chunk-size" && (val=next()))
+        {
+            opts.chunk_size=static_cast<size_t>(std::strtoull(val,nullptr,10));
+        }
+        else if (arg=="--output" && (val=next()))
+        {
+            opts.output=val;
+        }
+        else if (arg=="--csv-header")
+        {
+            opts.csv_header=true;
+        }
+        else if (arg=="--csv-no-header")
+        {
+            opts.csv_no_header=true;
+        }
+        else if (arg=="--delimiter" && (val=next()))
+        {
+            opts.delimiter=(std::strcmp(val,"\\t")==0) ? '\t' : val[0];
+        }
+        else if (arg.compare(0,2,"--")!=0 && opts.input.empty())
+        {
+            opts.input=arg;
+        }
+        else
+        {
+            std::cerr << "Invalid argument: " << arg << std::endl;
+            return false;
+        }
+    }
+
+    if (opts.input.empty())
+    {
+        return false;
+    }
+    if (opts.format.empty())
+    {
+        opts.format=(ends_with(opts.input,".csv") || ends_with(opts.input,".tsv")) ? "csv" : "ndjson";
+        if (ends_with(opts.input,".tsv"))
+        {
+            opts.delimiter='\t';
+        }
+    }
+    if (opts.format!="ndjson" && opts.format!="csv")
+    {
+        std::cerr << "Invalid format: " << opts.format << std::endl;
+        return false;
+    }
+    if (opts.csv_header && opts.csv_no_header)
+    {
+        std::cerr << "Options --csv-header and --csv-no-header are mutually exclusive" << std::endl;
+        return false;
+    }
+    if (opts.threads==0)
+    {
+        opts.threads=(std::max)(1u,std::thread::hardware_concurrency());
+    }
+    if (opts.chunk_size==0)
+    {
+        opts.chunk_size=1;
+    }
+    return true;
+}
+
+template <typename MakeCheckerT>
+int run(const options& opts, const filecheck::mapped_file& file, size_t offset, const MakeCheckerT& make_checker)
+{
+    std::ofstream out_file;
+    if (!opts.output.empty())
+    {
+        out_file.open(opts.output,std::ios::out|std::ios::trunc);
+        if (!out_file)
+        {
+            std::cerr << "Failed to open output file " << opts.output << std::endl;
+            return 2;
+        }
+    }
+    std::ostream& out=opts.output.empty() ? std::cerr : out_file;
+
+    auto started=std::chrono::steady_clock::now();
+
+    const char* data=file.data()+offset;
+    size_t size=file.size()-offset;
+    size_t first_line=(offset==0) ? 1 : 2;
+
+    // failed lines are written in order as soon as their chunks are done
+    auto result=filecheck::check_parallel(data,size,opts.threads,opts.chunk_size,make_checker,
+        [&out](const filecheck::failure& item)
+        {
+            out << "line " << item.line << ": " << item.report << "\n";
+        },
+        first_line
+    );
+
+    auto finished=std::chrono::steady_clock::now();
+    auto seconds=std::chrono::duration<double>(finished-started).count();
+
+    out.flush();
+    if (!out)
+    {
+        std::cerr << "Failed to write failed lines" << std::endl;
+        return 2;
+    }
+
+    auto mb=static_cast<double>(file.size())/(1024.0*1024.0);
+    auto rate=[seconds](double val)
+    {
+        return seconds>0.0 ? val/seconds : 0.0;
+    };
+    std::cout << std::fixed << std::setprecision(2)
+              << "records: " << result.records
+              << ", failed: " << result.failed
+              << ", threads: " << opts.threads
+              << ", size: " << mb << " MB"
+              << ", time: " << std::setprecision(3) << seconds << " s"
+              << ", records/s: " << std::setprecision(0) << rate(static_cast<double>(result.records))
+              << ", MB/s: " << std::setprecision(2) << rate(mb)
+              << std::endl;
+
+    return result.failed==0 ? 0 : 1;
+}
+
+}
+
+int main(int argc, char* argv[])
+{
+    options opts;
+    if (!parse_options(argc,argv,opts))
+    {
+        usage(argv[0]);
+        return 2;
+    }
+
+    try
+    {
+        filecheck::mapped_file file(opts.input);
+
+        if (opts.format=="csv")
+        {
+            // the header line is either used for names of columns or skipped unless the file has no header
+            size_t offset=0;
+            string_view header_line;
+            if (!opts.csv_no_header && file.size()!=0)
+            {
+                auto eol=static_cast<const char*>(std::memchr(file.data(),'\n',file.size()));
+                offset=(eol==nullptr) ? file.size() : static_cast<size_t>(eol-file.data())+1;
+                if (opts.csv_header)
+                {
+                    header_line=string_view(file.data(),(eol==nullptr) ? offset : offset-1);
+                }
+            }
+            csv_header header{header_line,opts.delimiter};
+
+            auto v=filecheck::csv_validator();
+            return run(opts,file,offset,
+                [&]()
+                {
+                    return csv_checker<decltype(v)>(v,header);
+                }
+            );
+        }
+
+        auto v=filecheck::ndjson_validator();
+        return run(opts,file,0,
+            [&]()
+            {
+                return ndjson_checker<decltype(v)>(v);
+            }
+        );
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << e.what() << std::endl;
+        return 2;
+    }
+}
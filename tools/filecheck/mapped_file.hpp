@@ -0,0 +1,150 @@
+/**
+@copyright Evgeny Sidorov 2020
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+*/
+
+/****************************************************************************/
+
+/** @file tools/filecheck/mapped_file.hpp
+*
+*  Defines read-only file mapped to memory.
+*
+*/
+
+/****************************************************************************/
+
+#ifndef HATN_VALIDATOR_FILECHECK_MAPPED_FILE_HPP
+#define HATN_VALIDATOR_FILECHECK_MAPPED_FILE_HPP
+
+#include <string>
+#include <vector>
+#include <fstream>
+#include <stdexcept>
+
+#ifndef _WIN32
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+namespace filecheck
+{
+
+/**
+ * @brief Read-only file mapped to memory.
+ *
+ * On POSIX systems the file is mapped with mmap() so that pages are loaded by the kernel on demand
+ * and are shared by all threads. On other systems the file is read into a buffer.
+ */
+class mapped_file
+{
+    public:
+
+        /**
+         * @brief Constructor.
+         * @param path Path to the file.
+         *
+         * Throws std::runtime_error if the file can not be opened or mapped.
+         */
+        explicit mapped_file(const std::string& path)
+        {
+#ifndef _WIN32
+            _fd=::open(path.c_str(),O_RDONLY);
+            if (_fd<0)
+            {
+                throw std::runtime_error(error_message("failed to open file",path));
+            }
+            struct stat st;
+            if (::fstat(_fd,&st)!=0)
+            {
+                auto msg=error_message("failed to get size of file",path);
+                ::close(_fd);
+                throw std::runtime_error(msg);
+            }
+            _size=static_cast<size_t>(st.st_size);
+            if (_size!=0)
+            {
+                auto ptr=::mmap(nullptr,_size,PROT_READ,MAP_PRIVATE,_fd,0);
+                if (ptr==MAP_FAILED)
+                {
+                    auto msg=error_message("failed to map file",path);
+                    ::close(_fd);
+                    throw std::runtime_error(msg);
+                }
+                ::madvise(ptr,_size,MADV_SEQUENTIAL);
+                _data=static_cast<const char*>(ptr);
+            }
+#else
+            std::ifstream f(path,std::ios::binary|std::ios::ate);
+            if (!f)
+            {
+                throw std::runtime_error("failed to open file "+path);
+            }
+            _buffer.resize(static_cast<size_t>(f.tellg()));
+            f.seekg(0);
+            if (!f.read(_buffer.data(),static_cast<std::streamsize>(_buffer.size())))
+            {
+                throw std::runtime_error("failed to read file "+path);
+            }
+            _data=_buffer.data();
+            _size=_buffer.size();
+#endif
+        }
+
+        ~mapped_file()
+        {
+#ifndef _WIN32
+            if (_data!=nullptr)
+            {
+                ::munmap(const_cast<char*>(_data),_size);
+            }
+            ::close(_fd);
+#endif
+        }
+
+        mapped_file(const mapped_file&)=delete;
+        mapped_file& operator=(const mapped_file&)=delete;
+
+        /**
+         * @brief Get content of the file.
+         * @return Pointer to the first byte of the file.
+         */
+        const char* data() const noexcept
+        {
+            return _data;
+        }
+
+        /**
+         * @brief Get size of the file.
+         * @return Size in bytes.
+         */
+        size_t size() const noexcept
+        {
+            return _size;
+        }
+
+    private:
+
+#ifndef _WIN32
+        static std::string error_message(const char* msg, const std::string& path)
+        {
+            return std::string(msg)+" "+path+": "+std::strerror(errno);
+        }
+
+        int _fd=-1;
+#else
+        std::vector<char> _buffer;
+#endif
+        const char* _data=nullptr;
+        size_t _size=0;
+};
+
+}
+
+#endif // HATN_VALIDATOR_FILECHECK_MAPPED_FILE_HPP
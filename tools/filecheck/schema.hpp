@@ -0,0 +1,78 @@
+/**
+@copyright Evgeny Sidorov 2020
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file LICENSE.md or copy at http://boost.org/LICENSE_1_0.txt)
+
+*/
+
+/****************************************************************************/
+
+/** @file tools/filecheck/schema.hpp
+*
+*  Defines default validators of records used by filecheck tool.
+*
+*  Replace this file with your own schema by setting VALIDATOR_FILECHECK_SCHEMA CMake parameter to a path of
+*  a header that defines functions filecheck::ndjson_validator() and filecheck::csv_validator() with the same meaning.
+*
+*/
+
+/****************************************************************************/
+
+#ifndef HATN_VALIDATOR_FILECHECK_SCHEMA_HPP
+#define HATN_VALIDATOR_FILECHECK_SCHEMA_HPP
+
+#include <hatn/validator/validator.hpp>
+#include <hatn/validator/operators/number_patterns.hpp>
+#include <hatn/validator/csv/csv_row.hpp>
+
+namespace filecheck
+{
+
+using namespace HATN_VALIDATOR_NAMESPACE;
+
+/**
+ * @brief Get validator of NDJSON records.
+ * @return Validator.
+ *
+ * Each line of NDJSON file is a JSON document validated with json_sax_validator, so members are pre-validated
+ * at their paths within the document, and names of objects' members and indexes of arrays' elements are used as keys.
+ * Rules requiring members to exist are checked when the record is closed.
+ *
+ * Default validator expects records like {"id":1,"name":"item","price":10.5,"tags":["a","b"]}.
+ */
+inline auto ndjson_validator()
+{
+    return validator(
+                _["id"](exists,true),
+                _["id"](gte,0),
+                _["name"](size(gte,1) ^AND^ size(lte,64)),
+                _["price"](gte,0),
+                _["tags"](size(lte,8)),
+                _["tags"][ALL](size(gte,1))
+            );
+}
+
+/**
+ * @brief Get validator of CSV records.
+ * @return Validator.
+ *
+ * Each line of CSV file is validated as csv_row, so fields are accessed by indexes,
+ * or by names of columns if the file has a header and --csv-header option is used.
+ * Fields can be compared both with strings and with numbers.
+ *
+ * Default validator expects records like "1,item,10.5".
+ */
+inline auto csv_validator()
+{
+    return validator(
+                size(eq,3),
+                _[0](str_int,true),
+                _[1](size(gte,1) ^AND^ size(lte,64)),
+                _[2](str_float,true)
+            );
+}
+
+}
+
+#endif // HATN_VALIDATOR_FILECHECK_SCHEMA_HPP